@@ -182,6 +182,8 @@ void acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slon
 
 void acb_dft_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
 void acb_dft_inverse_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
+void acb_dft_many_precomp(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec);
+void acb_dft_inverse_many_precomp(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec);
 void acb_dft_naive_precomp(acb_ptr w, acb_srcptr v, const acb_dft_naive_t pol, slong prec);
 void acb_dft_cyc_precomp(acb_ptr w, acb_srcptr v, const acb_dft_cyc_t cyc, slong prec);
 
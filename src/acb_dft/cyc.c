@@ -54,7 +54,14 @@ _acb_dft_cyc_init_z_fac(acb_dft_cyc_t t, n_factor_t fac, slong dv, acb_ptr z, sl
             t->cyc[num].z = z;
             t->cyc[num].dz = dz;
             /* TODO: ugly, reorder should solve this */
-            if (num == t->num - 1)
+            if (num > 0 && j > 0 && t->cyc[num - 1].pre->type == DFT_CONV)
+            {
+                /* same prime as the previous step: share its Bluestein
+                   scheme, which only differs by the stride */
+                *t->cyc[num].pre = *t->cyc[num - 1].pre;
+                t->cyc[num].pre->t.bluestein->dv = (num == t->num - 1) ? dv : M;
+            }
+            else if (num == t->num - 1)
                 _acb_dft_precomp_init(t->cyc[num].pre, dv, z, dz, m, prec);
             else
                 _acb_dft_precomp_init(t->cyc[num].pre, M, z, dz * M, m, prec);
@@ -82,7 +89,15 @@ acb_dft_cyc_clear(acb_dft_cyc_t t)
 {
     slong i;
     for (i = 0; i < t->num; i++)
+    {
+        /* shared Bluestein schemes are cleared with the first step */
+        if (i > 0 && t->cyc[i].pre->type == DFT_CONV
+                  && t->cyc[i - 1].pre->type == DFT_CONV
+                  && t->cyc[i].pre->t.bluestein->z == t->cyc[i - 1].pre->t.bluestein->z)
+            continue;
+
         acb_dft_precomp_clear(t->cyc[i].pre);
+    }
     if (t->zclear)
         _acb_vec_clear(t->z, t->n);
     flint_free(t->cyc);
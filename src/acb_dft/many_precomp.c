@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "acb_dft.h"
+
+/* minimum total length of the transforms to be split over threads */
+#define DFT_THREAD_CUTOFF 256
+
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr v;
+    const acb_dft_pre_struct * pre;
+    int inverse;
+    slong prec;
+}
+many_work_t;
+
+static void
+many_worker(slong i, many_work_t * work)
+{
+    slong n = work->pre->n;
+
+    if (work->inverse)
+        acb_dft_inverse_precomp(work->w + i * n, work->v + i * n, work->pre, work->prec);
+    else
+        acb_dft_precomp(work->w + i * n, work->v + i * n, work->pre, work->prec);
+}
+
+static void
+_acb_dft_many_precomp(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, int inverse, slong prec)
+{
+    many_work_t work;
+    int thread_limit;
+
+    work.w = w;
+    work.v = v;
+    work.pre = pre;
+    work.inverse = inverse;
+    work.prec = prec;
+
+    /* the scheme is only read, so all threads can share it; threads
+       not used here remain available to the individual transforms */
+    thread_limit = (num * pre->n >= DFT_THREAD_CUTOFF) ? -1 : 1;
+
+    flint_parallel_do((do_func_t) many_worker, &work, num, thread_limit, FLINT_PARALLEL_STRIDED);
+}
+
+void
+acb_dft_many_precomp(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec)
+{
+    _acb_dft_many_precomp(w, v, num, pre, 0, prec);
+}
+
+void
+acb_dft_inverse_many_precomp(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec)
+{
+    _acb_dft_many_precomp(w, v, num, pre, 1, prec);
+}
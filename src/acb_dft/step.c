@@ -9,10 +9,56 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb_dft.h"
 
 #define REORDER 0
 
+/* minimum length of a product step to be split over threads */
+#define DFT_THREAD_CUTOFF 256
+
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr v;
+    acb_ptr t;
+    acb_dft_step_ptr cyc;
+    slong num;
+    slong prec;
+}
+step_work_t;
+
+/* DFT of size M on the i-th subgroup, followed by twiddling */
+static void
+step_worker_sub(slong i, step_work_t * work)
+{
+    const acb_dft_step_struct * c = work->cyc;
+    acb_ptr wi = work->w + i * c->M;
+    slong j;
+
+    acb_dft_step(wi, work->v + i * c->dv, work->cyc + 1, work->num - 1, work->prec);
+
+    /* twiddle if non trivial product */
+    if (c->z != NULL && i != 0)
+    {
+        for (j = 1; j < c->M; j++)
+        {
+            if (DFT_VERB)
+                flint_printf("z[%wu*%wu]",c->dz,i*j);
+            acb_mul(wi + j, wi + j, c->z + c->dz * i * j, work->prec);
+        }
+    }
+}
+
+/* DFT of size m on the j-th coset */
+static void
+step_worker_quo(slong j, step_work_t * work)
+{
+    const acb_dft_step_struct * c = work->cyc;
+
+    acb_dft_precomp(work->t + c->m * j, work->w + j, c->pre, work->prec);
+}
+
 void
 acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong prec)
 {
@@ -28,9 +74,10 @@ acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong pre
     else
     {
         slong i, j;
-        slong m = c.m, M = c.M, dv = c.dv, dz = c.dz;
-        acb_srcptr z = c.z;
+        slong m = c.m, M = c.M;
         acb_ptr t;
+        step_work_t work;
+        int thread_limit;
 #if REORDER
         acb_ptr w2;
 #endif
@@ -43,24 +90,22 @@ acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong pre
             v = t;
         }
 
+        work.w = w;
+        work.v = v;
+        work.t = t;
+        work.cyc = cyc;
+        work.num = num;
+        work.prec = prec;
+
+        /* the small transforms are independent; only wake up threads
+           if there is enough work to share */
+        thread_limit = (m * M >= DFT_THREAD_CUTOFF) ? -1 : 1;
+
         /* m DFT of size M */
-        for (i = 0; i < m; i++)
-            acb_dft_step(w + i * M, v + i * dv, cyc + 1, num - 1, prec);
+        flint_parallel_do((do_func_t) step_worker_sub, &work, m, thread_limit, 0);
 
-        /* twiddle if non trivial product */
-        if (c.z != NULL)
-        {
-            acb_ptr wi;
-            for (wi = w + M, i = 1; i < m; i++, wi += M)
-                for (j = 1; j < M; j++)
-                {
-                    if (DFT_VERB)
-                        flint_printf("z[%wu*%wu]",dz,i*j);
-                    acb_mul(wi + j, wi + j, z + dz * i * j, prec);
-                }
-            if (DFT_VERB)
-                flint_printf("\n");
-        }
+        if (DFT_VERB && c.z != NULL)
+            flint_printf("\n");
 
 #if REORDER
         /* reorder w to avoid dv shifts in next DFT */
@@ -71,8 +116,7 @@ acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong pre
 #endif
 
         /* M DFT of size m */
-        for (j = 0; j < M; j++)
-            acb_dft_precomp(t + m * j, w + j, c.pre, prec);
+        flint_parallel_do((do_func_t) step_worker_quo, &work, M, thread_limit, 0);
 
         /* reorder */
         for (i = 0; i < m; i++)
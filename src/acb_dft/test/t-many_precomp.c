@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("many_precomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        acb_dft_pre_t pre;
+        acb_ptr v, w1, w2;
+        slong i, len, num, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        /* occasionally a square of a prime using Bluestein steps */
+        if (iter % 20 == 0)
+            len = 101 * 101;
+        else
+            len = 1 + n_randint(state, 400);
+
+        num = n_randint(state, 6);
+        prec = 2 + n_randint(state, 200);
+
+        v = _acb_vec_init(num * len);
+        w1 = _acb_vec_init(num * len);
+        w2 = _acb_vec_init(num * len);
+
+        for (i = 0; i < num * len; i++)
+            acb_set_si_si(v + i, n_randint(state, 100), n_randint(state, 100));
+
+        acb_dft_precomp_init(pre, len, prec);
+
+        acb_dft_many_precomp(w1, v, num, pre, prec);
+
+        for (i = 0; i < num; i++)
+        {
+            if (len == 101 * 101)
+                acb_dft_bluestein(w2 + i * len, v + i * len, len, prec);
+            else
+                acb_dft_naive(w2 + i * len, v + i * len, len, prec);
+        }
+
+        for (i = 0; i < num * len; i++)
+        {
+            if (!acb_overlaps(w1 + i, w2 + i))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("len = %wd, num = %wd, i = %wd\n", len, num, i);
+                acb_printd(w1 + i, 30); flint_printf("\n");
+                acb_printd(w2 + i, 30); flint_printf("\n");
+                flint_abort();
+            }
+        }
+
+        /* inverse, with aliasing */
+        acb_dft_inverse_many_precomp(w1, w1, num, pre, prec);
+
+        for (i = 0; i < num * len; i++)
+        {
+            if (!acb_contains(w1 + i, v + i))
+            {
+                flint_printf("FAIL (inverse)\n\n");
+                flint_printf("len = %wd, num = %wd, i = %wd\n", len, num, i);
+                acb_printd(w1 + i, 30); flint_printf("\n");
+                acb_printd(v + i, 30); flint_printf("\n");
+                flint_abort();
+            }
+        }
+
+        acb_dft_precomp_clear(pre);
+        _acb_vec_clear(v, num * len);
+        _acb_vec_clear(w1, num * len);
+        _acb_vec_clear(w2, num * len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -19,8 +19,22 @@ Todo items present in the original code:
 - Aggressive early deflation
 */
 
+#include "thread_support.h"
 #include "acb_mat.h"
 
+/* Use threads when a loop performs at least this many multiplications
+   times the precision. */
+#define APPROX_EIG_THREAD_CUTOFF 200000
+
+static int
+approx_eig_thread_limit(slong count, slong len, slong prec)
+{
+    if ((double) count * len * FLINT_MAX(prec, 64) >= APPROX_EIG_THREAD_CUTOFF)
+        return -1;
+    else
+        return 1;
+}
+
 static void
 acb_approx_mag(mag_t res, const acb_t x)
 {
@@ -93,10 +107,54 @@ acb_approx_div(acb_t z, const acb_t x, const acb_t y, slong prec)
     acb_clear(t);
 }
 
+/* The Givens rotations of a QR sweep only touch two columns of Q each,
+   so we store them and apply them all at the end; the rows of Q
+   are then independent and can be processed in parallel. */
+typedef struct
+{
+    acb_mat_struct * Q;
+    acb_srcptr rot;
+    slong nrot;
+    slong n0;
+    slong prec;
+}
+qr_step_work_t;
+
+static void
+qr_step_Q_worker(slong k, qr_step_work_t * work)
+{
+    acb_mat_struct * Q = work->Q;
+    acb_struct v3[2];
+    acb_t t;
+    slong r, c;
+
+    acb_init(t);
+
+    for (r = 0; r < work->nrot; r++)
+    {
+        /* x = Q[k,c  ] */
+        /* y = Q[k,c+1] */
+        /* Q[k,c  ] = c * x + s * y */
+        /* Q[k,c+1] = cc * y - cs * x */
+
+        c = work->n0 + r;
+
+        v3[0] = *acb_mat_entry(Q, k, c);
+        v3[1] = *acb_mat_entry(Q, k, c + 1);
+
+        acb_approx_dot(t, NULL, 0, work->rot + 4 * r, 1, v3, 1, 2, work->prec);
+        acb_approx_dot(acb_mat_entry(Q, k, c + 1), NULL, 0, work->rot + 4 * r + 2, 1, v3 + 1, -1, 2, work->prec);
+        acb_swap(t, acb_mat_entry(Q, k, c));
+    }
+
+    acb_clear(t);
+}
+
 void
 acb_mat_approx_qr_step(acb_mat_t A, acb_mat_t Q, slong n0, slong n1, const acb_t shift, slong prec)
 {
-    slong j, k, n;
+    slong j, k, n, nrot;
+    acb_ptr rot;
     acb_t c, s, negs, cc, cs, negcs, t;
     acb_struct v1[2];
     acb_struct v1neg[2];
@@ -107,6 +165,10 @@ acb_mat_approx_qr_step(acb_mat_t A, acb_mat_t Q, slong n0, slong n1, const acb_t
 
     n = acb_mat_nrows(A);
 
+    /* rotation r is stored as (c, s, cc, -cs) */
+    nrot = FLINT_MAX(n1 - n0 - 1, 1);
+    rot = (Q != NULL) ? _acb_vec_init(4 * nrot) : NULL;
+
     acb_init(c);
     acb_init(s);
     acb_init(negs);
@@ -186,20 +248,10 @@ acb_mat_approx_qr_step(acb_mat_t A, acb_mat_t Q, slong n0, slong n1, const acb_t
 
     if (Q != NULL)
     {
-        for (k = 0; k < n; k++)
-        {
-            /* x = Q[k,n0  ] */
-            /* y = Q[k,n0+1] */
-            /* Q[k,n0  ] = c * x + s * y */
-            /* Q[k,n0+1] = cc * y - cs * x */
-
-            v3[0] = *acb_mat_entry(Q, k, n0);
-            v3[1] = *acb_mat_entry(Q, k, n0 + 1);
-
-            acb_approx_dot(t,                           NULL, 0, v1,    1, v3,      1, 2, prec);
-            acb_approx_dot(acb_mat_entry(Q, k, n0 + 1), NULL, 0, v2neg, 1, v3 + 1, -1, 2, prec);
-            acb_swap(t, acb_mat_entry(Q, k, n0));
-        }
+        acb_set(rot + 0, c);
+        acb_set(rot + 1, s);
+        acb_set(rot + 2, cc);
+        acb_set(rot + 3, negcs);
     }
 
     for (j = n0; j < n1 - 2; j++)
@@ -277,21 +329,28 @@ acb_mat_approx_qr_step(acb_mat_t A, acb_mat_t Q, slong n0, slong n1, const acb_t
 
         if (Q != NULL)
         {
-            for (k = 0; k < n; k++)
-            {
-                /* x = Q[k,j+1] */
-                /* y = Q[k,j+2] */
-                /* Q[k,j+1] = c * x + s * y */
-                /* Q[k,j+2] = cc * y - cs * x */
+            k = j + 1 - n0;
+            acb_set(rot + 4 * k + 0, c);
+            acb_set(rot + 4 * k + 1, s);
+            acb_set(rot + 4 * k + 2, cc);
+            acb_set(rot + 4 * k + 3, negcs);
+        }
+    }
 
-                v3[0] = *acb_mat_entry(Q, k, j + 1);
-                v3[1] = *acb_mat_entry(Q, k, j + 2);
+    if (Q != NULL)
+    {
+        qr_step_work_t work;
 
-                acb_approx_dot(t,                          NULL, 0, v1,    1, v3,      1, 2, prec);
-                acb_approx_dot(acb_mat_entry(Q, k, j + 2), NULL, 0, v2neg, 1, v3 + 1, -1, 2, prec);
-                acb_swap(t, acb_mat_entry(Q, k, j + 1));
-            }
-        }
+        work.Q = Q;
+        work.rot = rot;
+        work.nrot = nrot;
+        work.n0 = n0;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) qr_step_Q_worker, &work, n,
+            approx_eig_thread_limit(n, nrot, prec), FLINT_PARALLEL_UNIFORM);
+
+        _acb_vec_clear(rot, 4 * nrot);
     }
 
     acb_clear(c);
@@ -305,14 +364,94 @@ acb_mat_approx_qr_step(acb_mat_t A, acb_mat_t Q, slong n0, slong n1, const acb_t
     arb_clear(u);
 }
 
+/* Applying the Householder reflection with vector (T[i], A[i,0], ...,
+   A[i,i-2]) from the right updates the rows j < i independently,
+   and applying it from the left updates all columns independently. */
+typedef struct
+{
+    acb_mat_struct * A;
+    acb_srcptr V;       /* T[i], A[i,0], ..., A[i,i-2] */
+    acb_srcptr Vconj;   /* conjugate of V */
+    slong i;
+    slong prec;
+}
+hessenberg_work_t;
+
+static void
+hessenberg_right_worker(slong j, hessenberg_work_t * work)
+{
+    acb_mat_struct * A = work->A;
+    slong k, i = work->i;
+    acb_ptr V2;
+    acb_t GG, TT;
+
+    acb_init(GG);
+    acb_init(TT);
+    V2 = flint_malloc(sizeof(acb_struct) * i);
+
+    V2[0] = *acb_mat_entry(A, j, i - 1);
+    for (k = 0; k < i - 1; k++)
+        V2[k + 1] = *acb_mat_entry(A, j, k);
+
+    acb_approx_dot(GG, NULL, 0, work->Vconj, 1, V2, 1, i, work->prec);
+
+    acb_approx_mul(TT, GG, work->V, work->prec);
+    acb_approx_sub(acb_mat_entry(A, j, i - 1),
+                    acb_mat_entry(A, j, i - 1), TT, work->prec);
+    for (k = 0; k < i - 1; k++)
+    {
+        acb_approx_mul(TT, GG, work->V + k + 1, work->prec);
+        acb_approx_sub(acb_mat_entry(A, j, k),
+                        acb_mat_entry(A, j, k), TT, work->prec);
+    }
+
+    flint_free(V2);
+    acb_clear(GG);
+    acb_clear(TT);
+}
+
+static void
+hessenberg_left_worker(slong j, hessenberg_work_t * work)
+{
+    acb_mat_struct * A = work->A;
+    slong k, i = work->i;
+    acb_ptr V2;
+    acb_t GG, TT;
+
+    acb_init(GG);
+    acb_init(TT);
+    V2 = flint_malloc(sizeof(acb_struct) * i);
+
+    V2[0] = *acb_mat_entry(A, i - 1, j);
+    for (k = 0; k < i - 1; k++)
+        V2[k + 1] = *acb_mat_entry(A, k, j);
+
+    acb_approx_dot(GG, NULL, 0, work->V, 1, V2, 1, i, work->prec);
+
+    acb_approx_mul(TT, GG, work->Vconj, work->prec);
+    acb_approx_sub(acb_mat_entry(A, i - 1, j),
+                    acb_mat_entry(A, i - 1, j), TT, work->prec);
+    for (k = 0; k < i - 1; k++)
+    {
+        acb_approx_mul(TT, GG, work->Vconj + k + 1, work->prec);
+        acb_approx_sub(acb_mat_entry(A, k, j),
+                        acb_mat_entry(A, k, j), TT, work->prec);
+    }
+
+    flint_free(V2);
+    acb_clear(GG);
+    acb_clear(TT);
+}
+
 void
 acb_mat_approx_hessenberg_reduce_0(acb_mat_t A, acb_ptr T, slong prec)
 {
-    slong i, j, k, n;
+    slong i, k, n;
     arf_t scale, scale_inv, tt, H, G, f;
     acb_ptr V1, V2;
-    acb_t ff, GG, TT;
+    acb_t ff;
     acb_t F;
+    hessenberg_work_t work;
 
     n = acb_mat_nrows(A);
     if (n <= 2)
@@ -325,11 +464,15 @@ acb_mat_approx_hessenberg_reduce_0(acb_mat_t A, acb_ptr T, slong prec)
     arf_init(G);
     arf_init(f);
     acb_init(F);
-    V1 = _acb_vec_init(n + 1);
-    V2 = _acb_vec_init(n + 1);
+    /* V1 holds shallow copies, V2 the conjugates */
+    V1 = flint_malloc(sizeof(acb_struct) * n);
+    V2 = _acb_vec_init(n);
     acb_init(ff);
-    acb_init(GG);
-    acb_init(TT);
+
+    work.A = A;
+    work.V = V1;
+    work.Vconj = V2;
+    work.prec = prec;
 
     for (i = n - 1; i >= 2; i--)
     {
@@ -418,55 +561,25 @@ acb_mat_approx_hessenberg_reduce_0(acb_mat_t A, acb_ptr T, slong prec)
                         H, prec, ARF_RND_DOWN);
         }
 
-        /* todo: optimize copies below */
         /* todo: conj mid etc... */
 
-        /* Apply Householder transformation (from the right). */
-        for (j = 0; j < i; j++)
+        V1[0] = T[i];
+        acb_conj(V2, T + i);
+        for (k = 0; k < i - 1; k++)
         {
-            acb_conj(V1, T + i);
-            acb_set(V2, acb_mat_entry(A, j, i - 1));
-            for (k = 0; k < i - 1; k++)
-            {
-                acb_conj(V1 + k + 1, acb_mat_entry(A, i, k));
-                acb_set(V2 + k + 1, acb_mat_entry(A, j, k));
-            }
-            acb_approx_dot(GG, NULL, 0, V1, 1, V2, 1, i, prec);
-
-            acb_approx_mul(TT, GG, T + i, prec);
-            acb_approx_sub(acb_mat_entry(A, j, i - 1),
-                            acb_mat_entry(A, j, i - 1), TT, prec);
-            for (k = 0; k < i - 1; k++)
-            {
-                acb_approx_mul(TT, GG, acb_mat_entry(A, i, k), prec);
-                acb_approx_sub(acb_mat_entry(A, j, k),
-                                acb_mat_entry(A, j, k), TT, prec);
-            }
+            V1[k + 1] = *acb_mat_entry(A, i, k);
+            acb_conj(V2 + k + 1, acb_mat_entry(A, i, k));
         }
 
-        for (j = 0; j < n; j++)
-        {
-            acb_set(V1, T + i);
-            acb_set(V2, acb_mat_entry(A, i - 1, j));
-            for (k = 0; k < i - 1; k++)
-            {
-                acb_set(V1 + k + 1, acb_mat_entry(A, i, k));
-                acb_set(V2 + k + 1, acb_mat_entry(A, k, j));
-            }
-            acb_approx_dot(GG, NULL, 0, V1, 1, V2, 1, i, prec);
+        work.i = i;
 
-            acb_conj(TT, T + i);
-            acb_approx_mul(TT, GG, TT, prec);
-            acb_approx_sub(acb_mat_entry(A, i - 1, j),
-                            acb_mat_entry(A, i - 1, j), TT, prec);
-            for (k = 0; k < i - 1; k++)
-            {
-                acb_conj(TT, acb_mat_entry(A, i, k));
-                acb_approx_mul(TT, GG, TT, prec);
-                acb_approx_sub(acb_mat_entry(A, k, j),
-                                acb_mat_entry(A, k, j), TT, prec);
-            }
-        }
+        /* Apply Householder transformation (from the right). */
+        flint_parallel_do((do_func_t) hessenberg_right_worker, &work, i,
+            approx_eig_thread_limit(i, i, prec), FLINT_PARALLEL_UNIFORM);
+
+        /* Apply Householder transformation (from the left). */
+        flint_parallel_do((do_func_t) hessenberg_left_worker, &work, n,
+            approx_eig_thread_limit(n, i, prec), FLINT_PARALLEL_UNIFORM);
     }
 
     arf_clear(scale);
@@ -476,18 +589,59 @@ acb_mat_approx_hessenberg_reduce_0(acb_mat_t A, acb_ptr T, slong prec)
     arf_clear(G);
     arf_clear(f);
     acb_clear(F);
-    _acb_vec_clear(V1, n + 1);
-    _acb_vec_clear(V2, n + 1);
+    flint_free(V1);
+    _acb_vec_clear(V2, n);
     acb_clear(ff);
-    acb_clear(GG);
-    acb_clear(TT);
+}
+
+typedef struct
+{
+    acb_mat_struct * A;
+    acb_srcptr Ti;
+    acb_srcptr Ti_conj;
+    slong i;
+    slong prec;
+}
+hessenberg_1_work_t;
+
+/* Applies reflection i to column j < i of the accumulated Q. */
+static void
+hessenberg_1_worker(slong j, hessenberg_1_work_t * work)
+{
+    acb_mat_struct * A = work->A;
+    slong k, i = work->i, prec = work->prec;
+    acb_t G, t;
+
+    acb_init(G);
+    acb_init(t);
+
+    /* todo: rewrite using approx_dot */
+    acb_approx_mul(G, work->Ti, acb_mat_entry(A, i - 1, j), prec);
+    for (k = 0; k < i - 1; k++)
+    {
+        acb_approx_mul(t, acb_mat_entry(A, i, k), acb_mat_entry(A, k, j), prec);
+        acb_approx_add(G, G, t, prec);
+    }
+
+    acb_approx_mul(t, G, work->Ti_conj, prec);
+    acb_approx_sub(acb_mat_entry(A, i - 1, j), acb_mat_entry(A, i - 1, j), t, prec);
+    for (k = 0; k < i - 1; k++)
+    {
+        acb_conj(t, acb_mat_entry(A, i, k));
+        acb_approx_mul(t, G, t, prec);
+        acb_approx_sub(acb_mat_entry(A, k, j), acb_mat_entry(A, k, j), t, prec);
+    }
+
+    acb_clear(G);
+    acb_clear(t);
 }
 
 void
 acb_mat_approx_hessenberg_reduce_1(acb_mat_t A, acb_srcptr T, slong prec)
 {
-    slong i, j, k, n;
-    acb_t G, t;
+    slong i, j, n;
+    acb_t Ti_conj;
+    hessenberg_1_work_t work;
 
     n = acb_mat_nrows(A);
 
@@ -503,33 +657,21 @@ acb_mat_approx_hessenberg_reduce_1(acb_mat_t A, acb_srcptr T, slong prec)
     acb_zero(acb_mat_entry(A, 0, 1));
     acb_zero(acb_mat_entry(A, 1, 0));
 
-    acb_init(G);
-    acb_init(t);
+    acb_init(Ti_conj);
+
+    work.A = A;
+    work.Ti_conj = Ti_conj;
+    work.prec = prec;
 
     for (i = 2; i < n; i++)
     {
         if (!acb_is_zero(T + i))
         {
-            /* todo: rewrite using approx_dot */
-            for (j = 0; j < i; j++)
-            {
-                acb_approx_mul(G, T + i, acb_mat_entry(A, i - 1, j), prec);
-                for (k = 0; k < i - 1; k++)
-                {
-                    acb_approx_mul(t, acb_mat_entry(A, i, k), acb_mat_entry(A, k, j), prec);
-                    acb_approx_add(G, G, t, prec);
-                }
-
-                acb_conj(t, T + i);
-                acb_approx_mul(t, G, t, prec);
-                acb_approx_sub(acb_mat_entry(A, i - 1, j), acb_mat_entry(A, i - 1, j), t, prec);
-                for (k = 0; k < i - 1; k++)
-                {
-                    acb_conj(t, acb_mat_entry(A, i, k));
-                    acb_approx_mul(t, G, t, prec);
-                    acb_approx_sub(acb_mat_entry(A, k, j), acb_mat_entry(A, k, j), t, prec);
-                }
-            }
+            acb_conj(Ti_conj, T + i);
+            work.Ti = T + i;
+            work.i = i;
+            flint_parallel_do((do_func_t) hessenberg_1_worker, &work, i,
+                approx_eig_thread_limit(i, i, prec), FLINT_PARALLEL_UNIFORM);
         }
 
         acb_one(acb_mat_entry(A, i, i));
@@ -540,213 +682,271 @@ acb_mat_approx_hessenberg_reduce_1(acb_mat_t A, acb_srcptr T, slong prec)
         }
     }
 
-    acb_clear(G);
-    acb_clear(t);
+    acb_clear(Ti_conj);
 }
 
-/* Right eigenvectors of a triu matrix. No aliasing. */
-void
-acb_mat_approx_eig_triu_r(acb_mat_t ER, const acb_mat_t A, slong prec)
+typedef struct
 {
-    slong i, j, k, n;
-    mag_t tm, smin, unfl, simin, smlnum, rmax;
-    acb_t r, s, t;
+    acb_mat_struct * E;
+    const acb_mat_struct * A;
+    mag_srcptr smlnum;
+    mag_srcptr simin;
+    slong prec;
+}
+eig_triu_work_t;
 
-    n = acb_mat_nrows(A);
+/* Computes row i of the transposed right eigenvector matrix. The rows
+   are independent: each one is rescaled on its own. */
+static void
+eig_triu_r_worker(slong i, eig_triu_work_t * work)
+{
+    acb_mat_struct * ER = work->E;
+    const acb_mat_struct * A = work->A;
+    slong j, k, prec = work->prec;
+    mag_t tm, smin, rmax;
+    acb_t r, s, t;
 
-    acb_mat_one(ER);
+    /* the first row is trivial */
+    i++;
 
     acb_init(r);
     acb_init(s);
     acb_init(t);
     mag_init(tm);
     mag_init(smin);
-    mag_init(smlnum);
-    mag_init(unfl);
-    mag_init(simin);
     mag_init(rmax);
 
-    mag_set_ui_2exp_si(unfl, 1, -30 * prec);
-    mag_mul_ui(smlnum, unfl, n);
-    mag_mul_2exp_si(smlnum, smlnum, prec);
-    mag_set_ui_2exp_si(simin, 1, prec / 2);
     mag_one(rmax);
 
-    for (i = 1; i < n; i++)
-    {
-        acb_set(s, acb_mat_entry(A, i, i));
-
-        /* smin = max(eps * abs(s), smlnum) */
-        acb_approx_mag(smin, s);
-        mag_mul_2exp_si(smin, smin, -prec);
-        mag_max(smin, smin, smlnum);
+    acb_set(s, acb_mat_entry(A, i, i));
 
-        for (j = i - 1; j >= 0; j--)
-        {
-            acb_approx_dot(r, NULL, 0, A->rows[j] + j + 1, 1, ER->rows[i] + j + 1, 1, i - j, prec);
-            acb_approx_sub(t, acb_mat_entry(A, j, j), s, prec);
-
-            /* if abs(t) < smin: t = smin */
-            acb_approx_mag(tm, t);
-            if (mag_cmp(tm, smin) < 0)
-            {
-                acb_zero(t);
-                arf_set_mag(arb_midref(acb_realref(t)), smin);
-            }
+    /* smin = max(eps * abs(s), smlnum) */
+    acb_approx_mag(smin, s);
+    mag_mul_2exp_si(smin, smin, -prec);
+    mag_max(smin, smin, work->smlnum);
 
-            acb_approx_div(acb_mat_entry(ER, i, j), r, t, prec);
-            acb_neg(acb_mat_entry(ER, i, j), acb_mat_entry(ER, i, j));
-
-            acb_approx_mag(tm, r);
-            mag_max(rmax, rmax, tm);
-            if (mag_cmp(rmax, simin) > 0)
-            {
-                arb_t b;
-                arb_init(b);
-                arf_set_mag(arb_midref(b), rmax);
-
-                for (k = j; k < i + 1; k++)
-                {
-                    acb_approx_div_arb(acb_mat_entry(ER, i, k),
-                        acb_mat_entry(ER, i, k), b, prec);
-                }
+    for (j = i - 1; j >= 0; j--)
+    {
+        acb_approx_dot(r, NULL, 0, A->rows[j] + j + 1, 1, ER->rows[i] + j + 1, 1, i - j, prec);
+        acb_approx_sub(t, acb_mat_entry(A, j, j), s, prec);
 
-                mag_one(rmax);
-                arb_clear(b);
-            }
+        /* if abs(t) < smin: t = smin */
+        acb_approx_mag(tm, t);
+        if (mag_cmp(tm, smin) < 0)
+        {
+            acb_zero(t);
+            arf_set_mag(arb_midref(acb_realref(t)), smin);
         }
 
-        if (mag_cmp_2exp_si(rmax, 0) != 0)
+        acb_approx_div(acb_mat_entry(ER, i, j), r, t, prec);
+        acb_neg(acb_mat_entry(ER, i, j), acb_mat_entry(ER, i, j));
+
+        acb_approx_mag(tm, r);
+        mag_max(rmax, rmax, tm);
+        if (mag_cmp(rmax, work->simin) > 0)
         {
             arb_t b;
             arb_init(b);
             arf_set_mag(arb_midref(b), rmax);
 
-            for (k = 0; k < i + 1; k++)
+            for (k = j; k < i + 1; k++)
             {
                 acb_approx_div_arb(acb_mat_entry(ER, i, k),
                     acb_mat_entry(ER, i, k), b, prec);
             }
 
+            mag_one(rmax);
             arb_clear(b);
         }
     }
 
-    acb_mat_transpose(ER, ER);
+    if (mag_cmp_2exp_si(rmax, 0) != 0)
+    {
+        arb_t b;
+        arb_init(b);
+        arf_set_mag(arb_midref(b), rmax);
+
+        for (k = 0; k < i + 1; k++)
+        {
+            acb_approx_div_arb(acb_mat_entry(ER, i, k),
+                acb_mat_entry(ER, i, k), b, prec);
+        }
+
+        arb_clear(b);
+    }
 
     acb_clear(r);
     acb_clear(s);
     acb_clear(t);
     mag_clear(tm);
     mag_clear(smin);
-    mag_clear(smlnum);
-    mag_clear(unfl);
-    mag_clear(simin);
     mag_clear(rmax);
 }
 
-/* Left eigenvectors of a triu matrix. No aliasing. */
-void
-acb_mat_approx_eig_triu_l(acb_mat_t EL, const acb_mat_t A, slong prec)
+/* Computes row i of the left eigenvector matrix, given the transpose
+   of the triu matrix. */
+static void
+eig_triu_l_worker(slong i, eig_triu_work_t * work)
 {
-    slong i, j, k, n;
-    mag_t tm, smin, unfl, simin, smlnum, rmax;
+    acb_mat_struct * EL = work->E;
+    const acb_mat_struct * AT = work->A;
+    slong j, k, n, prec = work->prec;
+    mag_t tm, smin, rmax;
     acb_t r, s, t;
-    acb_mat_t AT;
 
-    n = acb_mat_nrows(A);
-    acb_mat_init(AT, n, n);
-
-    acb_mat_one(EL);
-    acb_mat_transpose(AT, A);
+    n = acb_mat_nrows(AT);
 
     acb_init(r);
     acb_init(s);
     acb_init(t);
     mag_init(tm);
     mag_init(smin);
-    mag_init(smlnum);
-    mag_init(unfl);
-    mag_init(simin);
     mag_init(rmax);
 
-    mag_set_ui_2exp_si(unfl, 1, -30 * prec);
-    mag_mul_ui(smlnum, unfl, n);
-    mag_mul_2exp_si(smlnum, smlnum, prec);
-    mag_set_ui_2exp_si(simin, 1, prec / 2);
     mag_one(rmax);
 
-    for (i = 0; i < n - 1; i++)
-    {
-        acb_set(s, acb_mat_entry(AT, i, i));
-
-        /* smin = max(eps * abs(s), smlnum) */
-        acb_approx_mag(smin, s);
-        mag_mul_2exp_si(smin, smin, -prec);
-        mag_max(smin, smin, smlnum);
-
-        for (j = i + 1; j < n; j++)
-        {
-            acb_approx_dot(r, NULL, 0, EL->rows[i] + i, 1, AT->rows[j] + i, 1, j - i, prec);
-            acb_approx_sub(t, acb_mat_entry(AT, j, j), s, prec);
-
-            /* if abs(t) < smin: t = smin */
-            acb_approx_mag(tm, t);
-            if (mag_cmp(tm, smin) < 0)
-            {
-                acb_zero(t);
-                arf_set_mag(arb_midref(acb_realref(t)), smin);
-            }
+    acb_set(s, acb_mat_entry(AT, i, i));
 
-            acb_approx_div(acb_mat_entry(EL, i, j), r, t, prec);
-            acb_neg(acb_mat_entry(EL, i, j), acb_mat_entry(EL, i, j));
-
-            acb_approx_mag(tm, r);
-            mag_max(rmax, rmax, tm);
-            if (mag_cmp(rmax, simin) > 0)
-            {
-                arb_t b;
-                arb_init(b);
-                arf_set_mag(arb_midref(b), rmax);
+    /* smin = max(eps * abs(s), smlnum) */
+    acb_approx_mag(smin, s);
+    mag_mul_2exp_si(smin, smin, -prec);
+    mag_max(smin, smin, work->smlnum);
 
-                for (k = i; k < j + 1; k++)
-                {
-                    acb_approx_div_arb(acb_mat_entry(EL, i, k),
-                        acb_mat_entry(EL, i, k), b, prec);
-                }
+    for (j = i + 1; j < n; j++)
+    {
+        acb_approx_dot(r, NULL, 0, EL->rows[i] + i, 1, AT->rows[j] + i, 1, j - i, prec);
+        acb_approx_sub(t, acb_mat_entry(AT, j, j), s, prec);
 
-                mag_one(rmax);
-                arb_clear(b);
-            }
+        /* if abs(t) < smin: t = smin */
+        acb_approx_mag(tm, t);
+        if (mag_cmp(tm, smin) < 0)
+        {
+            acb_zero(t);
+            arf_set_mag(arb_midref(acb_realref(t)), smin);
         }
 
-        if (mag_cmp_2exp_si(rmax, 0) != 0)
+        acb_approx_div(acb_mat_entry(EL, i, j), r, t, prec);
+        acb_neg(acb_mat_entry(EL, i, j), acb_mat_entry(EL, i, j));
+
+        acb_approx_mag(tm, r);
+        mag_max(rmax, rmax, tm);
+        if (mag_cmp(rmax, work->simin) > 0)
         {
             arb_t b;
             arb_init(b);
             arf_set_mag(arb_midref(b), rmax);
 
-            for (k = i; k < n; k++)
+            for (k = i; k < j + 1; k++)
             {
                 acb_approx_div_arb(acb_mat_entry(EL, i, k),
                     acb_mat_entry(EL, i, k), b, prec);
             }
 
+            mag_one(rmax);
             arb_clear(b);
         }
     }
 
-    acb_mat_clear(AT);
+    if (mag_cmp_2exp_si(rmax, 0) != 0)
+    {
+        arb_t b;
+        arb_init(b);
+        arf_set_mag(arb_midref(b), rmax);
+
+        for (k = i; k < n; k++)
+        {
+            acb_approx_div_arb(acb_mat_entry(EL, i, k),
+                acb_mat_entry(EL, i, k), b, prec);
+        }
+
+        arb_clear(b);
+    }
 
     acb_clear(r);
     acb_clear(s);
     acb_clear(t);
     mag_clear(tm);
     mag_clear(smin);
+    mag_clear(rmax);
+}
+
+/* Right eigenvectors of a triu matrix. No aliasing. */
+void
+acb_mat_approx_eig_triu_r(acb_mat_t ER, const acb_mat_t A, slong prec)
+{
+    slong n;
+    mag_t unfl, simin, smlnum;
+    eig_triu_work_t work;
+
+    n = acb_mat_nrows(A);
+
+    acb_mat_one(ER);
+
+    mag_init(smlnum);
+    mag_init(unfl);
+    mag_init(simin);
+
+    mag_set_ui_2exp_si(unfl, 1, -30 * prec);
+    mag_mul_ui(smlnum, unfl, n);
+    mag_mul_2exp_si(smlnum, smlnum, prec);
+    mag_set_ui_2exp_si(simin, 1, prec / 2);
+
+    work.E = ER;
+    work.A = A;
+    work.smlnum = smlnum;
+    work.simin = simin;
+    work.prec = prec;
+
+    if (n > 1)
+        flint_parallel_do((do_func_t) eig_triu_r_worker, &work, n - 1,
+            approx_eig_thread_limit(n, n / 2, prec), FLINT_PARALLEL_STRIDED);
+
+    acb_mat_transpose(ER, ER);
+
+    mag_clear(smlnum);
+    mag_clear(unfl);
+    mag_clear(simin);
+}
+
+/* Left eigenvectors of a triu matrix. No aliasing. */
+void
+acb_mat_approx_eig_triu_l(acb_mat_t EL, const acb_mat_t A, slong prec)
+{
+    slong n;
+    mag_t unfl, simin, smlnum;
+    acb_mat_t AT;
+    eig_triu_work_t work;
+
+    n = acb_mat_nrows(A);
+    acb_mat_init(AT, n, n);
+
+    acb_mat_one(EL);
+    acb_mat_transpose(AT, A);
+
+    mag_init(smlnum);
+    mag_init(unfl);
+    mag_init(simin);
+
+    mag_set_ui_2exp_si(unfl, 1, -30 * prec);
+    mag_mul_ui(smlnum, unfl, n);
+    mag_mul_2exp_si(smlnum, smlnum, prec);
+    mag_set_ui_2exp_si(simin, 1, prec / 2);
+
+    work.E = EL;
+    work.A = AT;
+    work.smlnum = smlnum;
+    work.simin = simin;
+    work.prec = prec;
+
+    if (n > 1)
+        flint_parallel_do((do_func_t) eig_triu_l_worker, &work, n - 1,
+            approx_eig_thread_limit(n, n / 2, prec), FLINT_PARALLEL_STRIDED);
+
+    acb_mat_clear(AT);
+
     mag_clear(smlnum);
     mag_clear(unfl);
     mag_clear(simin);
-    mag_clear(rmax);
 }
 
 int
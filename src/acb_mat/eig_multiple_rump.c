@@ -9,8 +9,12 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb_mat.h"
 
+/* Use threads when n^3 prec is at least this large. */
+#define EIG_RUMP_THREAD_CUTOFF 1000000
+
 static void
 acb_approx_mag(mag_t res, const acb_t x)
 {
@@ -47,12 +51,53 @@ close(const acb_t x, const acb_t y, const mag_t eps)
     return result;
 }
 
+typedef struct
+{
+    acb_ptr F;
+    slong ** cluster;
+    const slong * cluster_size;
+    const acb_mat_struct * A;
+    acb_srcptr E_approx;
+    const acb_mat_struct * R_approx;
+    slong prec;
+    volatile int failed;
+}
+eig_multiple_rump_work_t;
+
+/* The enclosures of the individual clusters are independent; the
+   remaining clusters are skipped as soon as one of them fails. */
+static void
+eig_multiple_rump_worker(slong c, eig_multiple_rump_work_t * work)
+{
+    acb_mat_t X;
+    slong i, j, k, n;
+
+    if (work->failed)
+        return;
+
+    n = acb_mat_nrows(work->A);
+    k = work->cluster_size[c];
+
+    acb_mat_init(X, n, k);
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < k; j++)
+            acb_set(acb_mat_entry(X, i, j), acb_mat_entry(work->R_approx, i, work->cluster[c][j]));
+
+    acb_mat_eig_enclosure_rump(work->F + c, NULL, X, work->A, work->E_approx + work->cluster[c][0], X, work->prec);
+
+    if (!acb_is_finite(work->F + c))
+        work->failed = 1;
+
+    acb_mat_clear(X);
+}
+
 int
 acb_mat_eig_multiple_rump(acb_ptr E, const acb_mat_t A, acb_srcptr E_approx, const acb_mat_t R_approx, slong prec)
 {
-    slong c, i, j, k, n;
-    acb_mat_t X;
+    slong c, i, j, n, thread_limit;
     acb_ptr F;
+    eig_multiple_rump_work_t work;
     int result;
     slong iter;
     mag_t escale, eps, tm, um;
@@ -118,25 +163,27 @@ acb_mat_eig_multiple_rump(acb_ptr E, const acb_mat_t A, acb_srcptr E_approx, con
 
         F = _acb_vec_init(num_clusters);
 
-        for (c = 0; c < num_clusters && result; c++)
-        {
-            k = cluster_size[c];
-
-            acb_mat_init(X, n, k);
-
-            for (i = 0; i < n; i++)
-                for (j = 0; j < k; j++)
-                    acb_set(acb_mat_entry(X, i, j), acb_mat_entry(R_approx, i, cluster[c][j]));
+        work.F = F;
+        work.cluster = cluster;
+        work.cluster_size = cluster_size;
+        work.A = A;
+        work.E_approx = E_approx;
+        work.R_approx = R_approx;
+        work.prec = prec;
+        work.failed = 0;
 
-            acb_mat_eig_enclosure_rump(F + c, NULL, X, A, E_approx + cluster[c][0], X, prec);
+        /* each enclosure costs O(n^3) operations */
+        if ((double) n * n * n * FLINT_MAX(prec, 64) < EIG_RUMP_THREAD_CUTOFF)
+            thread_limit = 1;
+        else
+            thread_limit = flint_get_num_threads();
 
-            if (!acb_is_finite(F + c))
-                result = 0;
+        flint_parallel_do((do_func_t) eig_multiple_rump_worker, &work,
+            num_clusters, thread_limit, FLINT_PARALLEL_STRIDED);
 
-            acb_mat_clear(X);
-        }
+        result = !work.failed;
 
-        for (i = 0; i < num_clusters; i++)
+        for (i = 0; i < num_clusters && result; i++)
         {
             for (j = i + 1; j < num_clusters; j++)
             {
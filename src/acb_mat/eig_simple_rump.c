@@ -9,14 +9,82 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb_mat.h"
 
+/* Use threads when n^3 prec is at least this large. */
+#define EIG_RUMP_THREAD_CUTOFF 1000000
+
+typedef struct
+{
+    acb_ptr E;
+    acb_mat_struct * R2;
+    const acb_mat_struct * A;
+    acb_srcptr E_approx;
+    const acb_mat_struct * R_approx;
+    slong prec;
+    char * done;
+    volatile int failed;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+}
+eig_simple_rump_work_t;
+
+/* The enclosures of the individual eigenpairs are independent. Each
+   new enclosure is compared with those already computed, and the
+   remaining eigenpairs are skipped as soon as one of them fails. */
+static void
+eig_simple_rump_worker(slong i, eig_simple_rump_work_t * work)
+{
+    acb_mat_t X;
+    slong j, n;
+    int ok;
+
+    if (work->failed)
+        return;
+
+    n = acb_mat_nrows(work->A);
+
+    acb_mat_init(X, n, 1);
+
+    for (j = 0; j < n; j++)
+        acb_set(acb_mat_entry(X, j, 0), acb_mat_entry(work->R_approx, j, i));
+
+    acb_mat_eig_enclosure_rump(work->E + i, NULL, X, work->A, work->E_approx + i, X, work->prec);
+
+    for (j = 0; j < n; j++)
+        acb_set(acb_mat_entry(work->R2, j, i), acb_mat_entry(X, j, 0));
+
+    acb_mat_clear(X);
+
+#if FLINT_USES_PTHREAD
+    pthread_mutex_lock(&work->mutex);
+#endif
+
+    ok = acb_is_finite(work->E + i);
+
+    for (j = 0; j < n && ok; j++)
+        if (work->done[j] && acb_overlaps(work->E + i, work->E + j))
+            ok = 0;
+
+    work->done[i] = 1;
+
+    if (!ok)
+        work->failed = 1;
+
+#if FLINT_USES_PTHREAD
+    pthread_mutex_unlock(&work->mutex);
+#endif
+}
+
 int
 acb_mat_eig_simple_rump(acb_ptr E, acb_mat_t L, acb_mat_t R,
     const acb_mat_t A, acb_srcptr E_approx, const acb_mat_t R_approx, slong prec)
 {
-    slong i, j, n;
-    acb_mat_t X, R2;
+    slong n, thread_limit;
+    acb_mat_t R2;
+    eig_simple_rump_work_t work;
     int result;
 
     n = acb_mat_nrows(A);
@@ -34,28 +102,35 @@ acb_mat_eig_simple_rump(acb_ptr E, acb_mat_t L, acb_mat_t R,
         return 1;
     }
 
-    acb_mat_init(X, n, 1);
     acb_mat_init(R2, n, n);
 
-    result = 1;
-
-    for (i = 0; i < n && result; i++)
-    {
-        for (j = 0; j < n; j++)
-            acb_set(acb_mat_entry(X, j, 0), acb_mat_entry(R_approx, j, i));
-
-        acb_mat_eig_enclosure_rump(E + i, NULL, X, A, E_approx + i, X, prec);
-
-        if (!acb_is_finite(E + i))
-            result = 0;
-
-        for (j = 0; j < i; j++)
-            if (acb_overlaps(E + i, E + j))
-                result = 0;
-
-        for (j = 0; j < n; j++)
-            acb_set(acb_mat_entry(R2, j, i), acb_mat_entry(X, j, 0));
-    }
+    work.E = E;
+    work.R2 = R2;
+    work.A = A;
+    work.E_approx = E_approx;
+    work.R_approx = R_approx;
+    work.prec = prec;
+    work.done = flint_calloc(n, sizeof(char));
+    work.failed = 0;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_init(&work.mutex, NULL);
+#endif
+
+    /* each enclosure costs O(n^3) operations */
+    if ((double) n * n * n * FLINT_MAX(prec, 64) < EIG_RUMP_THREAD_CUTOFF)
+        thread_limit = 1;
+    else
+        thread_limit = flint_get_num_threads();
+
+    flint_parallel_do((do_func_t) eig_simple_rump_worker, &work, n,
+        thread_limit, FLINT_PARALLEL_STRIDED);
+
+    result = !work.failed;
+
+    flint_free(work.done);
+#if FLINT_USES_PTHREAD
+    pthread_mutex_destroy(&work.mutex);
+#endif
 
     if (R != NULL)
     {
@@ -74,7 +149,6 @@ acb_mat_eig_simple_rump(acb_ptr E, acb_mat_t L, acb_mat_t R,
     if (!result)
         _acb_vec_indeterminate(E, n);
 
-    acb_mat_clear(X);
     acb_mat_clear(R2);
 
     return result;
@@ -31,9 +31,11 @@ int main(void)
         slong i, j, n, prec, goal, c0, c1, c2, c3;
         int wantL, wantR, result, dft;
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         dft = n_randint(state, 2);
         if (dft)
-            n = n_randint(state, 30);
+            n = n_randint(state, n_randint(state, 8) == 0 ? 60 : 30);
         else
             n = n_randint(state, 15);
         goal = 2 + n_randint(state, 100);
@@ -188,7 +190,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -154,6 +154,8 @@ int main(void)
         slong prec;
         int algorithm, result;
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         n = n_randint(state, 30);
         algorithm = n_randint(state, 2);
         acb_mat_init(A, n, n);
@@ -233,7 +235,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -189,6 +189,8 @@ int main(void)
         slong i, j, n, prec, count, count2;
         int algorithm, success;
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         algorithm = n_randint(state, 3);
         n = n_randint(state, 10);
         roots = _acb_vec_init(n);
@@ -299,7 +301,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -13,6 +13,14 @@
 #include "fmpq.h"
 #include "acb_poly.h"
 
+/* Use the Aberth iteration (whose steps can be parallelized) instead
+   of the sequential Durand-Kerner iteration from this degree, when the
+   steps are expensive enough to be worth running in parallel. The choice
+   does not depend on the number of threads, so that the output does not
+   either. */
+#define ABERTH_CUTOFF 24
+#define ABERTH_WORK_CUTOFF 100000
+
 slong
 _acb_get_mid_mag(const acb_t z)
 {
@@ -76,6 +84,7 @@ _acb_poly_find_roots(acb_ptr roots,
 {
     slong iter, i, deg;
     slong rootmag, max_rootmag, correction, max_correction;
+    acb_ptr deriv;
 
     deg = len - 1;
 
@@ -109,6 +118,16 @@ _acb_poly_find_roots(acb_ptr roots,
     if (maxiter == 0)
         maxiter = 2 * deg + n_sqrt(prec);
 
+    if (deg >= ABERTH_CUTOFF && deg * deg * FLINT_MAX(prec, 64) >= ABERTH_WORK_CUTOFF)
+    {
+        deriv = _acb_vec_init(deg);
+        _acb_poly_derivative(deriv, poly, len, prec);
+    }
+    else
+    {
+        deriv = NULL;
+    }
+
     for (iter = 0; iter < maxiter; iter++)
     {
         max_rootmag = -ARF_PREC_EXACT;
@@ -118,7 +137,10 @@ _acb_poly_find_roots(acb_ptr roots,
             max_rootmag = FLINT_MAX(rootmag, max_rootmag);
         }
 
-        _acb_poly_refine_roots_durand_kerner(roots, poly, len, prec);
+        if (deriv != NULL)
+            _acb_poly_refine_roots_aberth(roots, poly, deriv, len, prec);
+        else
+            _acb_poly_refine_roots_durand_kerner(roots, poly, len, prec);
 
         max_correction = -ARF_PREC_EXACT;
         for (i = 0; i < deg; i++)
@@ -140,6 +162,9 @@ _acb_poly_find_roots(acb_ptr roots,
             maxiter = FLINT_MIN(maxiter, iter + 4);
     }
 
+    if (deriv != NULL)
+        _acb_vec_clear(deriv, deg);
+
     return _acb_poly_validate_roots(roots, poly, len, prec);
 }
 
@@ -0,0 +1,96 @@
+/*
+    Copyright (C) 2012 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACB_POLY_IMPL_H
+#define ACB_POLY_IMPL_H
+
+#include "acb_poly.h"
+
+/* the root refinement functions don't need any error bounding, so we
+   define a few helper functions that ignore the radii */
+
+static __inline__ void
+acb_sub_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_sub(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_sub(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_add_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_add(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_add(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_mul_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+#define a arb_midref(acb_realref(x))
+#define b arb_midref(acb_imagref(x))
+#define c arb_midref(acb_realref(y))
+#define d arb_midref(acb_imagref(y))
+#define e arb_midref(acb_realref(z))
+#define f arb_midref(acb_imagref(z))
+
+    arf_complex_mul(e, f, a, b, c, d, prec, ARF_RND_DOWN);
+
+#undef a
+#undef b
+#undef c
+#undef d
+#undef e
+#undef f
+}
+
+static __inline__ int
+acb_is_zero_mid(const acb_t x)
+{
+    return arf_is_zero(arb_midref(acb_realref(x))) &&
+           arf_is_zero(arb_midref(acb_imagref(x)));
+}
+
+static __inline__ void
+acb_inv_mid(acb_t z, const acb_t x, slong prec)
+{
+    arf_t t;
+    arf_init(t);
+
+#define a arb_midref(acb_realref(x))
+#define b arb_midref(acb_imagref(x))
+#define e arb_midref(acb_realref(z))
+#define f arb_midref(acb_imagref(z))
+
+    arf_mul(t, a, a, prec, ARF_RND_DOWN);
+    arf_addmul(t, b, b, prec, ARF_RND_DOWN);
+
+    arf_div(e, a, t, prec, ARF_RND_DOWN);
+    arf_div(f, b, t, prec, ARF_RND_DOWN);
+
+    arf_neg(f, f);
+
+#undef a
+#undef b
+#undef e
+#undef f
+
+    arf_clear(t);
+}
+
+#endif
@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "acb_poly.h"
+#include "impl.h"
+
+typedef struct
+{
+    acb_srcptr roots;
+    acb_ptr corr;
+    acb_srcptr poly;
+    acb_srcptr deriv;
+    slong len;
+    slong prec;
+}
+aberth_work_t;
+
+/* Computes the Aberth correction
+   w_i = 1 / (f'(z_i) / f(z_i) - sum_{j != i} 1 / (z_i - z_j)). */
+static void
+aberth_worker(slong i, aberth_work_t * work)
+{
+    acb_srcptr roots = work->roots;
+    slong j, len = work->len, prec = work->prec;
+    acb_ptr w = work->corr + i;
+    acb_t x, y, s, t;
+
+    acb_init(x);
+    acb_init(y);
+    acb_init(s);
+    acb_init(t);
+
+    _acb_poly_evaluate_mid(x, work->poly, len, roots + i, prec);
+
+    /* exact root */
+    if (acb_is_zero_mid(x))
+    {
+        acb_zero(w);
+    }
+    else
+    {
+        _acb_poly_evaluate_mid(y, work->deriv, len - 1, roots + i, prec);
+
+        acb_inv_mid(x, x, prec);
+        acb_mul_mid(y, y, x, prec);
+
+        for (j = 0; j < len - 1; j++)
+        {
+            if (i != j)
+            {
+                acb_sub_mid(t, roots + i, roots + j, prec);
+
+                /* coinciding approximations; the other terms
+                   will separate them */
+                if (acb_is_zero_mid(t))
+                    continue;
+
+                acb_inv_mid(t, t, prec);
+                acb_add_mid(s, s, t, prec);
+            }
+        }
+
+        acb_sub_mid(y, y, s, prec);
+
+        if (acb_is_zero_mid(y))
+            acb_zero(w);
+        else
+            acb_inv_mid(w, y, prec);
+    }
+
+    acb_clear(x);
+    acb_clear(y);
+    acb_clear(s);
+    acb_clear(t);
+}
+
+void
+_acb_poly_refine_roots_aberth(acb_ptr roots,
+        acb_srcptr poly, acb_srcptr deriv, slong len, slong prec)
+{
+    aberth_work_t work;
+    acb_ptr corr;
+    slong i, deg, thread_limit;
+
+    deg = len - 1;
+
+    if (deg <= 0)
+        return;
+
+    corr = _acb_vec_init(deg);
+
+    work.roots = roots;
+    work.corr = corr;
+    work.poly = poly;
+    work.deriv = deriv;
+    work.len = len;
+    work.prec = prec;
+
+    /* each correction costs O(deg) multiplications */
+    if (deg * deg * FLINT_MAX(prec, 64) < 100000)
+        thread_limit = 1;
+    else
+        thread_limit = -1;
+
+    flint_parallel_do((do_func_t) aberth_worker, &work, deg,
+        thread_limit, FLINT_PARALLEL_UNIFORM);
+
+    for (i = 0; i < deg; i++)
+    {
+        acb_sub_mid(roots + i, roots + i, corr + i, prec);
+
+        arf_get_mag(arb_radref(acb_realref(roots + i)), arb_midref(acb_realref(corr + i)));
+        arf_get_mag(arb_radref(acb_imagref(roots + i)), arb_midref(acb_imagref(corr + i)));
+    }
+
+    _acb_vec_clear(corr, deg);
+}
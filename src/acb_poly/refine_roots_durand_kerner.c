@@ -10,78 +10,7 @@
 */
 
 #include "acb_poly.h"
-
-/* we don't need any error bounding, so we define a few helper
-   functions that ignore the radii */
-
-static __inline__ void
-acb_sub_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
-{
-    arf_sub(arb_midref(acb_realref(z)),
-        arb_midref(acb_realref(x)),
-        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
-    arf_sub(arb_midref(acb_imagref(z)),
-        arb_midref(acb_imagref(x)),
-        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
-}
-
-static __inline__ void
-acb_add_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
-{
-    arf_add(arb_midref(acb_realref(z)),
-        arb_midref(acb_realref(x)),
-        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
-    arf_add(arb_midref(acb_imagref(z)),
-        arb_midref(acb_imagref(x)),
-        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
-}
-
-static __inline__ void
-acb_mul_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
-{
-#define a arb_midref(acb_realref(x))
-#define b arb_midref(acb_imagref(x))
-#define c arb_midref(acb_realref(y))
-#define d arb_midref(acb_imagref(y))
-#define e arb_midref(acb_realref(z))
-#define f arb_midref(acb_imagref(z))
-
-    arf_complex_mul(e, f, a, b, c, d, prec, ARF_RND_DOWN);
-
-#undef a
-#undef b
-#undef c
-#undef d
-#undef e
-#undef f
-}
-
-static __inline__ void
-acb_inv_mid(acb_t z, const acb_t x, slong prec)
-{
-    arf_t t;
-    arf_init(t);
-
-#define a arb_midref(acb_realref(x))
-#define b arb_midref(acb_imagref(x))
-#define e arb_midref(acb_realref(z))
-#define f arb_midref(acb_imagref(z))
-
-    arf_mul(t, a, a, prec, ARF_RND_DOWN);
-    arf_addmul(t, b, b, prec, ARF_RND_DOWN);
-
-    arf_div(e, a, t, prec, ARF_RND_DOWN);
-    arf_div(f, b, t, prec, ARF_RND_DOWN);
-
-    arf_neg(f, f);
-
-#undef a
-#undef b
-#undef e
-#undef f
-
-    arf_clear(t);
-}
+#include "impl.h"
 
 void
 _acb_poly_evaluate_mid(acb_t res, acb_srcptr f, slong len,
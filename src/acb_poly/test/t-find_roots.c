@@ -28,17 +28,24 @@ int main(void)
         acb_poly_t B;
         acb_poly_t C;
         acb_t t;
-        acb_ptr roots;
-        slong i, deg, isolated;
+        acb_ptr roots, roots2;
+        slong i, deg, isolated, isolated2;
+        int result;
         slong prec = 10 + n_randint(state, 400);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         acb_init(t);
         acb_poly_init(A);
         acb_poly_init(B);
         acb_poly_init(C);
 
         do {
-            acb_poly_randtest(A, state, 2 + n_randint(state, 15), prec, 5);
+            /* occasionally exercise the Aberth iteration */
+            if (n_randint(state, 10) == 0)
+                acb_poly_randtest(A, state, 2 + n_randint(state, 60), prec, 5);
+            else
+                acb_poly_randtest(A, state, 2 + n_randint(state, 15), prec, 5);
         } while (A->length == 0);
         deg = A->length - 1;
 
@@ -46,6 +53,25 @@ int main(void)
 
         isolated = acb_poly_find_roots(roots, A, NULL, 0, prec);
 
+        /* the output does not depend on the number of threads */
+        roots2 = _acb_vec_init(deg);
+        flint_set_num_threads(1 + n_randint(state, 4));
+        isolated2 = acb_poly_find_roots(roots2, A, NULL, 0, prec);
+
+        result = (isolated2 == isolated);
+        for (i = 0; i < deg && result; i++)
+            result = acb_equal(roots + i, roots2 + i);
+
+        if (!result)
+        {
+            flint_printf("FAIL: depends on the number of threads\n");
+            acb_poly_printd(A, 15); flint_printf("\n\n");
+            flint_printf("isolated = %wd, %wd\n\n", isolated, isolated2);
+            flint_abort();
+        }
+
+        _acb_vec_clear(roots2, deg);
+
         if (isolated == deg)
         {
             acb_poly_fit_length(B, 1);
@@ -92,7 +118,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -10,6 +10,7 @@
 */
 
 #include <stdlib.h>
+#include "thread_support.h"
 #include "acb_poly.h"
 
 #ifndef __compar_fn_t
@@ -30,6 +31,35 @@ void _arb_vec_sort_mid(arb_ptr vec, slong len)
     qsort(vec, len, sizeof(arb_struct), (__compar_fn_t) arb_cmp_mid);
 }
 
+typedef struct
+{
+    arb_ptr points;
+    int * signs;
+    acb_srcptr poly;
+    slong len;
+    slong prec;
+}
+real_roots_work_t;
+
+static void
+real_roots_sign_worker(slong i, real_roots_work_t * work)
+{
+    acb_t t;
+    acb_init(t);
+
+    arb_set(acb_realref(t), work->points + i);
+    _acb_poly_evaluate(t, work->poly, work->len, t, work->prec);
+
+    if (arb_is_positive(acb_realref(t)))
+        work->signs[i] = 1;
+    else if (arb_is_negative(acb_realref(t)))
+        work->signs[i] = -1;
+    else
+        work->signs[i] = 0;
+
+    acb_clear(t);
+}
+
 int
 _acb_poly_validate_real_roots(acb_srcptr roots, acb_srcptr poly, slong len, slong prec)
 {
@@ -66,9 +96,12 @@ _acb_poly_validate_real_roots(acb_srcptr roots, acb_srcptr poly, slong len, slon
     else if (num_real > 0)
     {
         int sign_neg_inf, sign_pos_inf, prev_sign;
+        real_roots_work_t work;
+        arb_ptr points;
+        int * signs;
 
-        acb_t t;
-        acb_init(t);
+        points = _arb_vec_init(num_real);
+        signs = flint_malloc(sizeof(int) * num_real);
 
         /* by assumption that the roots are real and isolated, the lead
            coefficient really must be known to be either positive or negative */
@@ -78,42 +111,47 @@ _acb_poly_validate_real_roots(acb_srcptr roots, acb_srcptr poly, slong len, slon
         /* now we check that there's a sign change between each root */
         _arb_vec_sort_mid(real, num_real);
 
-        prev_sign = sign_neg_inf;
-
         for (i = 0; i < num_real - 1; i++)
         {
             /* set t to the midpoint between the midpoints */
-            arb_zero(acb_imagref(t));
-            arf_add(arb_midref(acb_realref(t)),
+            arf_add(arb_midref(points + i),
                 arb_midref(real + i), arb_midref(real + i + 1), prec, ARF_RND_DOWN);
-            arf_mul_2exp_si(arb_midref(acb_realref(t)), arb_midref(acb_realref(t)), -1);
-            mag_zero(arb_radref(acb_realref(t)));
+            arf_mul_2exp_si(arb_midref(points + i), arb_midref(points + i), -1);
 
             /* check that this point really is between both intervals (one interval
                could be much wider than the other */
-            if (arb_lt(real + i, acb_realref(t)) && arb_lt(acb_realref(t), real + i + 1))
+            if (!arb_lt(real + i, points + i) || !arb_lt(points + i, real + i + 1))
             {
-                /* check sign change */
-                _acb_poly_evaluate(t, poly, len, t, prec);
+                result = 0;
+                break;
+            }
+        }
 
-                if (prev_sign == 1)
-                    result = arb_is_negative(acb_realref(t));
-                else
-                    result = arb_is_positive(acb_realref(t));
+        /* check sign changes; the evaluations are independent */
+        if (result && num_real > 1)
+        {
+            work.points = points;
+            work.signs = signs;
+            work.poly = poly;
+            work.len = len;
+            work.prec = prec;
 
-                if (!result)
-                    break;
+            flint_parallel_do((do_func_t) real_roots_sign_worker, &work,
+                num_real - 1,
+                ((num_real - 1) * len * FLINT_MAX(prec, 64) < 100000) ? 1 : -1,
+                FLINT_PARALLEL_UNIFORM);
 
-                prev_sign = -prev_sign;
-            }
-            else
+            prev_sign = sign_neg_inf;
+
+            for (i = 0; i < num_real - 1 && result; i++)
             {
-                result = 0;
-                break;
+                result = (signs[i] == -prev_sign);
+                prev_sign = -prev_sign;
             }
         }
 
-        acb_clear(t);
+        _arb_vec_clear(points, num_real);
+        flint_free(signs);
     }
 
     _arb_vec_clear(real, deg);
@@ -9,8 +9,26 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb_poly.h"
 
+typedef struct
+{
+    acb_ptr roots;
+    acb_srcptr poly;
+    acb_srcptr deriv;
+    slong len;
+    slong prec;
+}
+validate_roots_work_t;
+
+static void
+validate_roots_worker(slong i, validate_roots_work_t * work)
+{
+    _acb_poly_root_inclusion(work->roots + i, work->roots + i,
+        work->poly, work->deriv, work->len, work->prec);
+}
+
 slong
 _acb_poly_validate_roots(acb_ptr roots,
         acb_srcptr poly, slong len, slong prec)
@@ -20,6 +38,7 @@ _acb_poly_validate_roots(acb_ptr roots,
     acb_ptr deriv;
     acb_ptr tmp;
     int *overlap;
+    validate_roots_work_t work;
 
     deg = len - 1;
 
@@ -30,11 +49,15 @@ _acb_poly_validate_roots(acb_ptr roots,
     _acb_poly_derivative(deriv, poly, len, prec);
 
     /* compute an inclusion interval for each point */
-    for (i = 0; i < deg; i++)
-    {
-        _acb_poly_root_inclusion(roots + i, roots + i,
-            poly, deriv, len, prec);
-    }
+    work.roots = roots;
+    work.poly = poly;
+    work.deriv = deriv;
+    work.len = len;
+    work.prec = prec;
+
+    flint_parallel_do((do_func_t) validate_roots_worker, &work, deg,
+        (deg * deg * FLINT_MAX(prec, 64) < 100000) ? 1 : -1,
+        FLINT_PARALLEL_UNIFORM);
 
     /* find which points do not overlap with any other points */
     for (i = 0; i < deg; i++)
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz.h"
 #include "aprcl.h"
 
@@ -149,11 +150,76 @@ _aprcl_is_gausspower_from_unity_p(ulong q, ulong r, const fmpz_t n)
     return result;
 }
 
+typedef struct
+{
+    ulong q;
+    ulong r;
+    slong unity_power;
+    int done;
+}
+gauss_pair_t;
+
+typedef struct
+{
+    const fmpz * n;
+    gauss_pair_t * pairs;
+    int composite;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+}
+gauss_work_t;
+
+static void
+_aprcl_is_prime_gauss_worker(slong i, gauss_work_t * work)
+{
+    int composite;
+    gauss_pair_t * pair = work->pairs + i;
+
+    /* once some pair shows that n is composite the rest can be skipped */
+#if FLINT_USES_PTHREAD
+    pthread_mutex_lock(&work->mutex);
+#endif
+    composite = work->composite;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_unlock(&work->mutex);
+#endif
+
+    if (composite)
+        return;
+
+    /*
+        if gcd(q*r, n) != 1 then n is composite; otherwise, if exists z
+        such that \tau(\chi^n) = \zeta_r^z*\tau^n(\chi) unity_power = z;
+        otherwise unity_power = -1
+    */
+    if (aprcl_is_mul_coprime_ui_ui(pair->q, pair->r, work->n) == 0)
+        pair->unity_power = -1;
+    else
+        pair->unity_power = _aprcl_is_gausspower_from_unity_p(pair->q, pair->r, work->n);
+
+    pair->done = 1;
+
+    if (pair->unity_power < 0)
+    {
+#if FLINT_USES_PTHREAD
+        pthread_mutex_lock(&work->mutex);
+#endif
+        work->composite = 1;
+#if FLINT_USES_PTHREAD
+        pthread_mutex_unlock(&work->mutex);
+#endif
+    }
+}
+
 primality_test_status
 _aprcl_is_prime_gauss(const fmpz_t n, const aprcl_config config)
 {
     int *lambdas;
     ulong i, j, k, nmod4;
+    slong num, t;
+    gauss_pair_t * pairs = NULL;
+    gauss_work_t work;
     primality_test_status result;
 
     /*
@@ -173,8 +239,67 @@ _aprcl_is_prime_gauss(const fmpz_t n, const aprcl_config config)
     /* nmod4 = n % 4 */
     nmod4 = fmpz_tdiv_ui(n, 4);
 
-    /* for every prime q | s */
+    /* n == q, q - prime => n - prime */
     for (i = 0; i < config->qs->num; i++)
+    {
+        if (fmpz_equal(n, config->qs->p + i))
+        {
+            result = PRIME;
+            break;
+        }
+    }
+
+    /*
+        The Gauss sum powers for the pairs (q, r) with prime q | s and
+        prime power r | q - 1 are independent; compute them in parallel.
+    */
+    if (result == PROBABPRIME)
+    {
+        num = 0;
+        for (i = 0; i < config->qs->num; i++)
+            num += FLINT_BIT_COUNT(fmpz_get_ui(config->qs->p + i));
+
+        pairs = flint_malloc(sizeof(gauss_pair_t) * FLINT_MAX(num, 1));
+
+        num = 0;
+        for (i = 0; i < config->qs->num; i++)
+        {
+            n_factor_t q_factors;
+            ulong q = fmpz_get_ui(config->qs->p + i);
+
+            n_factor_init(&q_factors);
+            n_factor(&q_factors, q - 1, 1);
+
+            for (j = 0; j < q_factors.num; j++)
+            {
+                for (k = 1; k <= q_factors.exp[j]; k++)
+                {
+                    pairs[num].q = q;
+                    pairs[num].r = n_pow(q_factors.p[j], k);
+                    pairs[num].done = 0;
+                    num++;
+                }
+            }
+        }
+
+        work.n = n;
+        work.pairs = pairs;
+        work.composite = 0;
+#if FLINT_USES_PTHREAD
+        pthread_mutex_init(&work.mutex, NULL);
+#endif
+
+        flint_parallel_do((do_func_t) _aprcl_is_prime_gauss_worker, &work,
+                                        num, -1, FLINT_PARALLEL_STRIDED);
+
+#if FLINT_USES_PTHREAD
+        pthread_mutex_destroy(&work.mutex);
+#endif
+    }
+
+    /* for every prime q | s */
+    t = 0;
+    for (i = 0; i < config->qs->num && result == PROBABPRIME; i++)
     {
         n_factor_t q_factors;
         ulong q;
@@ -182,13 +307,6 @@ _aprcl_is_prime_gauss(const fmpz_t n, const aprcl_config config)
 
         q = fmpz_get_ui(config->qs->p + i);
 
-        /* n == q, q - prime => n - prime */
-        if (fmpz_equal_ui(n, q))
-        {
-            result = PRIME;
-            break;
-        }
-
         /* find prime factors of q - 1 */
         n_factor_init(&q_factors);
         n_factor(&q_factors, q - 1, 1);
@@ -253,18 +371,15 @@ _aprcl_is_prime_gauss(const fmpz_t n, const aprcl_config config)
                 /* r = p^k */
                 r = n_pow(p, k);
 
-                /* if gcd(q*r, n) != 1 */
-                if (aprcl_is_mul_coprime_ui_ui(q, r, n) == 0)
+                /* pairs are only skipped once n is known to be composite */
+                if (!pairs[t].done)
                 {
-                    result = COMPOSITE;
-                    break;
+                    t++;
+                    continue;
                 }
 
-                /*
-                    if exists z such that \tau(\chi^n) = \zeta_r^z*\tau^n(\chi)
-                    unity_power = z; otherwise unity_power = -1
-                */
-                unity_power = _aprcl_is_gausspower_from_unity_p(q, r, n);
+                unity_power = pairs[t].unity_power;
+                t++;
 
                 /* if unity_power < 0 then n is composite */
                 if (unity_power < 0)
@@ -349,6 +464,7 @@ _aprcl_is_prime_gauss(const fmpz_t n, const aprcl_config config)
     }
 
     flint_free(lambdas);
+    flint_free(pairs);
 
     return result;
 }
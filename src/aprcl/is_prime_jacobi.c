@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz.h"
 #include "fmpz_mod.h"
 #include "aprcl.h"
@@ -537,13 +538,126 @@ _aprcl_is_prime_jacobi_additional_test(const fmpz_t n, ulong p)
     return result;
 }
 
+/*
+    Computes h for the pair (p, q), where p^k is the largest power of p
+    dividing q - 1, using the check matching p and k; h < 0 means that
+    n is composite.
+*/
+static slong
+_aprcl_is_prime_jacobi_pair(const fmpz_t n, ulong q, ulong p, ulong k)
+{
+    slong h;
+    ulong v, r;
+    fmpz_t u;
+    unity_zp jacobi_sum, jacobi_sum2_1, jacobi_sum2_2;
+
+    if (p == 2 && k == 1)
+        return _aprcl_is_prime_jacobi_check_21(q, n);
+
+    r = n_pow(p, k);        /* set r = p^k */
+
+    /* compute u = n / r and v = n % r */
+    fmpz_init(u);
+    fmpz_tdiv_q_ui(u, n, r);
+    v = fmpz_tdiv_ui(n, r);
+
+    /* compute set jacobi_sum = J(p, q) */
+    unity_zp_init(jacobi_sum, p, k, n);
+    unity_zp_jacobi_sum_pq(jacobi_sum, q, p);
+
+    if (p == 2 && k == 2)
+    {
+        h = _aprcl_is_prime_jacobi_check_22(jacobi_sum, u, v, q);
+    }
+    else if (p == 2)
+    {
+        /* if p == 2 and k >= 3 we also need to compute J_2(q) and J_3(q) */
+        unity_zp_init(jacobi_sum2_1, p, k, n);
+        unity_zp_init(jacobi_sum2_2, p, k, n);
+
+        /* compute J_3(q) */
+        unity_zp_jacobi_sum_2q_one(jacobi_sum2_1, q);
+        /* compute J_2(q) */
+        unity_zp_jacobi_sum_2q_two(jacobi_sum2_2, q);
+
+        h = _aprcl_is_prime_jacobi_check_2k(jacobi_sum,
+                jacobi_sum2_1, jacobi_sum2_2, u, v);
+
+        unity_zp_clear(jacobi_sum2_1);
+        unity_zp_clear(jacobi_sum2_2);
+    }
+    else
+    {
+        h = _aprcl_is_prime_jacobi_check_pk(jacobi_sum, u, v);
+    }
+
+    unity_zp_clear(jacobi_sum);
+    fmpz_clear(u);
+
+    return h;
+}
+
+typedef struct
+{
+    ulong q;
+    ulong p;
+    ulong k;
+    slong h;
+    int done;
+}
+jacobi_pair_t;
+
+typedef struct
+{
+    const fmpz * n;
+    jacobi_pair_t * pairs;
+    int composite;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+}
+jacobi_work_t;
+
+static void
+_aprcl_is_prime_jacobi_worker(slong i, jacobi_work_t * work)
+{
+    int composite;
+    jacobi_pair_t * pair = work->pairs + i;
+
+    /* once some pair shows that n is composite the rest can be skipped */
+#if FLINT_USES_PTHREAD
+    pthread_mutex_lock(&work->mutex);
+#endif
+    composite = work->composite;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_unlock(&work->mutex);
+#endif
+
+    if (composite)
+        return;
+
+    pair->h = _aprcl_is_prime_jacobi_pair(work->n, pair->q, pair->p, pair->k);
+    pair->done = 1;
+
+    if (pair->h < 0)
+    {
+#if FLINT_USES_PTHREAD
+        pthread_mutex_lock(&work->mutex);
+#endif
+        work->composite = 1;
+#if FLINT_USES_PTHREAD
+        pthread_mutex_unlock(&work->mutex);
+#endif
+    }
+}
+
 primality_test_status
 _aprcl_is_prime_jacobi(const fmpz_t n, const aprcl_config config)
 {
     int *lambdas;
     ulong i, j, nmod4;
     primality_test_status result;
-    fmpz_t temp, p2, ndec, ndecdiv, u, q_pow;
+    fmpz_t temp, p2, ndec, ndecdiv, q_pow;
 
     /* deal with primes that can divide R */
     if (fmpz_cmp_ui(n, 2) == 0)
@@ -554,7 +668,6 @@ _aprcl_is_prime_jacobi(const fmpz_t n, const aprcl_config config)
 
     /* initialization */
     fmpz_init(q_pow);
-    fmpz_init(u);
     fmpz_init(temp);
     fmpz_init(p2);
     fmpz_init(ndecdiv);
@@ -603,80 +716,97 @@ _aprcl_is_prime_jacobi(const fmpz_t n, const aprcl_config config)
         result = COMPOSITE;
 
     /* Begin pseudoprime tests with Jacobi sums step. */
-    /* for every prime q | s */
-    for (i = 0; i < config->qs->num; i++)
+
+    /* if n == q; q - prime => n - prime */
+    for (i = 0; i < config->qs->num && result != COMPOSITE; i++)
     {
-        n_factor_t q_factors;
-        ulong q;
+        if (config->qs_used[i] != 0 && fmpz_equal(n, config->qs->p + i))
+        {
+            result = PRIME;
+            break;
+        }
+    }
 
-        if (config->qs_used[i] == 0)
-            continue;
+    if (result == PROBABPRIME)
+    {
+        slong num, t;
+        jacobi_pair_t * pairs;
+        jacobi_work_t work;
 
-        if (result == COMPOSITE)
-            break;
+        /* collect every pair (p, q) with prime q | s and prime p | q - 1 */
+        num = 0;
+        for (i = 0; i < config->qs->num; i++)
+            if (config->qs_used[i] != 0)
+                num += FLINT_MAX_FACTORS_IN_LIMB;
 
-        q = fmpz_get_ui(config->qs->p + i); /* set q; q must get into ulong */
+        pairs = flint_malloc(sizeof(jacobi_pair_t) * FLINT_MAX(num, 1));
 
-        /* if n == q; q - prime => n - prime */
-        if (fmpz_equal_ui(n, q))
+        num = 0;
+        for (i = 0; i < config->qs->num; i++)
         {
-            result = PRIME;
-            break;
+            n_factor_t q_factors;
+            ulong q;
+
+            if (config->qs_used[i] == 0)
+                continue;
+
+            q = fmpz_get_ui(config->qs->p + i); /* set q; q must get into ulong */
+
+            /* find prime factors of q - 1 */
+            n_factor_init(&q_factors);
+            n_factor(&q_factors, q - 1, 1);
+
+            for (j = 0; j < q_factors.num; j++)
+            {
+                pairs[num].q = q;
+                pairs[num].p = q_factors.p[j];
+                pairs[num].k = q_factors.exp[j];
+                pairs[num].done = 0;
+                num++;
+            }
         }
 
-        /* find prime factors of q - 1 */
-        n_factor_init(&q_factors);
-        n_factor(&q_factors, q - 1, 1);
+        /* the pairs are independent; compute h for each of them */
+        work.n = n;
+        work.pairs = pairs;
+        work.composite = 0;
+#if FLINT_USES_PTHREAD
+        pthread_mutex_init(&work.mutex, NULL);
+#endif
 
-        /* for every prime p | q - 1 */
-        for (j = 0; j < q_factors.num; j++)
+        flint_parallel_do((do_func_t) _aprcl_is_prime_jacobi_worker, &work,
+                                        num, -1, FLINT_PARALLEL_STRIDED);
+
+#if FLINT_USES_PTHREAD
+        pthread_mutex_destroy(&work.mutex);
+#endif
+
+        /* check the pairs in order */
+        for (t = 0; t < num; t++)
         {
             int pind;
             slong h;
-            ulong v, p, r, k;
-            unity_zp jacobi_sum, jacobi_sum2_1, jacobi_sum2_2;
+            ulong p, q, k;
 
-            if (result == COMPOSITE)
-                break;
+            /* pairs are only skipped once n is known to be composite */
+            if (!pairs[t].done)
+                continue;
 
-            p = q_factors.p[j];     /* set p; p | q - 1 */
-            k = q_factors.exp[j];   /* set max k for which p^k | q - 1 */
-            r = n_pow(p, k);        /* set r = p^k */
+            q = pairs[t].q;
+            p = pairs[t].p;     /* set p; p | q - 1 */
+            k = pairs[t].k;     /* set max k for which p^k | q - 1 */
+            h = pairs[t].h;
             pind = _aprcl_p_ind(config, p);  /* find index of p in lambdas */
 
-            /* if lambdas_p == 0 set q_pow = q^{(n - 1) / 2} and p == 2 */
-            fmpz_set_ui(q_pow, q);
-            if (lambdas[pind] == 0 && p == 2)
-                fmpz_powm(q_pow, q_pow, ndecdiv, n);
-
-            /* compute u = n / r and v = n % r */
-            fmpz_tdiv_q_ui(u, n, r);
-            v = fmpz_tdiv_ui(n, r);
-
-            /* init unity_zp for jacobi sums */
-            unity_zp_init(jacobi_sum, p, k, n);
-            unity_zp_init(jacobi_sum2_1, p, k, n);
-            unity_zp_init(jacobi_sum2_2, p, k, n);
-
-            /* compute set jacobi_sum = J(p, q) */
-            unity_zp_jacobi_sum_pq(jacobi_sum, q, p);
-            /* if p == 2 and k >= 3 we also need to compute J_2(q) and J_3(q) */
-            if (p == 2 && k >= 3)
+            /* if h not found then n is composite */
+            if (h < 0)
             {
-                /* compute J_3(q) */
-                unity_zp_jacobi_sum_2q_one(jacobi_sum2_1, q);
-                /* compute J_2(q) */
-                unity_zp_jacobi_sum_2q_two(jacobi_sum2_2, q);
+                result = COMPOSITE;
+                break;
             }
 
             if (p == 2 && k == 1)
             {
-                h = _aprcl_is_prime_jacobi_check_21(q, n);
-
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
-
                 /*
                     check (Lp);
                     if h == 1 (unity root = -1)
@@ -685,50 +815,24 @@ _aprcl_is_prime_jacobi(const fmpz_t n, const aprcl_config config)
                 if (lambdas[pind] == 0 && h == 1 && nmod4 == 1)
                     lambdas[pind] = 1;
             }
-
-            if (p == 2 && k == 2)
-            {
-                h = _aprcl_is_prime_jacobi_check_22(jacobi_sum, u, v, q);
-
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
-
-                /*
-                    check (Lp);
-                    if h == 1 or 3 (unity root = -i or i)
-                    and q^{(n - 1) / 2} = -1 mod n then lambdas_2 = 1
-                */
-                if (h % 2 != 0 && lambdas[pind] == 0 && fmpz_equal(q_pow, ndec))
-                    lambdas[pind] = 1;
-            }
-
-            if (p == 2 && k >= 3)
+            else if (p == 2)
             {
-                h = _aprcl_is_prime_jacobi_check_2k(jacobi_sum,
-                        jacobi_sum2_1, jacobi_sum2_2, u, v);
-
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
-
                 /*
                     check (Lp);
                     if h % 2 != 0 (primitive unity root)
                     and q^{(n - 1) / 2} = -1 mod n then lambdas_2 = 1
                 */
-                if (h % 2 != 0 && lambdas[pind] == 0 && fmpz_equal(q_pow, ndec))
-                    lambdas[pind] = 1;
-            }
+                if (h % 2 != 0 && lambdas[pind] == 0)
+                {
+                    fmpz_set_ui(q_pow, q);
+                    fmpz_powm(q_pow, q_pow, ndecdiv, n);
 
-            if (p != 2)
+                    if (fmpz_equal(q_pow, ndec))
+                        lambdas[pind] = 1;
+                }
+            }
+            else
             {
-                h = _aprcl_is_prime_jacobi_check_pk(jacobi_sum, u, v);
-
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
-
                 /*
                     check (Lp);
                     if h % p != 0 (primitive unity root)
@@ -737,13 +841,9 @@ _aprcl_is_prime_jacobi(const fmpz_t n, const aprcl_config config)
                 if (h % p != 0 && lambdas[pind] == 0)
                     lambdas[pind] = 1;
             }
-
-            /* clear unity_zp for jacobi sums */
-            unity_zp_clear(jacobi_sum);
-            unity_zp_clear(jacobi_sum2_1);
-            unity_zp_clear(jacobi_sum2_2);
         }
 
+        flint_free(pairs);
     }
 
     /* Begin L_p tests */
@@ -801,7 +901,6 @@ _aprcl_is_prime_jacobi(const fmpz_t n, const aprcl_config config)
 
     /* clear */
     flint_free(lambdas);
-    fmpz_clear(u);
     fmpz_clear(q_pow);
     fmpz_clear(p2);
     fmpz_clear(ndec);
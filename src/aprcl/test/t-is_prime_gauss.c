@@ -26,6 +26,8 @@ int main(void)
         fmpz_t n;
         fmpz_init(n);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         fmpz_randtest_unsigned(n, state, 50);
         while (fmpz_cmp_ui(n, 100) <= 0)
             fmpz_randtest_unsigned(n, state, 50);
@@ -114,6 +114,8 @@ int main(void)
         prec = 20 + n_randint(state, 1000);
         flags = 0; /* ARB_FMPZ_POLY_ROOTS_VERBOSE; */
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         fmpz_poly_init(f);
         fmpz_poly_init(g);
         fmpq_poly_init(h);
@@ -206,7 +208,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -211,6 +211,17 @@ void arb_hypgeom_sum_fmpq_imag_arb_rs(arb_t res1, arb_t res2, const fmpq * a, sl
 void arb_hypgeom_sum_fmpq_imag_arb_bs(arb_t res_real, arb_t res_imag, const fmpq * a, slong alen, const fmpq * b, slong blen, const arb_t z, int reciprocal, slong N, slong prec);
 void arb_hypgeom_sum_fmpq_imag_arb(arb_t res1, arb_t res2, const fmpq * a, slong alen, const fmpq * b, slong blen, const arb_t z, int reciprocal, slong N, slong prec);
 
+void arb_hypgeom_gamma_vec(arb_ptr res, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_rgamma_vec(arb_ptr res, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_lgamma_vec(arb_ptr res, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_erf_vec(arb_ptr res, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_erfc_vec(arb_ptr res, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_bessel_j_vec(arb_ptr res, const arb_t nu, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_bessel_y_vec(arb_ptr res, const arb_t nu, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_bessel_i_vec(arb_ptr res, const arb_t nu, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_bessel_k_vec(arb_ptr res, const arb_t nu, arb_srcptr z, slong len, slong prec);
+void arb_hypgeom_airy_vec(arb_ptr ai, arb_ptr ai_prime, arb_ptr bi, arb_ptr bi_prime, arb_srcptr z, slong len, slong prec);
+
 
 #ifdef __cplusplus
 }
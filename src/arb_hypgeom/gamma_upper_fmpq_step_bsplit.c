@@ -10,6 +10,7 @@
 */
 
 #include <stdio.h>
+#include "thread_support.h"
 #include "fmpq.h"
 #include "arb_mat.h"
 #include "arb_hypgeom.h"
@@ -279,6 +280,108 @@ gamma_upper_taylor_bsplit(arb_mat_t M, arb_t Q,
     }
 }
 
+typedef struct
+{
+    arb_mat_struct M;
+    arb_struct Q;
+    slong b;
+}
+bsplit_res_t;
+
+typedef struct
+{
+    const fmpz * ap;
+    const fmpz * aq;
+    arb_srcptr z0;
+    arb_srcptr x;
+    slong N;
+    slong prec;
+}
+bsplit_args_t;
+
+static void
+bsplit_init(bsplit_res_t * x, void * args)
+{
+    arb_mat_init(&x->M, 3, 3);
+    arb_init(&x->Q);
+}
+
+static void
+bsplit_clear(bsplit_res_t * x, void * args)
+{
+    arb_mat_clear(&x->M);
+    arb_clear(&x->Q);
+}
+
+static void
+bsplit_basecase(bsplit_res_t * res, slong a, slong b, bsplit_args_t * args)
+{
+    gamma_upper_taylor_bsplit(&res->M, &res->Q, args->ap, args->aq,
+        args->z0, args->x, NULL, a, b, b != args->N, args->prec);
+    res->b = b;
+}
+
+/* res = left */
+static void
+bsplit_merge(bsplit_res_t * res, bsplit_res_t * left, bsplit_res_t * right, bsplit_args_t * args)
+{
+    slong prec = args->prec;
+
+    if (res != left)
+        flint_abort();
+
+    if (right->b != args->N)
+    {
+        arb_mat_mul_classical(&res->M, &right->M, &res->M, prec);
+    }
+    else
+    {
+        arb_mat_t M1;
+
+        /* only the last row is needed at the top level */
+        arb_mat_init(M1, 3, 3);
+        arb_mat_transpose(M1, &res->M);
+
+        arb_dot(arb_mat_entry(&res->M, 2, 0), NULL, 0, arb_mat_entry(M1, 0, 0), 1, arb_mat_entry(&right->M, 2, 0), 1, 3, prec);
+        arb_dot(arb_mat_entry(&res->M, 2, 1), NULL, 0, arb_mat_entry(M1, 1, 0), 1, arb_mat_entry(&right->M, 2, 0), 1, 3, prec);
+        arb_dot(arb_mat_entry(&res->M, 2, 2), NULL, 0, arb_mat_entry(M1, 2, 0), 1, arb_mat_entry(&right->M, 2, 0), 1, 3, prec);
+
+        arb_mat_clear(M1);
+    }
+
+    arb_mul(&res->Q, &right->Q, &res->Q, prec);
+    res->b = right->b;
+}
+
+static void
+gamma_upper_taylor_bsplit_threaded(arb_mat_t M, arb_t Q,
+    const fmpz_t ap, const fmpz_t aq, const arb_t z0, const arb_t x, slong N, slong prec)
+{
+    bsplit_res_t res;
+    bsplit_args_t args;
+
+    res.M = *M;
+    res.Q = *Q;
+
+    args.ap = ap;
+    args.aq = aq;
+    args.z0 = z0;
+    args.x = x;
+    args.N = N;
+    args.prec = prec;
+
+    flint_parallel_binary_splitting(&res,
+        (bsplit_basecase_func_t) bsplit_basecase,
+        (bsplit_merge_func_t) bsplit_merge,
+        sizeof(bsplit_res_t),
+        (bsplit_init_func_t) bsplit_init,
+        (bsplit_clear_func_t) bsplit_clear,
+        &args, 0, N, 8, -1, FLINT_PARALLEL_BSPLIT_LEFT_INPLACE);
+
+    *M = res.M;
+    *Q = res.Q;
+}
+
 /*
 Given Gz0 = Gamma(a, z0) and expmz0 = exp(-z0), compute Gz1 = Gamma(a, z1)
 */
@@ -318,7 +421,10 @@ _arb_gamma_upper_fmpq_step_bsplit(arb_t Gz1, const fmpq_t a, const arb_t z0, con
     arb_set_fmpq(a_real, a, 53);
     arb_hypgeom_gamma_upper_taylor_choose(&N, err, a_real, z0, xmag, abs_tol);
 
-    gamma_upper_taylor_bsplit(M, Q, fmpq_numref(a), fmpq_denref(a), z0, x, NULL, 0, N, 0, prec);
+    if (flint_get_num_threads() > 1 && N > 32 && prec > 4096)
+        gamma_upper_taylor_bsplit_threaded(M, Q, fmpq_numref(a), fmpq_denref(a), z0, x, N, prec);
+    else
+        gamma_upper_taylor_bsplit(M, Q, fmpq_numref(a), fmpq_denref(a), z0, x, NULL, 0, N, 0, prec);
 
     arb_mul(arb_mat_entry(M, 2, 0), arb_mat_entry(M, 2, 0), Gz0, prec);
 
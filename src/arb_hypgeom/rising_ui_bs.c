@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "arb_hypgeom.h"
 
 static void
@@ -44,6 +45,42 @@ bsplit(arb_t y, const arb_t x, ulong a, ulong b, slong prec)
     }
 }
 
+typedef struct
+{
+    arb_srcptr x;
+    slong prec;
+}
+bsplit_args_t;
+
+static void
+bsplit_basecase(arb_t y, slong a, slong b, bsplit_args_t * args)
+{
+    bsplit(y, args->x, a, b, args->prec);
+}
+
+static void
+bsplit_merge(arb_t res, const arb_t left, const arb_t right, bsplit_args_t * args)
+{
+    arb_mul(res, left, right, args->prec);
+}
+
+static void
+bsplit_threaded(arb_t y, const arb_t x, ulong a, ulong b, slong prec)
+{
+    bsplit_args_t args;
+
+    args.x = x;
+    args.prec = prec;
+
+    flint_parallel_binary_splitting(y,
+        (bsplit_basecase_func_t) bsplit_basecase,
+        (bsplit_merge_func_t) bsplit_merge,
+        sizeof(arb_struct),
+        (bsplit_init_func_t) arb_init,
+        (bsplit_clear_func_t) arb_clear,
+        &args, a, b, 16, -1, FLINT_PARALLEL_BSPLIT_LEFT_INPLACE);
+}
+
 void
 arb_hypgeom_rising_ui_bs(arb_t res, const arb_t x, ulong n, slong prec)
 {
@@ -61,7 +98,12 @@ arb_hypgeom_rising_ui_bs(arb_t res, const arb_t x, ulong n, slong prec)
         slong wp = ARF_PREC_ADD(prec, FLINT_BIT_COUNT(n));
 
         arb_init(t);
-        bsplit(t, x, 0, n, wp);
+
+        if (flint_get_num_threads() > 1 && n > 256 && prec > 4096)
+            bsplit_threaded(t, x, 0, n, wp);
+        else
+            bsplit(t, x, 0, n, wp);
+
         arb_set_round(res, t, prec);
         arb_clear(t);
     }
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "arb_hypgeom.h"
 
 static void
@@ -113,6 +114,109 @@ bsplit(arb_t A1, arb_t B1, arb_t C1,
     }
 }
 
+typedef struct
+{
+    arb_struct A;
+    arb_struct B;
+    arb_struct C;
+}
+bsplit_res_t;
+
+typedef struct
+{
+    const fmpq * a;
+    slong alen;
+    const fmpz * aden;
+    const fmpq * b;
+    slong blen;
+    const fmpz * bden;
+    arb_srcptr z;
+    int reciprocal;
+    slong prec;
+}
+bsplit_args_t;
+
+static void
+bsplit_init(bsplit_res_t * x, void * args)
+{
+    arb_init(&x->A);
+    arb_init(&x->B);
+    arb_init(&x->C);
+}
+
+static void
+bsplit_clear(bsplit_res_t * x, void * args)
+{
+    arb_clear(&x->A);
+    arb_clear(&x->B);
+    arb_clear(&x->C);
+}
+
+static void
+bsplit_basecase(bsplit_res_t * res, slong a, slong b, bsplit_args_t * args)
+{
+    bsplit(&res->A, &res->B, &res->C, args->a, args->alen, args->aden,
+        args->b, args->blen, args->bden, args->z, args->reciprocal, a, b, args->prec);
+
+    /* the merge step needs B explicitly */
+    if (b - a == 1)
+        arb_set(&res->B, &res->C);
+}
+
+/* res = left */
+static void
+bsplit_merge(bsplit_res_t * res, bsplit_res_t * left, bsplit_res_t * right, bsplit_args_t * args)
+{
+    slong prec = args->prec;
+
+    if (res != left)
+        flint_abort();
+
+    arb_mul(&res->B, &res->B, &right->C, prec);
+    arb_addmul(&res->B, &res->A, &right->B, prec);
+    arb_mul(&res->A, &res->A, &right->A, prec);
+    arb_mul(&res->C, &res->C, &right->C, prec);
+}
+
+static void
+bsplit_threaded(arb_t A1, arb_t B1, arb_t C1,
+        const fmpq * a, slong alen, const fmpz_t aden,
+        const fmpq * b, slong blen, const fmpz_t bden,
+        const arb_t z, int reciprocal,
+        slong aa,
+        slong bb,
+        slong prec)
+{
+    bsplit_res_t res;
+    bsplit_args_t args;
+
+    res.A = *A1;
+    res.B = *B1;
+    res.C = *C1;
+
+    args.a = a;
+    args.alen = alen;
+    args.aden = aden;
+    args.b = b;
+    args.blen = blen;
+    args.bden = bden;
+    args.z = z;
+    args.reciprocal = reciprocal;
+    args.prec = prec;
+
+    flint_parallel_binary_splitting(&res,
+        (bsplit_basecase_func_t) bsplit_basecase,
+        (bsplit_merge_func_t) bsplit_merge,
+        sizeof(bsplit_res_t),
+        (bsplit_init_func_t) bsplit_init,
+        (bsplit_clear_func_t) bsplit_clear,
+        &args, aa, bb, 16, -1, FLINT_PARALLEL_BSPLIT_LEFT_INPLACE);
+
+    *A1 = res.A;
+    *B1 = res.B;
+    *C1 = res.C;
+}
+
 void
 arb_hypgeom_sum_fmpq_arb_bs(arb_t res, const fmpq * a, slong alen, const fmpq * b, slong blen, const arb_t z, int reciprocal, slong N, slong prec)
 {
@@ -144,7 +248,10 @@ arb_hypgeom_sum_fmpq_arb_bs(arb_t res, const fmpq * a, slong alen, const fmpq *
     /* we compute to N-1 instead of N to avoid dividing by 0 in the
        denominator when computing a hypergeometric polynomial
        that terminates right before a pole */
-    bsplit(u, v, w, a, alen, aden, b, blen, bden, z, reciprocal, 0, N - 1, prec);
+    if (flint_get_num_threads() > 1 && N > 64 && prec > 4096)
+        bsplit_threaded(u, v, w, a, alen, aden, b, blen, bden, z, reciprocal, 0, N - 1, prec);
+    else
+        bsplit(u, v, w, a, alen, aden, b, blen, bden, z, reciprocal, 0, N - 1, prec);
 
     arb_add(res, u, v, prec); /* s = s + t */
     arb_div(res, res, w, prec);
@@ -66,6 +66,17 @@ int main(void)
         if (n_randint(state, 100) == 0)
             n += 100;
 
+        if (n_randint(state, 100) == 0)
+        {
+            flint_set_num_threads(1 + n_randint(state, 4));
+            prec = 4097 + n_randint(state, 4000);
+            n += 300;
+        }
+        else
+        {
+            flint_set_num_threads(1);
+        }
+
         arb_init(x);
         arb_init(xk);
         arb_init(y);
@@ -102,7 +113,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -47,6 +47,17 @@ int main(void)
         prec = 2 + n_randint(state, 500);
         reciprocal = n_randint(state, 2);
 
+        if (n_randint(state, 100) == 0)
+        {
+            flint_set_num_threads(1 + n_randint(state, 4));
+            N = 65 + n_randint(state, 200);
+            prec = 4097 + n_randint(state, 4000);
+        }
+        else
+        {
+            flint_set_num_threads(1);
+        }
+
         if (n_randint(state, 10) == 0)
             arb_randtest_special(z, state, 1 + n_randint(state, 200), 1 + n_randint(state, 100));
         else
@@ -92,7 +103,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        arb_ptr z, r1, r2, r3, r4;
+        arb_t nu, t;
+        slong i, len, prec;
+        int which;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 30);
+        prec = 2 + n_randint(state, 300);
+        which = n_randint(state, 10);
+
+        z = _arb_vec_init(len);
+        r1 = _arb_vec_init(len);
+        r2 = _arb_vec_init(len);
+        r3 = _arb_vec_init(len);
+        r4 = _arb_vec_init(len);
+        arb_init(nu);
+        arb_init(t);
+
+        for (i = 0; i < len; i++)
+            arb_randtest(z + i, state, 1 + n_randint(state, 200), 1 + n_randint(state, 8));
+
+        arb_set_si(nu, n_randint(state, 10));
+        arb_mul_2exp_si(nu, nu, -(slong) n_randint(state, 2));
+
+        switch (which)
+        {
+            case 0: arb_hypgeom_gamma_vec(r1, z, len, prec); break;
+            case 1: arb_hypgeom_rgamma_vec(r1, z, len, prec); break;
+            case 2: arb_hypgeom_lgamma_vec(r1, z, len, prec); break;
+            case 3: arb_hypgeom_erf_vec(r1, z, len, prec); break;
+            case 4: arb_hypgeom_erfc_vec(r1, z, len, prec); break;
+            case 5: arb_hypgeom_bessel_j_vec(r1, nu, z, len, prec); break;
+            case 6: arb_hypgeom_bessel_y_vec(r1, nu, z, len, prec); break;
+            case 7: arb_hypgeom_bessel_i_vec(r1, nu, z, len, prec); break;
+            case 8: arb_hypgeom_bessel_k_vec(r1, nu, z, len, prec); break;
+            default: arb_hypgeom_airy_vec(r1, r2, n_randint(state, 2) ? r3 : NULL, r4, z, len, prec);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            switch (which)
+            {
+                case 0: arb_hypgeom_gamma(t, z + i, prec); break;
+                case 1: arb_hypgeom_rgamma(t, z + i, prec); break;
+                case 2: arb_hypgeom_lgamma(t, z + i, prec); break;
+                case 3: arb_hypgeom_erf(t, z + i, prec); break;
+                case 4: arb_hypgeom_erfc(t, z + i, prec); break;
+                case 5: arb_hypgeom_bessel_j(t, nu, z + i, prec); break;
+                case 6: arb_hypgeom_bessel_y(t, nu, z + i, prec); break;
+                case 7: arb_hypgeom_bessel_i(t, nu, z + i, prec); break;
+                case 8: arb_hypgeom_bessel_k(t, nu, z + i, prec); break;
+                default: arb_hypgeom_airy(t, NULL, NULL, NULL, z + i, prec);
+            }
+
+            if (!arb_overlaps(t, r1 + i))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("which = %d, i = %wd, len = %wd\n\n", which, i, len);
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                flint_printf("r = "); arb_printd(r1 + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* aliasing */
+        if (which <= 4)
+        {
+            _arb_vec_set(r2, z, len);
+
+            switch (which)
+            {
+                case 0: arb_hypgeom_gamma_vec(r2, r2, len, prec); break;
+                case 1: arb_hypgeom_rgamma_vec(r2, r2, len, prec); break;
+                case 2: arb_hypgeom_lgamma_vec(r2, r2, len, prec); break;
+                case 3: arb_hypgeom_erf_vec(r2, r2, len, prec); break;
+                default: arb_hypgeom_erfc_vec(r2, r2, len, prec); break;
+            }
+
+            for (i = 0; i < len; i++)
+            {
+                if (!arb_overlaps(r1 + i, r2 + i))
+                {
+                    flint_printf("FAIL (aliasing)\n\n");
+                    flint_printf("which = %d, i = %wd, len = %wd\n\n", which, i, len);
+                    flint_abort();
+                }
+            }
+        }
+
+        _arb_vec_clear(z, len);
+        _arb_vec_clear(r1, len);
+        _arb_vec_clear(r2, len);
+        _arb_vec_clear(r3, len);
+        _arb_vec_clear(r4, len);
+        arb_clear(nu);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "thread_support.h"
+#include "arb_hypgeom.h"
+
+typedef struct
+{
+    slong key;
+    slong index;
+}
+vec_sort_t;
+
+static int
+vec_sort_cmp(const void * a, const void * b)
+{
+    slong x = ((const vec_sort_t *) a)->key;
+    slong y = ((const vec_sort_t *) b)->key;
+
+    if (x != y)
+        return (x < y) ? -1 : 1;
+
+    x = ((const vec_sort_t *) a)->index;
+    y = ((const vec_sort_t *) b)->index;
+
+    return (x < y) ? -1 : (x > y);
+}
+
+typedef struct
+{
+    arb_ptr res1;
+    arb_ptr res2;
+    arb_ptr res3;
+    arb_ptr res4;
+    arb_srcptr nu;
+    arb_srcptr z;
+    const slong * perm;
+    slong prec;
+}
+vec_work_t;
+
+/* Evaluates f on all indices, grouping arguments of similar magnitude
+   (which have similar cost and use the same algorithm) and handing
+   out the groups in strided order so that the threads get balanced
+   work. */
+static void
+vec_eval(do_func_t f, vec_work_t * work, arb_srcptr z, slong len, slong prec)
+{
+    vec_sort_t * v;
+    slong * perm;
+    slong i, thread_limit;
+
+    if (len <= 0)
+        return;
+
+    v = flint_malloc(sizeof(vec_sort_t) * len);
+    perm = flint_malloc(sizeof(slong) * len);
+
+    for (i = 0; i < len; i++)
+    {
+        v[i].key = arf_abs_bound_lt_2exp_si(arb_midref(z + i));
+        v[i].index = i;
+    }
+
+    qsort(v, len, sizeof(vec_sort_t), vec_sort_cmp);
+
+    for (i = 0; i < len; i++)
+        perm[i] = v[i].index;
+
+    work->z = z;
+    work->perm = perm;
+    work->prec = prec;
+
+    /* don't wake up threads for a handful of cheap evaluations */
+    if (len * FLINT_MAX(prec, 64) < 4096)
+        thread_limit = 1;
+    else
+        thread_limit = -1;
+
+    flint_parallel_do(f, work, len, thread_limit, FLINT_PARALLEL_STRIDED);
+
+    flint_free(v);
+    flint_free(perm);
+}
+
+#define DEF_VEC_FUNC1(name, func) \
+static void \
+name ## _worker(slong k, vec_work_t * work) \
+{ \
+    slong i = work->perm[k]; \
+    func(work->res1 + i, work->z + i, work->prec); \
+} \
+ \
+void \
+name(arb_ptr res, arb_srcptr z, slong len, slong prec) \
+{ \
+    vec_work_t work; \
+    work.res1 = res; \
+    vec_eval((do_func_t) name ## _worker, &work, z, len, prec); \
+}
+
+#define DEF_VEC_FUNC2(name, func) \
+static void \
+name ## _worker(slong k, vec_work_t * work) \
+{ \
+    slong i = work->perm[k]; \
+    func(work->res1 + i, work->nu, work->z + i, work->prec); \
+} \
+ \
+void \
+name(arb_ptr res, const arb_t nu, arb_srcptr z, slong len, slong prec) \
+{ \
+    vec_work_t work; \
+    work.res1 = res; \
+    work.nu = nu; \
+    vec_eval((do_func_t) name ## _worker, &work, z, len, prec); \
+}
+
+DEF_VEC_FUNC1(arb_hypgeom_gamma_vec, arb_hypgeom_gamma)
+DEF_VEC_FUNC1(arb_hypgeom_rgamma_vec, arb_hypgeom_rgamma)
+DEF_VEC_FUNC1(arb_hypgeom_lgamma_vec, arb_hypgeom_lgamma)
+DEF_VEC_FUNC1(arb_hypgeom_erf_vec, arb_hypgeom_erf)
+DEF_VEC_FUNC1(arb_hypgeom_erfc_vec, arb_hypgeom_erfc)
+
+DEF_VEC_FUNC2(arb_hypgeom_bessel_j_vec, arb_hypgeom_bessel_j)
+DEF_VEC_FUNC2(arb_hypgeom_bessel_y_vec, arb_hypgeom_bessel_y)
+DEF_VEC_FUNC2(arb_hypgeom_bessel_i_vec, arb_hypgeom_bessel_i)
+DEF_VEC_FUNC2(arb_hypgeom_bessel_k_vec, arb_hypgeom_bessel_k)
+
+#define ENTRY_OR_NULL(v, i) ((v) == NULL ? NULL : (v) + (i))
+
+static void
+airy_worker(slong k, vec_work_t * work)
+{
+    slong i = work->perm[k];
+
+    arb_hypgeom_airy(ENTRY_OR_NULL(work->res1, i), ENTRY_OR_NULL(work->res2, i),
+        ENTRY_OR_NULL(work->res3, i), ENTRY_OR_NULL(work->res4, i),
+        work->z + i, work->prec);
+}
+
+void
+arb_hypgeom_airy_vec(arb_ptr ai, arb_ptr ai_prime, arb_ptr bi, arb_ptr bi_prime, arb_srcptr z, slong len, slong prec)
+{
+    vec_work_t work;
+
+    work.res1 = ai;
+    work.res2 = ai_prime;
+    work.res3 = bi;
+    work.res4 = bi_prime;
+
+    vec_eval((do_func_t) airy_worker, &work, z, len, prec);
+}
@@ -356,6 +356,8 @@ int arb_mat_solve_lu(arb_mat_t X, const arb_mat_t A, const arb_mat_t B, slong pr
 
 int arb_mat_solve_precond(arb_mat_t X, const arb_mat_t A, const arb_mat_t B, slong prec);
 
+int arb_mat_solve_refine(arb_mat_t X, const arb_mat_t A, const arb_mat_t B, slong prec);
+
 int arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
     const arb_mat_t B, const arb_mat_t R, const arb_mat_t T, slong prec);
 
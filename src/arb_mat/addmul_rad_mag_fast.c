@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "arb_mat.h"
 
 #ifdef __GNUC__
@@ -34,26 +35,21 @@ static __inline__ double dot8(const double * A, const double * B)
            ((A[4] * B[4] + A[5] * B[5]) + (A[6] * B[6] + A[7] * B[7]));
 }
 
-/* Upper bound of matrix product, assuming nonnegative entries and
-   no overflow/underflow. B is pre-transposed. Straightforward blocked
-   implementation; could use BLAS, but this matrix product is rarely going
-   to be the bottleneck. */
-
 static void
-_d_mat_addmul(double * C, const double * A, const double * B, slong ar, slong ac, slong bc)
+_d_mat_addmul_rows(double * C, const double * A, const double * B, slong row_start, slong row_end, slong ac, slong bc)
 {
     slong ii, jj, kk, i, j, k;
     double t, eps;
 
     eps = ldexp(1.0, -52);
 
-    for (ii = 0; ii < ar; ii += BLOCK_SIZE)
+    for (ii = row_start; ii < row_end; ii += BLOCK_SIZE)
     {
         for (jj = 0; jj < bc; jj += BLOCK_SIZE)
         {
             for (kk = 0; kk < ac; kk += BLOCK_SIZE)
             {
-                for (i = ii; i < FLINT_MIN(ii + BLOCK_SIZE, ar); i++)
+                for (i = ii; i < FLINT_MIN(ii + BLOCK_SIZE, row_end); i++)
                 {
                     for (j = jj; j < FLINT_MIN(jj + BLOCK_SIZE, bc); j++)
                     {
@@ -84,11 +80,58 @@ _d_mat_addmul(double * C, const double * A, const double * B, slong ar, slong ac
     }
 
     /* Compensate for possible rounding errors */
-    for (i = 0; i < ar; i++)
+    for (i = row_start; i < row_end; i++)
         for (j = 0; j < bc; j++)
             C[i * bc + j] *= (1.0 + 2.01 * (ac + 1) * eps);
 }
 
+typedef struct
+{
+    double * C;
+    const double * A;
+    const double * B;
+    slong ar;
+    slong ac;
+    slong bc;
+}
+d_addmul_work_t;
+
+static void
+_d_mat_addmul_worker(slong b, d_addmul_work_t * work)
+{
+    slong row_start = b * BLOCK_SIZE;
+    slong row_end = FLINT_MIN(row_start + BLOCK_SIZE, work->ar);
+
+    _d_mat_addmul_rows(work->C, work->A, work->B, row_start, row_end, work->ac, work->bc);
+}
+
+/* Upper bound of matrix product, assuming nonnegative entries and
+   no overflow/underflow. B is pre-transposed. Straightforward blocked
+   implementation; could use BLAS, but this matrix product is rarely going
+   to be the bottleneck. For large matrices, the row blocks are
+   distributed over threads. */
+static void
+_d_mat_addmul(double * C, const double * A, const double * B, slong ar, slong ac, slong bc)
+{
+    d_addmul_work_t work;
+    int thread_limit;
+
+    work.C = C;
+    work.A = A;
+    work.B = B;
+    work.ar = ar;
+    work.ac = ac;
+    work.bc = bc;
+
+    if ((double) ar * ac * bc > 1e6)
+        thread_limit = -1;
+    else
+        thread_limit = 1;
+
+    flint_parallel_do((do_func_t) _d_mat_addmul_worker, &work,
+        (ar + BLOCK_SIZE - 1) / BLOCK_SIZE, thread_limit, 0);
+}
+
 /* We use WORD_MIN to represent zero here. */
 static __inline__ slong _mag_get_exp(const mag_t x)
 {
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz_mat.h"
 #include "arb_mat.h"
 
@@ -84,6 +85,107 @@ arb_mat_mid_addmul_block_fallback(arb_mat_t C,
     flint_free(tmpA);
 }
 
+typedef struct
+{
+    arb_mat_struct * C;
+    const arb_mat_struct * A;
+    const arb_mat_struct * B;
+    fmpz_mat_struct * AA;
+    fmpz_mat_struct * BB;
+    fmpz_mat_struct * CC;
+    slong block_start;
+    slong n;
+    slong M0;
+    slong P0;
+    slong P1;
+    const slong * A_min;
+    const slong * B_min;
+    slong prec;
+}
+block_work_t;
+
+/* Convert row M0 + i of the block of A to a fixed-point integer row. */
+static void
+block_convert_A_worker(slong i, block_work_t * work)
+{
+    slong j;
+    int inexact;
+
+    i += work->M0;
+
+    if (work->A_min[i] == WORD_MIN)  /* only zeros in this row */
+        return;
+
+    for (j = 0; j < work->n; j++)
+    {
+        inexact = arf_get_fmpz_fixed_si(fmpz_mat_entry(work->AA, i - work->M0, j),
+            arb_midref(arb_mat_entry(work->A, i, work->block_start + j)), work->A_min[i]);
+
+        if (inexact)
+        {
+            flint_printf("matrix multiplication: bad exponent!\n");
+            flint_abort();
+        }
+    }
+}
+
+/* Convert column P0 + i of the block of B to a fixed-point integer column. */
+static void
+block_convert_B_worker(slong i, block_work_t * work)
+{
+    slong j;
+    int inexact;
+
+    i += work->P0;
+
+    if (work->B_min[i] == WORD_MIN)  /* only zeros in this column */
+        return;
+
+    for (j = 0; j < work->n; j++)
+    {
+        inexact = arf_get_fmpz_fixed_si(fmpz_mat_entry(work->BB, j, i - work->P0),
+            arb_midref(arb_mat_entry(work->B, work->block_start + j, i)), work->B_min[i]);
+
+        if (inexact)
+        {
+            flint_printf("matrix multiplication: bad exponent!\n");
+            flint_abort();
+        }
+    }
+}
+
+/* Add row M0 + i of the integer product to the result matrix. */
+static void
+block_add_C_worker(slong i, block_work_t * work)
+{
+    slong j;
+    arb_t t;
+    fmpz_t e;
+
+    i += work->M0;
+
+    arb_init(t);
+
+    for (j = work->P0; j < work->P1; j++)
+    {
+        *e = work->A_min[i] + work->B_min[j];
+
+        /* The first time we write this Cij */
+        if (work->block_start == 0)
+        {
+            arb_set_round_fmpz_2exp(arb_mat_entry(work->C, i, j),
+                fmpz_mat_entry(work->CC, i - work->M0, j - work->P0), e, work->prec);
+        }
+        else
+        {
+            arb_set_round_fmpz_2exp(t, fmpz_mat_entry(work->CC, i - work->M0, j - work->P0), e, work->prec);
+            arb_add(arb_mat_entry(work->C, i, j), arb_mat_entry(work->C, i, j), t, work->prec);
+        }
+    }
+
+    arb_clear(t);
+}
+
 void
 arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
     const arb_mat_t A, const arb_mat_t B,
@@ -94,9 +196,9 @@ arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
     slong prec)
 {
     slong M, P, n;
-    slong i, j;
     slong M0, M1, P0, P1, Mstep, Pstep;
-    int inexact;
+    block_work_t work;
+    int thread_limit;
 
     /* flint_printf("block mul from %wd to %wd\n", block_start, block_end); */
 
@@ -114,13 +216,27 @@ arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
     Pstep = P;
 #endif
 
+    /* The conversions are only quadratic, but still add up for
+       large matrices since the integer product is threaded. */
+    if (flint_get_num_threads() > 1 && (double) Mstep * Pstep * n * prec > 1e7)
+        thread_limit = -1;
+    else
+        thread_limit = 1;
+
+    work.C = C;
+    work.A = A;
+    work.B = B;
+    work.block_start = block_start;
+    work.n = n;
+    work.A_min = A_min;
+    work.B_min = B_min;
+    work.prec = prec;
+
     for (M0 = 0; M0 < M; M0 += Mstep)
     {
         for (P0 = 0; P0 < P; P0 += Pstep)
         {
             fmpz_mat_t AA, BB, CC;
-            arb_t t;
-            fmpz_t e;
 
             M1 = FLINT_MIN(M0 + Mstep, M);
             P1 = FLINT_MIN(P0 + Pstep, P);
@@ -129,44 +245,18 @@ arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
             fmpz_mat_init(BB, n, P1 - P0);
             fmpz_mat_init(CC, M1 - M0, P1 - P0);
 
-            /* Convert to fixed-point matrices. */
-            for (i = M0; i < M1; i++)
-            {
-                if (A_min[i] == WORD_MIN)  /* only zeros in this row */
-                    continue;
-
-                for (j = 0; j < n; j++)
-                {
-                    inexact = arf_get_fmpz_fixed_si(fmpz_mat_entry(AA, i - M0, j),
-                        arb_midref(arb_mat_entry(A, i, block_start + j)), A_min[i]);
-
-                    if (inexact)
-                    {
-                        flint_printf("matrix multiplication: bad exponent!\n");
-                        flint_abort();
-                    }
-                }
-            }
+            work.AA = AA;
+            work.BB = BB;
+            work.CC = CC;
+            work.M0 = M0;
+            work.P0 = P0;
+            work.P1 = P1;
 
-            for (i = P0; i < P1; i++)
-            {
-                if (B_min[i] == WORD_MIN)  /* only zeros in this column */
-                    continue;
-
-                for (j = 0; j < n; j++)
-                {
-                    inexact = arf_get_fmpz_fixed_si(fmpz_mat_entry(BB, j, i - P0),
-                        arb_midref(arb_mat_entry(B, block_start + j, i)), B_min[i]);
-
-                    if (inexact)
-                    {
-                        flint_printf("matrix multiplication: bad exponent!\n");
-                        flint_abort();
-                    }
-                }
-            }
+            /* Convert to fixed-point matrices. */
+            flint_parallel_do((do_func_t) block_convert_A_worker, &work, M1 - M0, thread_limit, FLINT_PARALLEL_STRIDED);
+            flint_parallel_do((do_func_t) block_convert_B_worker, &work, P1 - P0, thread_limit, FLINT_PARALLEL_STRIDED);
 
-            /* The main multiplication */
+            /* The main multiplication; this uses threads internally. */
             fmpz_mat_mul(CC, AA, BB);
             /* flint_printf("bits %wd %wd %wd\n", fmpz_mat_max_bits(CC),
                         fmpz_mat_max_bits(AA), fmpz_mat_max_bits(BB)); */
@@ -174,29 +264,8 @@ arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
             fmpz_mat_clear(AA);
             fmpz_mat_clear(BB);
 
-            arb_init(t);
-
             /* Add to the result matrix */
-            for (i = M0; i < M1; i++)
-            {
-                for (j = P0; j < P1; j++)
-                {
-                    *e = A_min[i] + B_min[j];
-
-                    /* The first time we write this Cij */
-                    if (block_start == 0)
-                    {
-                        arb_set_round_fmpz_2exp(arb_mat_entry(C, i, j),
-                            fmpz_mat_entry(CC, i - M0, j - P0), e, prec);
-                    }
-                    else
-                    {
-                        arb_set_round_fmpz_2exp(t, fmpz_mat_entry(CC, i - M0, j - P0), e, prec);
-                        arb_add(arb_mat_entry(C, i, j), arb_mat_entry(C, i, j), t, prec);
-                    }
-                }
-            }
-            arb_clear(t);
+            flint_parallel_do((do_func_t) block_add_C_worker, &work, M1 - M0, thread_limit, FLINT_PARALLEL_STRIDED);
 
             fmpz_mat_clear(CC);
         }
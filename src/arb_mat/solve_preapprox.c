@@ -44,8 +44,13 @@ int _mag_err_complement(mag_t m,
     return !mag_is_zero(m);
 }
 
-int arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
-    const arb_mat_t B, const arb_mat_t R, const arb_mat_t T, slong prec)
+/*
+ * The products involving R are computed at the precision rprec, which
+ * may be lower than prec; the residual AT - B is computed at prec.
+ */
+int _arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
+    const arb_mat_t B, const arb_mat_t R, const arb_mat_t T,
+    slong prec, slong rprec)
 {
     int result;
     slong m, n;
@@ -61,14 +66,14 @@ int arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
 
     /* Use Theorem 10.2 of Rump in Acta Numerica 2010 */
     mag_init(d);
-    if (_mag_err_complement(d, R, A, prec))
+    if (_mag_err_complement(d, R, A, rprec))
     {
         arb_mat_t C;
 
         arb_mat_init(C, n, m);
         arb_mat_mul(C, A, T, prec);
         arb_mat_sub(C, C, B, prec);
-        arb_mat_mul(C, R, C, prec);
+        arb_mat_mul(C, R, C, rprec);
 
         /* Each column gets its own error bound. */
         arb_mat_set(X, T);
@@ -107,3 +112,9 @@ int arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
 
     return result;
 }
+
+int arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
+    const arb_mat_t B, const arb_mat_t R, const arb_mat_t T, slong prec)
+{
+    return _arb_mat_solve_preapprox(X, A, B, R, T, prec, prec);
+}
@@ -0,0 +1,147 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "perm.h"
+#include "arb_mat.h"
+
+int _arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
+    const arb_mat_t B, const arb_mat_t R, const arb_mat_t T,
+    slong prec, slong rprec);
+
+/* Working precision for the factorization and the correction steps. */
+#define REFINE_LOW_PREC 128
+
+static void
+arb_mat_bound_max_abs(mag_t res, const arb_mat_t A)
+{
+    slong i, j;
+    mag_t t;
+
+    mag_init(t);
+    mag_zero(res);
+
+    for (i = 0; i < arb_mat_nrows(A); i++)
+    {
+        for (j = 0; j < arb_mat_ncols(A); j++)
+        {
+            arb_get_mag(t, arb_mat_entry(A, i, j));
+            mag_max(res, res, t);
+        }
+    }
+
+    mag_clear(t);
+}
+
+int
+arb_mat_solve_refine(arb_mat_t X, const arb_mat_t A, const arb_mat_t B, slong prec)
+{
+    slong n, m, i, j, iter, max_iter, lp;
+    slong * perm;
+    arb_mat_t LU, T, D, R;
+    mag_t dnorm, dnorm_prev, tnorm;
+    int result;
+
+    n = arb_mat_nrows(A);
+    m = arb_mat_ncols(X);
+
+    if (n == 0 || m == 0)
+        return 1;
+
+    lp = FLINT_MIN(prec, REFINE_LOW_PREC);
+
+    perm = _perm_init(n);
+    arb_mat_init(LU, n, n);
+    arb_mat_init(T, n, m);
+    arb_mat_init(D, n, m);
+    mag_init(dnorm);
+    mag_init(dnorm_prev);
+    mag_init(tnorm);
+
+    result = arb_mat_approx_lu(perm, LU, A, lp);
+
+    if (result)
+    {
+        /* Initial approximation at low precision. */
+        arb_mat_approx_solve_lu_precomp(T, perm, LU, B, lp);
+
+        /* Each step gains roughly lp - log2(cond(A)) bits. */
+        max_iter = 4 + 2 * (prec / lp);
+        mag_inf(dnorm_prev);
+
+        for (iter = 0; iter < max_iter; iter++)
+        {
+            /* Residual B - AT of the midpoints, at full precision. */
+            arb_mat_approx_mul(D, A, T, prec);
+            arb_mat_sub(D, B, D, prec);
+
+            /* The correction only needs to be accurate to low precision. */
+            arb_mat_approx_solve_lu_precomp(D, perm, LU, D, lp);
+
+            for (i = 0; i < n; i++)
+                for (j = 0; j < m; j++)
+                    arf_add(arb_midref(arb_mat_entry(T, i, j)),
+                        arb_midref(arb_mat_entry(T, i, j)),
+                        arb_midref(arb_mat_entry(D, i, j)), prec, ARF_RND_DOWN);
+
+            arb_mat_bound_max_abs(dnorm, D);
+            arb_mat_bound_max_abs(tnorm, T);
+
+            /* Converged to full precision. */
+            mag_mul_2exp_si(tnorm, tnorm, -prec);
+            if (mag_cmp(dnorm, tnorm) <= 0)
+                break;
+
+            /* No more progress: we have reached the accuracy permitted
+               by the conditioning of A (or A is too ill-conditioned for
+               the low precision to give any contraction). */
+            mag_mul_2exp_si(dnorm_prev, dnorm_prev, -1);
+            if (mag_cmp(dnorm, dnorm_prev) > 0)
+                break;
+
+            mag_set(dnorm_prev, dnorm);
+        }
+
+        /* Give up if more than half of the precision was lost; the
+           caller is better served by a direct solver in that case. */
+        mag_mul_2exp_si(tnorm, tnorm, prec / 2);
+        if (mag_cmp(dnorm, tnorm) > 0)
+            result = 0;
+    }
+
+    if (result)
+    {
+        arb_mat_t I;
+
+        /* Approximate inverse R from the low-precision factorization. */
+        arb_mat_init(R, n, n);
+        arb_mat_init(I, n, n);
+        arb_mat_one(I);
+        arb_mat_approx_solve_lu_precomp(R, perm, LU, I, lp);
+        arb_mat_clear(I);
+
+        /* Only the residual needs to be computed at full precision;
+           the products with R are evaluated in ball arithmetic at low
+           precision, which is still rigorous. */
+        result = _arb_mat_solve_preapprox(X, A, B, R, T, prec, lp);
+
+        arb_mat_clear(R);
+    }
+
+    _perm_clear(perm);
+    arb_mat_clear(LU);
+    arb_mat_clear(T);
+    arb_mat_clear(D);
+    mag_clear(dnorm);
+    mag_clear(dnorm_prev);
+    mag_clear(tnorm);
+
+    return result;
+}
@@ -116,9 +116,21 @@ int main(void)
         arb_mat_t A, B, C, D;
         slong m, n, p, bits1, bits2, exp1, exp2, prec1, prec2;
 
-        m = n_randint(state, 40);
-        n = n_randint(state, 40);
-        p = n_randint(state, 40);
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        /* occasionally large enough to use threads */
+        if (n_randint(state, 100) == 0)
+        {
+            m = 100 + n_randint(state, 100);
+            n = 100 + n_randint(state, 100);
+            p = 100 + n_randint(state, 100);
+        }
+        else
+        {
+            m = n_randint(state, 40);
+            n = n_randint(state, 40);
+            p = n_randint(state, 40);
+        }
 
         arb_mat_mul_block_min_block_size = n_randint(state, 10);
 
@@ -163,7 +175,7 @@ int main(void)
     }
 
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
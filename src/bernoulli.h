@@ -26,6 +26,13 @@ extern FLINT_TLS_PREFIX fmpq * bernoulli_cache;
 
 void bernoulli_cache_compute(slong n);
 
+void _bernoulli_cache_extend(const fmpq * vec, slong n);
+
+#ifdef FLINT_HAVE_FILE
+int bernoulli_cache_out_raw(FILE * file);
+int bernoulli_cache_inp_raw(FILE * file);
+#endif
+
 /*
 Crude bound for the bits in d(n) = denom(B_n).
 By von Staudt-Clausen, d(n) = prod_{p-1 | n} p
@@ -12,10 +12,94 @@
 #include "fmpq.h"
 #include "bernoulli.h"
 
+/* With thread-local caches, we additionally keep a process-wide copy
+   of the longest cache computed by any thread, so that a thread can
+   fill its own cache by copying instead of recomputing. */
+#if FLINT_USES_TLS && FLINT_USES_PTHREAD
+#include <pthread.h>
+#define BERNOULLI_SHARED_CACHE 1
+#else
+#define BERNOULLI_SHARED_CACHE 0
+#endif
+
 FLINT_TLS_PREFIX slong bernoulli_cache_num = 0;
 
 FLINT_TLS_PREFIX fmpq * bernoulli_cache = NULL;
 
+#if BERNOULLI_SHARED_CACHE
+
+static pthread_mutex_t bernoulli_shared_lock = PTHREAD_MUTEX_INITIALIZER;
+static slong bernoulli_shared_num = 0;
+static fmpq * bernoulli_shared = NULL;
+
+/* Registered by the thread which creates the shared cache; another
+   thread may create it again after it has been freed. */
+static void
+bernoulli_shared_cleanup(void)
+{
+    slong i;
+
+    pthread_mutex_lock(&bernoulli_shared_lock);
+
+    for (i = 0; i < bernoulli_shared_num; i++)
+        fmpq_clear(bernoulli_shared + i);
+
+    flint_free(bernoulli_shared);
+    bernoulli_shared = NULL;
+    bernoulli_shared_num = 0;
+
+    pthread_mutex_unlock(&bernoulli_shared_lock);
+}
+
+/* Copies the shared entries with index in [a, b) to res + a and returns
+   the index of the first entry that was not available. */
+static slong
+bernoulli_shared_fetch(fmpq * res, slong a, slong b)
+{
+    slong i;
+
+    pthread_mutex_lock(&bernoulli_shared_lock);
+
+    b = FLINT_MIN(b, bernoulli_shared_num);
+
+    for (i = a; i < b; i++)
+        fmpq_set(res + i, bernoulli_shared + i);
+
+    pthread_mutex_unlock(&bernoulli_shared_lock);
+
+    return FLINT_MAX(a, b);
+}
+
+/* Makes the entries of res with index less than n available to all
+   threads. */
+static void
+bernoulli_shared_store(const fmpq * res, slong n)
+{
+    slong i;
+
+    pthread_mutex_lock(&bernoulli_shared_lock);
+
+    if (bernoulli_shared_num < n)
+    {
+        if (bernoulli_shared_num == 0)
+            flint_register_cleanup_function(bernoulli_shared_cleanup);
+
+        bernoulli_shared = flint_realloc(bernoulli_shared, n * sizeof(fmpq));
+
+        for (i = bernoulli_shared_num; i < n; i++)
+        {
+            fmpq_init(bernoulli_shared + i);
+            fmpq_set(bernoulli_shared + i, res + i);
+        }
+
+        bernoulli_shared_num = n;
+    }
+
+    pthread_mutex_unlock(&bernoulli_shared_lock);
+}
+
+#endif
+
 void
 bernoulli_cleanup(void)
 {
@@ -29,6 +113,52 @@ bernoulli_cleanup(void)
     bernoulli_cache_num = 0;
 }
 
+/* Extends the cache to n entries, taking the new entries from vec
+   (which may be NULL) or otherwise computing them. */
+void
+_bernoulli_cache_extend(const fmpq * vec, slong n)
+{
+    slong i, old_num, have;
+
+    old_num = bernoulli_cache_num;
+
+    if (old_num >= n)
+        return;
+
+    if (old_num == 0)
+        flint_register_cleanup_function(bernoulli_cleanup);
+
+    bernoulli_cache = flint_realloc(bernoulli_cache, n * sizeof(fmpq));
+    for (i = old_num; i < n; i++)
+        fmpq_init(bernoulli_cache + i);
+
+    if (vec != NULL)
+    {
+        for (i = old_num; i < n; i++)
+            fmpq_set(bernoulli_cache + i, vec + i);
+
+        have = n;
+    }
+    else
+    {
+#if BERNOULLI_SHARED_CACHE
+        have = bernoulli_shared_fetch(bernoulli_cache, old_num, n);
+#else
+        have = old_num;
+#endif
+
+        /* only compute the entries that are not already known */
+        if (have < n)
+            bernoulli_fmpq_vec_no_cache(bernoulli_cache + have, have, n - have);
+    }
+
+#if BERNOULLI_SHARED_CACHE
+    bernoulli_shared_store(bernoulli_cache, n);
+#endif
+
+    bernoulli_cache_num = n;
+}
+
 void
 bernoulli_cache_compute(slong n)
 {
@@ -36,33 +166,13 @@ bernoulli_cache_compute(slong n)
 
     if (old_num < n)
     {
-        slong i, new_num;
-
-        if (old_num == 0)
-        {
-            flint_register_cleanup_function(bernoulli_cleanup);
-        }
+        slong new_num;
 
         if (n <= 128)
             new_num = FLINT_MAX(old_num + 32, n);
         else
             new_num = FLINT_MAX(old_num + 128, n);
 
-        bernoulli_cache = flint_realloc(bernoulli_cache, new_num * sizeof(fmpq));
-        for (i = old_num; i < new_num; i++)
-            fmpq_init(bernoulli_cache + i);
-
-        if (new_num <= 128)
-        {
-            /* todo: use recursion, but only compute new entries */
-            arith_bernoulli_number_vec(bernoulli_cache, new_num);
-        }
-        else
-        {
-            bernoulli_fmpq_vec_no_cache(bernoulli_cache + old_num, old_num, new_num - old_num);
-        }
-
-        bernoulli_cache_num = new_num;
+        _bernoulli_cache_extend(NULL, new_num);
     }
 }
-
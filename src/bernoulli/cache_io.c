@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "fmpq.h"
+#include "fmpq_vec.h"
+#include "bernoulli.h"
+
+int
+bernoulli_cache_out_raw(FILE * file)
+{
+    fmpz_t t;
+    slong i;
+    int success;
+
+    fmpz_init(t);
+    fmpz_set_si(t, bernoulli_cache_num);
+    success = (fmpz_out_raw(file, t) != 0);
+    fmpz_clear(t);
+
+    for (i = 0; i < bernoulli_cache_num && success; i++)
+    {
+        success = (fmpz_out_raw(file, fmpq_numref(bernoulli_cache + i)) != 0) &&
+                  (fmpz_out_raw(file, fmpq_denref(bernoulli_cache + i)) != 0);
+    }
+
+    return success;
+}
+
+/* Checks the entries of vec with index in [a, n) before they are put in
+   the cache, which is shared between threads. The cheap structural
+   properties are checked for every entry, and a few entries, including
+   the last nonzero one, are compared with independently computed values. */
+static int
+_bernoulli_cache_check(const fmpq * vec, slong a, slong n)
+{
+    slong i, k, idx[3];
+    fmpq_t b;
+    int success = 1;
+
+    for (i = a; i < n && success; i++)
+    {
+        if (!fmpq_is_canonical(vec + i))
+            success = 0;
+        else if (i == 0)
+            success = fmpq_is_one(vec + i);
+        else if (i == 1)
+            success = fmpz_equal_si(fmpq_numref(vec + i), -1) &&
+                      fmpz_equal_ui(fmpq_denref(vec + i), 2);
+        else if (i % 2 == 1)
+            success = fmpq_is_zero(vec + i);
+        else
+            success = (fmpz_sgn(fmpq_numref(vec + i)) == ((i % 4 == 2) ? 1 : -1));
+    }
+
+    if (!success)
+        return 0;
+
+    idx[0] = (a + 1) & ~WORD(1);
+    idx[1] = ((a + n) / 2) & ~WORD(1);
+    idx[2] = (n - 1) & ~WORD(1);
+
+    fmpq_init(b);
+
+    for (k = 0; k < 3 && success; k++)
+    {
+        if (idx[k] < FLINT_MAX(a, 2) || (k > 0 && idx[k] == idx[k - 1]))
+            continue;
+
+        bernoulli_fmpq_ui(b, idx[k]);
+        success = fmpq_equal(b, vec + idx[k]);
+    }
+
+    fmpq_clear(b);
+
+    return success;
+}
+
+int
+bernoulli_cache_inp_raw(FILE * file)
+{
+    fmpz_t t;
+    fmpq * vec;
+    slong i, n, alloc;
+    int success;
+
+    fmpz_init(t);
+    success = (fmpz_inp_raw(t, file) != 0) && fmpz_fits_si(t) && fmpz_sgn(t) >= 0;
+    n = success ? fmpz_get_si(t) : 0;
+    fmpz_clear(t);
+
+    if (!success)
+        return 0;
+
+    /* grow the buffer as entries are read, so that a corrupt header
+       does not trigger a huge allocation */
+    alloc = 0;
+    vec = NULL;
+
+    for (i = 0; i < n && success; i++)
+    {
+        if (i == alloc)
+        {
+            alloc = FLINT_MAX(2 * alloc, 128);
+            vec = flint_realloc(vec, alloc * sizeof(fmpq));
+        }
+
+        fmpq_init(vec + i);
+
+        success = (fmpz_inp_raw(fmpq_numref(vec + i), file) != 0) &&
+                  (fmpz_inp_raw(fmpq_denref(vec + i), file) != 0) &&
+                  fmpz_sgn(fmpq_denref(vec + i)) > 0;
+    }
+
+    /* only entries that are not already cached are used */
+    if (success && n > bernoulli_cache_num)
+    {
+        success = _bernoulli_cache_check(vec, bernoulli_cache_num, n);
+
+        if (success)
+            _bernoulli_cache_extend(vec, n);
+    }
+
+    _fmpq_vec_clear(vec, i);
+
+    return success;
+}
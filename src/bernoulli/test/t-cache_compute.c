@@ -0,0 +1,246 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "thread_support.h"
+#include "ulong_extras.h"
+#include "nmod.h"
+#include "nmod_poly.h"
+#include "fmpq.h"
+#include "bernoulli.h"
+
+typedef struct
+{
+    const slong * n;
+    int * ok;
+    nmod_poly_struct * A;
+}
+work_t;
+
+/* checks the cached B_0, ..., B_{n-1} modulo the modulus of A */
+static int
+check_cache(slong n, const nmod_poly_t A)
+{
+    mp_limb_t m1, m2;
+    slong i;
+
+    if (bernoulli_cache_num < n)
+        return 0;
+
+    for (i = 0; i < n; i++)
+    {
+        m1 = fmpz_fdiv_ui(fmpq_numref(bernoulli_cache + i), A->mod.n);
+        m2 = fmpz_fdiv_ui(fmpq_denref(bernoulli_cache + i), A->mod.n);
+        m1 = nmod_div(m1, m2, A->mod);
+        m2 = nmod_poly_get_coeff_ui(A, i);
+
+        if (m1 != m2)
+            return 0;
+    }
+
+    return 1;
+}
+
+static void
+worker(slong i, work_t * work)
+{
+    bernoulli_cache_compute(work->n[i]);
+    work->ok[i] = check_cache(work->n[i], work->A);
+}
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+    slong i, bound;
+    mp_limb_t p, m;
+    nmod_poly_t A;
+
+    flint_printf("cache_compute....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    bound = 1000 * FLINT_MIN(1.0, 0.1 * flint_test_multiplier());
+
+    p = n_nextprime(UWORD(1) << (FLINT_BITS - 1), 0);
+
+    /* A = x / (exp(x) - 1) as an exponential generating function;
+       bernoulli_cache_compute may round the cache size up by 128 */
+    nmod_poly_init(A, p);
+    nmod_poly_set_coeff_ui(A, 1, 1);
+    nmod_poly_exp_series(A, A, bound + 129);
+    nmod_poly_shift_right(A, A, 1);
+    nmod_poly_inv_series(A, A, bound + 128);
+
+    m = 1;
+    for (i = 0; i < A->length; i++)
+    {
+        A->coeffs[i] = nmod_mul(A->coeffs[i], m, A->mod);
+        m = nmod_mul(m, i + 1, A->mod);
+    }
+
+    /* concurrent extension */
+    for (iter = 0; iter < 20 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        slong num_tasks, n[8];
+        int ok[8];
+        work_t work;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        num_tasks = 1 + n_randint(state, 8);
+
+        for (i = 0; i < num_tasks; i++)
+            n[i] = n_randint(state, bound);
+
+        work.n = n;
+        work.ok = ok;
+        work.A = A;
+
+        flint_parallel_do((do_func_t) worker, &work, num_tasks, -1, FLINT_PARALLEL_STRIDED);
+
+        for (i = 0; i < num_tasks; i++)
+        {
+            if (!ok[i])
+            {
+                flint_printf("FAIL: concurrent extension\n");
+                flint_printf("n = %wd\n", n[i]);
+                flint_abort();
+            }
+        }
+
+        if (n_randint(state, 4) == 0)
+            flint_cleanup();
+    }
+
+    /* reading and writing */
+    for (iter = 0; iter < 10 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        FILE * file;
+        slong n1, n2;
+
+        flint_set_num_threads(1);
+
+        n1 = n_randint(state, bound);
+        bernoulli_cache_compute(n1);
+        n1 = bernoulli_cache_num;
+
+        file = tmpfile();
+
+        if (file == NULL)
+        {
+            flint_printf("FAIL: tmpfile\n");
+            flint_abort();
+        }
+
+        if (!bernoulli_cache_out_raw(file))
+        {
+            flint_printf("FAIL: out_raw\n");
+            flint_abort();
+        }
+
+        flint_cleanup();
+
+        if (n_randint(state, 2))
+        {
+            n2 = n_randint(state, bound);
+            bernoulli_cache_compute(n2);
+        }
+
+        n2 = bernoulli_cache_num;
+
+        rewind(file);
+
+        if (!bernoulli_cache_inp_raw(file))
+        {
+            flint_printf("FAIL: inp_raw\n");
+            flint_abort();
+        }
+
+        fclose(file);
+
+        if (bernoulli_cache_num != FLINT_MAX(n1, n2) || !check_cache(bernoulli_cache_num, A))
+        {
+            flint_printf("FAIL: read back\n");
+            flint_printf("n1 = %wd, n2 = %wd, num = %wd\n", n1, n2, bernoulli_cache_num);
+            flint_abort();
+        }
+    }
+
+    /* corrupt files are rejected */
+    for (iter = 0; iter < 10 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        FILE * file;
+        fmpz_t t;
+        slong i, k, n;
+
+        flint_set_num_threads(1);
+        flint_cleanup();
+
+        n = 4 + n_randint(state, bound);
+        bernoulli_cache_compute(n);
+        n = bernoulli_cache_num;
+
+        /* flip the sign of a random entry, or change the last nonzero one */
+        if (n_randint(state, 2))
+            k = 2 + 2 * n_randint(state, (n - 1) / 2);
+        else
+            k = (n - 1) & ~WORD(1);
+
+        file = tmpfile();
+
+        if (file == NULL)
+        {
+            flint_printf("FAIL: tmpfile\n");
+            flint_abort();
+        }
+
+        fmpz_init_set_si(t, n);
+        fmpz_out_raw(file, t);
+
+        for (i = 0; i < n; i++)
+        {
+            fmpz_set(t, fmpq_numref(bernoulli_cache + i));
+
+            if (i == k)
+            {
+                if (k == ((n - 1) & ~WORD(1)))
+                    fmpz_add_ui(t, t, 2);
+                else
+                    fmpz_neg(t, t);
+            }
+
+            fmpz_out_raw(file, t);
+            fmpz_out_raw(file, fmpq_denref(bernoulli_cache + i));
+        }
+
+        fmpz_clear(t);
+
+        flint_cleanup();
+        rewind(file);
+
+        if (bernoulli_cache_inp_raw(file) || bernoulli_cache_num != 0)
+        {
+            flint_printf("FAIL: corrupt file accepted\n");
+            flint_printf("n = %wd, k = %wd, num = %wd\n", n, k, bernoulli_cache_num);
+            flint_abort();
+        }
+
+        fclose(file);
+    }
+
+    nmod_poly_clear(A);
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
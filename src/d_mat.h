@@ -128,6 +128,11 @@ void d_mat_transpose(d_mat_t B, const d_mat_t A);
 
 void d_mat_mul_classical(d_mat_t C, const d_mat_t A, const d_mat_t B);
 
+void _d_mat_addmul_transpose(double * const * C, double * const * A,
+                        double * const * Bt, slong m, slong k, slong n, int sub);
+
+void d_mat_mul(d_mat_t C, const d_mat_t A, const d_mat_t B);
+
 /* Permutations */
 
 D_MAT_INLINE
@@ -143,6 +148,12 @@ void d_mat_swap_rows(d_mat_t mat, slong r, slong s)
     }
 }
 
+/* LU decomposition and solving  *********************************************/
+
+int d_mat_lu(slong * P, d_mat_t LU, const d_mat_t A);
+
+void d_mat_solve_lu_precomp(d_mat_t X, const slong * P, const d_mat_t LU, const d_mat_t B);
+
 /* Gram-Schmidt Orthogonalisation and QR Decomposition  ********************************************************/
 
 void d_mat_gso(d_mat_t B, const d_mat_t A);
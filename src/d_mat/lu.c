@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "d_mat.h"
+
+/* Width of the column panels. */
+#define NB 32
+
+int
+d_mat_lu(slong * P, d_mat_t LU, const d_mat_t A)
+{
+    slong n, i, j, k, r, c, j0, j1, nb, m2;
+    double ** rows;
+    double t, best;
+
+    n = A->r;
+
+    if (A->c != n || LU->r != n || LU->c != n)
+    {
+        flint_printf("Exception (d_mat_lu). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    d_mat_set(LU, A);
+    rows = LU->rows;
+
+    for (i = 0; i < n; i++)
+        P[i] = i;
+
+    for (j0 = 0; j0 < n; j0 += NB)
+    {
+        j1 = FLINT_MIN(j0 + NB, n);
+        nb = j1 - j0;
+
+        /* Factor the panel of columns [j0, j1) with partial pivoting.
+           Row swaps are applied to entire rows. */
+        for (c = j0; c < j1; c++)
+        {
+            r = c;
+            best = fabs(rows[c][c]);
+
+            for (i = c + 1; i < n; i++)
+            {
+                if (fabs(rows[i][c]) > best)
+                {
+                    best = fabs(rows[i][c]);
+                    r = i;
+                }
+            }
+
+            if (best == 0.0)
+                return 0;
+
+            if (r != c)
+            {
+                d_mat_swap_rows(LU, c, r);
+                SLONG_SWAP(P[c], P[r]);
+            }
+
+            t = 1.0 / rows[c][c];
+
+            for (i = c + 1; i < n; i++)
+            {
+                double * ri = rows[i];
+                const double * rc = rows[c];
+
+                ri[c] *= t;
+
+                for (k = c + 1; k < j1; k++)
+                    ri[k] -= ri[c] * rc[k];
+            }
+        }
+
+        if (j1 == n)
+            break;
+
+        /* U12 = L11^(-1) A12 */
+        for (i = j0 + 1; i < j1; i++)
+        {
+            double * ri = rows[i];
+
+            for (j = j0; j < i; j++)
+            {
+                const double * rj = rows[j];
+                t = ri[j];
+
+                for (k = j1; k < n; k++)
+                    ri[k] -= t * rj[k];
+            }
+        }
+
+        /* A22 -= L21 U12, using the blocked multiplication kernel */
+        m2 = n - j1;
+        {
+            d_mat_t U12t;
+            double ** Crows, ** Arows;
+
+            d_mat_init(U12t, m2, nb);
+            Crows = flint_malloc(sizeof(double *) * 2 * m2);
+            Arows = Crows + m2;
+
+            for (i = 0; i < nb; i++)
+                for (j = 0; j < m2; j++)
+                    d_mat_entry(U12t, j, i) = rows[j0 + i][j1 + j];
+
+            for (i = 0; i < m2; i++)
+            {
+                Crows[i] = rows[j1 + i] + j1;
+                Arows[i] = rows[j1 + i] + j0;
+            }
+
+            _d_mat_addmul_transpose(Crows, Arows, U12t->rows, m2, nb, m2, 1);
+
+            flint_free(Crows);
+            d_mat_clear(U12t);
+        }
+    }
+
+    return 1;
+}
@@ -0,0 +1,146 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "d_mat.h"
+
+/* Length of the panels along the inner dimension; a 4 x KC panel of A
+   and of B^T fit comfortably in L1 together. */
+#define KC 256
+
+/* Number of rows of B^T (columns of B) processed while a panel of A
+   stays in L2. */
+#define NC 128
+
+/* C[i][j] += sign * sum_k A[i][k] * Bt[j][k] for a 4 x 4 tile; the
+   sixteen independent accumulators allow the compiler to vectorize
+   and pipeline the multiplications. */
+static void
+_d_mat_kernel_4x4(double * const * C, double * const * A, double * const * Bt,
+                  slong i, slong j, slong k0, slong k1, double sign)
+{
+    double c00 = 0, c01 = 0, c02 = 0, c03 = 0;
+    double c10 = 0, c11 = 0, c12 = 0, c13 = 0;
+    double c20 = 0, c21 = 0, c22 = 0, c23 = 0;
+    double c30 = 0, c31 = 0, c32 = 0, c33 = 0;
+    const double * a0 = A[i], * a1 = A[i + 1], * a2 = A[i + 2], * a3 = A[i + 3];
+    const double * b0 = Bt[j], * b1 = Bt[j + 1], * b2 = Bt[j + 2], * b3 = Bt[j + 3];
+    slong k;
+
+    for (k = k0; k < k1; k++)
+    {
+        double x0 = a0[k], x1 = a1[k], x2 = a2[k], x3 = a3[k];
+        double y0 = b0[k], y1 = b1[k], y2 = b2[k], y3 = b3[k];
+
+        c00 += x0 * y0; c01 += x0 * y1; c02 += x0 * y2; c03 += x0 * y3;
+        c10 += x1 * y0; c11 += x1 * y1; c12 += x1 * y2; c13 += x1 * y3;
+        c20 += x2 * y0; c21 += x2 * y1; c22 += x2 * y2; c23 += x2 * y3;
+        c30 += x3 * y0; c31 += x3 * y1; c32 += x3 * y2; c33 += x3 * y3;
+    }
+
+    C[i][j] += sign * c00; C[i][j + 1] += sign * c01;
+    C[i][j + 2] += sign * c02; C[i][j + 3] += sign * c03;
+    C[i + 1][j] += sign * c10; C[i + 1][j + 1] += sign * c11;
+    C[i + 1][j + 2] += sign * c12; C[i + 1][j + 3] += sign * c13;
+    C[i + 2][j] += sign * c20; C[i + 2][j + 1] += sign * c21;
+    C[i + 2][j + 2] += sign * c22; C[i + 2][j + 3] += sign * c23;
+    C[i + 3][j] += sign * c30; C[i + 3][j + 1] += sign * c31;
+    C[i + 3][j + 2] += sign * c32; C[i + 3][j + 3] += sign * c33;
+}
+
+void
+_d_mat_addmul_transpose(double * const * C, double * const * A,
+                        double * const * Bt, slong m, slong k, slong n, int sub)
+{
+    slong ii, jj, kk, i, j, l, k1, j1;
+    double sign = sub ? -1.0 : 1.0;
+    double t;
+
+    for (kk = 0; kk < k; kk += KC)
+    {
+        k1 = FLINT_MIN(kk + KC, k);
+
+        for (jj = 0; jj < n; jj += NC)
+        {
+            j1 = FLINT_MIN(jj + NC, n);
+
+            for (ii = 0; ii + 4 <= m; ii += 4)
+            {
+                for (j = jj; j + 4 <= j1; j += 4)
+                    _d_mat_kernel_4x4(C, A, Bt, ii, j, kk, k1, sign);
+
+                /* leftover columns */
+                for ( ; j < j1; j++)
+                {
+                    for (i = ii; i < ii + 4; i++)
+                    {
+                        t = 0;
+                        for (l = kk; l < k1; l++)
+                            t += A[i][l] * Bt[j][l];
+                        C[i][j] += sign * t;
+                    }
+                }
+            }
+
+            /* leftover rows */
+            for (i = ii; i < m; i++)
+            {
+                for (j = jj; j < j1; j++)
+                {
+                    t = 0;
+                    for (l = kk; l < k1; l++)
+                        t += A[i][l] * Bt[j][l];
+                    C[i][j] += sign * t;
+                }
+            }
+        }
+    }
+}
+
+void
+d_mat_mul(d_mat_t C, const d_mat_t A, const d_mat_t B)
+{
+    slong ar, br, bc;
+    d_mat_t Bt;
+
+    ar = A->r;
+    br = B->r;
+    bc = B->c;
+
+    if (C == A || C == B)
+    {
+        d_mat_t t;
+        d_mat_init(t, ar, bc);
+        d_mat_mul(t, A, B);
+        d_mat_swap_entrywise(C, t);
+        d_mat_clear(t);
+        return;
+    }
+
+    if (C->r != ar || C->c != bc || A->c != br)
+    {
+        flint_printf("Exception (d_mat_mul). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (ar < 8 || br < 8 || bc < 8)
+    {
+        d_mat_mul_classical(C, A, B);
+        return;
+    }
+
+    d_mat_init(Bt, bc, br);
+    d_mat_transpose(Bt, B);
+    d_mat_zero(C);
+
+    _d_mat_addmul_transpose(C->rows, A->rows, Bt->rows, ar, br, bc, 0);
+
+    d_mat_clear(Bt);
+}
@@ -0,0 +1,73 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "d_vec.h"
+#include "d_mat.h"
+
+void
+d_mat_solve_lu_precomp(d_mat_t X, const slong * P, const d_mat_t LU, const d_mat_t B)
+{
+    slong n, m, i, j, k;
+    d_mat_t T;
+
+    n = LU->r;
+    m = B->c;
+
+    if (X->r != n || X->c != m || B->r != n)
+    {
+        flint_printf("Exception (d_mat_solve_lu_precomp). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (n == 0 || m == 0)
+        return;
+
+    d_mat_init(T, n, m);
+
+    for (i = 0; i < n; i++)
+        _d_vec_set(T->rows[i], B->rows[P[i]], m);
+
+    /* forward substitution with the unit lower triangular factor */
+    for (i = 1; i < n; i++)
+    {
+        for (j = 0; j < i; j++)
+        {
+            double t = d_mat_entry(LU, i, j);
+
+            if (t != 0.0)
+                for (k = 0; k < m; k++)
+                    T->rows[i][k] -= t * T->rows[j][k];
+        }
+    }
+
+    /* backward substitution with the upper triangular factor */
+    for (i = n - 1; i >= 0; i--)
+    {
+        double t;
+
+        for (j = i + 1; j < n; j++)
+        {
+            t = d_mat_entry(LU, i, j);
+
+            if (t != 0.0)
+                for (k = 0; k < m; k++)
+                    T->rows[i][k] -= t * T->rows[j][k];
+        }
+
+        t = 1.0 / d_mat_entry(LU, i, i);
+
+        for (k = 0; k < m; k++)
+            T->rows[i][k] *= t;
+    }
+
+    d_mat_swap_entrywise(X, T);
+    d_mat_clear(T);
+}
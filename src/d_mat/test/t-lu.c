@@ -0,0 +1,144 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "flint.h"
+#include "d_mat.h"
+#include "ulong_extras.h"
+
+#define D_MAT_LU_EPS (1e-10)
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lu....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        d_mat_t A, LU, L, U, PA, LU2, X, B, AX;
+        slong * P;
+        slong n, m, i, j;
+        double xmax, err;
+
+        n = n_randint(state, 100);
+        m = n_randint(state, 10);
+
+        d_mat_init(A, n, n);
+        d_mat_init(LU, n, n);
+        d_mat_init(L, n, n);
+        d_mat_init(U, n, n);
+        d_mat_init(PA, n, n);
+        d_mat_init(LU2, n, n);
+        d_mat_init(X, n, m);
+        d_mat_init(B, n, m);
+        d_mat_init(AX, n, m);
+        P = flint_malloc(sizeof(slong) * FLINT_MAX(n, 1));
+
+        d_mat_randtest(A, state, 0, 0);
+        d_mat_randtest(B, state, 0, 0);
+
+        /* a random matrix is nonsingular with overwhelming probability */
+        if (!d_mat_lu(P, LU, A))
+        {
+            flint_printf("FAIL: singular\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                d_mat_entry(PA, i, j) = d_mat_entry(A, P[i], j);
+
+                if (i > j)
+                    d_mat_entry(L, i, j) = d_mat_entry(LU, i, j);
+                else
+                    d_mat_entry(U, i, j) = d_mat_entry(LU, i, j);
+
+                if (i == j)
+                    d_mat_entry(L, i, j) = 1.0;
+
+                /* partial pivoting */
+                if (i > j && fabs(d_mat_entry(LU, i, j)) > 1.0)
+                {
+                    flint_printf("FAIL: pivoting\n");
+                    flint_abort();
+                }
+            }
+        }
+
+        d_mat_mul_classical(LU2, L, U);
+
+        if (!d_mat_approx_equal(PA, LU2, D_MAT_LU_EPS))
+        {
+            flint_printf("FAIL: PA != LU\n");
+            flint_printf("n = %wd\n", n);
+            flint_abort();
+        }
+
+        d_mat_solve_lu_precomp(X, P, LU, B);
+        d_mat_mul_classical(AX, A, X);
+
+        xmax = 1.0;
+        err = 0.0;
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < m; j++)
+            {
+                xmax = FLINT_MAX(xmax, fabs(d_mat_entry(X, i, j)));
+                err = FLINT_MAX(err, fabs(d_mat_entry(AX, i, j) - d_mat_entry(B, i, j)));
+            }
+        }
+
+        if (err > D_MAT_LU_EPS * xmax)
+        {
+            flint_printf("FAIL: AX != B\n");
+            flint_printf("n = %wd, m = %wd, err = %g\n", n, m, err);
+            flint_abort();
+        }
+
+        /* aliasing */
+        d_mat_solve_lu_precomp(B, P, LU, B);
+
+        if (!d_mat_equal(B, X))
+        {
+            flint_printf("FAIL: aliasing\n");
+            flint_abort();
+        }
+
+        d_mat_lu(P, A, A);
+
+        if (!d_mat_equal(A, LU))
+        {
+            flint_printf("FAIL: aliasing (lu)\n");
+            flint_abort();
+        }
+
+        d_mat_clear(A);
+        d_mat_clear(LU);
+        d_mat_clear(L);
+        d_mat_clear(U);
+        d_mat_clear(PA);
+        d_mat_clear(LU2);
+        d_mat_clear(X);
+        d_mat_clear(B);
+        d_mat_clear(AX);
+        flint_free(P);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
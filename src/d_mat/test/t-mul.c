@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "d_mat.h"
+#include "ulong_extras.h"
+
+#define D_MAT_MUL_EPS (1e-11)
+
+int
+main(void)
+{
+    d_mat_t A, B, C, D;
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    /* compare with classical multiplication */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        slong m, n, k;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 300);
+        k = n_randint(state, 150);
+
+        d_mat_init(A, m, n);
+        d_mat_init(B, n, k);
+        d_mat_init(C, m, k);
+        d_mat_init(D, m, k);
+
+        d_mat_randtest(A, state, 0, 0);
+        d_mat_randtest(B, state, 0, 0);
+        d_mat_randtest(C, state, 0, 0);
+
+        d_mat_mul(C, A, B);
+        d_mat_mul_classical(D, A, B);
+
+        if (!d_mat_approx_equal(C, D, D_MAT_MUL_EPS))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, n = %wd, k = %wd\n", m, n, k);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (n == k)
+        {
+            d_mat_mul(A, A, B);
+
+            if (!d_mat_equal(A, C))
+            {
+                flint_printf("FAIL: aliasing failed\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        d_mat_clear(A);
+        d_mat_clear(B);
+        d_mat_clear(C);
+        d_mat_clear(D);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef ECPP_H
+#define ECPP_H
+
+#include <stdio.h>
+#include "fmpz_types.h"
+#include "fmpz_mod_types.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* One step of a certificate: the curve y^2 = x^3 + a x + b over Z/NZ and
+   the point (x, y) of order q, where q | m and m is the curve order. */
+typedef struct
+{
+    fmpz N;
+    fmpz a;
+    fmpz b;
+    fmpz m;
+    fmpz q;
+    fmpz x;
+    fmpz y;
+    slong D;
+}
+ecpp_step_struct;
+
+typedef struct
+{
+    ecpp_step_struct * steps;
+    slong length;
+    slong alloc;
+}
+ecpp_cert_struct;
+
+typedef ecpp_cert_struct ecpp_cert_t[1];
+
+/* Certificates */
+
+void ecpp_cert_init(ecpp_cert_t cert);
+
+void ecpp_cert_clear(ecpp_cert_t cert);
+
+void ecpp_cert_fit_length(ecpp_cert_t cert, slong len);
+
+int ecpp_cert_fprint(FILE * file, const ecpp_cert_t cert);
+
+int ecpp_cert_print(const ecpp_cert_t cert);
+
+int ecpp_cert_fread(FILE * file, ecpp_cert_t cert);
+
+int ecpp_cert_verify_step(const ecpp_step_struct * step);
+
+int ecpp_cert_verify(const ecpp_cert_t cert, const fmpz_t n);
+
+/* Elliptic curve arithmetic in projective coordinates */
+
+void _ecpp_point_add(fmpz * R, const fmpz * P, const fmpz * Q,
+        const fmpz_t a, const fmpz_t b3, const fmpz_mod_ctx_t ctx);
+
+void _ecpp_point_mul(fmpz * R, const fmpz * P, const fmpz_t e,
+        const fmpz_t a, const fmpz_t b3, const fmpz_mod_ctx_t ctx);
+
+/* Complex multiplication */
+
+int _ecpp_cornacchia(fmpz_t u, fmpz_t v, const fmpz_t N, slong D);
+
+/* Primality proving */
+
+int ecpp_is_prime_cert(ecpp_cert_t cert, const fmpz_t n);
+
+int ecpp_is_prime(const fmpz_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
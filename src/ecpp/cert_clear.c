@@ -0,0 +1,34 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "ecpp.h"
+
+void
+ecpp_cert_clear(ecpp_cert_t cert)
+{
+    slong i;
+
+    for (i = 0; i < cert->alloc; i++)
+    {
+        ecpp_step_struct * step = cert->steps + i;
+
+        fmpz_clear(&step->N);
+        fmpz_clear(&step->a);
+        fmpz_clear(&step->b);
+        fmpz_clear(&step->m);
+        fmpz_clear(&step->q);
+        fmpz_clear(&step->x);
+        fmpz_clear(&step->y);
+    }
+
+    flint_free(cert->steps);
+}
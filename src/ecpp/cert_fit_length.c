@@ -0,0 +1,42 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "ecpp.h"
+
+void
+ecpp_cert_fit_length(ecpp_cert_t cert, slong len)
+{
+    slong i;
+
+    if (len > cert->alloc)
+    {
+        len = FLINT_MAX(len, 2 * cert->alloc);
+
+        cert->steps = flint_realloc(cert->steps, sizeof(ecpp_step_struct) * len);
+
+        for (i = cert->alloc; i < len; i++)
+        {
+            ecpp_step_struct * step = cert->steps + i;
+
+            fmpz_init(&step->N);
+            fmpz_init(&step->a);
+            fmpz_init(&step->b);
+            fmpz_init(&step->m);
+            fmpz_init(&step->q);
+            fmpz_init(&step->x);
+            fmpz_init(&step->y);
+            step->D = 0;
+        }
+
+        cert->alloc = len;
+    }
+}
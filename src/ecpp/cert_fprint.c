@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "fmpz.h"
+#include "ecpp.h"
+
+/*
+    The certificate is written as the number of steps followed by one line
+    per step containing N, a, b, m, q, x, y and D in decimal.
+*/
+int
+ecpp_cert_fprint(FILE * file, const ecpp_cert_t cert)
+{
+    slong i;
+    int r;
+
+    r = flint_fprintf(file, "%wd\n", cert->length);
+
+    for (i = 0; i < cert->length && r > 0; i++)
+    {
+        const ecpp_step_struct * step = cert->steps + i;
+
+        r = fmpz_fprint(file, &step->N);
+        if (r > 0) r = fputc(' ', file);
+        if (r > 0) r = fmpz_fprint(file, &step->a);
+        if (r > 0) r = fputc(' ', file);
+        if (r > 0) r = fmpz_fprint(file, &step->b);
+        if (r > 0) r = fputc(' ', file);
+        if (r > 0) r = fmpz_fprint(file, &step->m);
+        if (r > 0) r = fputc(' ', file);
+        if (r > 0) r = fmpz_fprint(file, &step->q);
+        if (r > 0) r = fputc(' ', file);
+        if (r > 0) r = fmpz_fprint(file, &step->x);
+        if (r > 0) r = fputc(' ', file);
+        if (r > 0) r = fmpz_fprint(file, &step->y);
+        if (r > 0) r = flint_fprintf(file, " %wd\n", step->D);
+    }
+
+    return r > 0;
+}
+
+int
+ecpp_cert_print(const ecpp_cert_t cert)
+{
+    return ecpp_cert_fprint(stdout, cert);
+}
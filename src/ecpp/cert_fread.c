@@ -0,0 +1,61 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "fmpz.h"
+#include "ecpp.h"
+
+int
+ecpp_cert_fread(FILE * file, ecpp_cert_t cert)
+{
+    slong i, len;
+    fmpz_t t;
+    int r;
+
+    fmpz_init(t);
+
+    r = fmpz_fread(file, t) > 0 && fmpz_sgn(t) >= 0 && fmpz_fits_si(t);
+
+    if (r)
+    {
+        len = fmpz_get_si(t);
+        cert->length = 0;
+
+        /* grow the steps as they are read, so that a corrupt length
+           does not trigger a huge allocation */
+        for (i = 0; i < len && r; i++)
+        {
+            ecpp_step_struct * step;
+
+            ecpp_cert_fit_length(cert, i + 1);
+            step = cert->steps + i;
+
+            r = fmpz_fread(file, &step->N) > 0
+                && fmpz_fread(file, &step->a) > 0
+                && fmpz_fread(file, &step->b) > 0
+                && fmpz_fread(file, &step->m) > 0
+                && fmpz_fread(file, &step->q) > 0
+                && fmpz_fread(file, &step->x) > 0
+                && fmpz_fread(file, &step->y) > 0
+                && fmpz_fread(file, t) > 0 && fmpz_fits_si(t);
+
+            if (r)
+            {
+                step->D = fmpz_get_si(t);
+                cert->length = i + 1;
+            }
+        }
+    }
+
+    fmpz_clear(t);
+
+    return r;
+}
@@ -0,0 +1,21 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "ecpp.h"
+
+void
+ecpp_cert_init(ecpp_cert_t cert)
+{
+    cert->steps = NULL;
+    cert->length = 0;
+    cert->alloc = 0;
+}
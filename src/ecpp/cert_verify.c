@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "ecpp.h"
+
+typedef struct
+{
+    const ecpp_step_struct * steps;
+    int * ok;
+}
+work_t;
+
+static void
+worker(slong i, work_t * work)
+{
+    work->ok[i] = ecpp_cert_verify_step(work->steps + i);
+}
+
+int
+ecpp_cert_verify(const ecpp_cert_t cert, const fmpz_t n)
+{
+    const fmpz * last;
+    work_t work;
+    slong i;
+    int res;
+
+    if (cert->length == 0)
+        last = n;
+    else
+        last = &cert->steps[cert->length - 1].q;
+
+    /* the chain N_0 = n, N_{i+1} = q_i must end in a word-sized prime */
+    if (fmpz_cmp_ui(last, 1) <= 0 || !fmpz_abs_fits_ui(last) || !n_is_prime(fmpz_get_ui(last)))
+        return 0;
+
+    for (i = 0; i < cert->length; i++)
+        if (!fmpz_equal(&cert->steps[i].N, (i == 0) ? n : &cert->steps[i - 1].q))
+            return 0;
+
+    /* the steps are independent */
+    work.steps = cert->steps;
+    work.ok = flint_malloc(sizeof(int) * FLINT_MAX(cert->length, 1));
+
+    flint_parallel_do((do_func_t) worker, &work, cert->length, -1, FLINT_PARALLEL_STRIDED);
+
+    res = 1;
+    for (i = 0; i < cert->length; i++)
+        res = res && work.ok[i];
+
+    flint_free(work.ok);
+
+    return res;
+}
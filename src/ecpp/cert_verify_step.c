@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod.h"
+#include "ecpp.h"
+
+/*
+    Checks one step of a certificate using the theorem of Goldwasser, Kilian
+    and Atkin: if gcd(N, 6) = 1, the curve is nonsingular modulo N, q is prime
+    with q > (N^(1/4) + 1)^2, and the point Q = [m/q] P satisfies Q != O and
+    [q] Q = O modulo every prime p | N, then N is prime. Both conditions on Q
+    are checked modulo all p | N at once by requiring that the Z coordinate
+    of Q is invertible modulo N while [q] Q = (0 : Y : 0) with Y invertible
+    modulo N. Since the exceptional result (0 : 0 : 0) of _ecpp_point_add is
+    never invertible, this also rules out exceptional additions.
+*/
+int
+ecpp_cert_verify_step(const ecpp_step_struct * step)
+{
+    const fmpz * N = &step->N;
+    fmpz_mod_ctx_t ctx;
+    fmpz_t a, b, b3, t, u, k;
+    fmpz * P;
+    fmpz * Q;
+    int res;
+
+    if (fmpz_cmp_ui(N, 3) <= 0 || fmpz_is_even(N) || fmpz_fdiv_ui(N, 3) == 0)
+        return 0;
+
+    if (fmpz_sgn(&step->q) <= 0 || fmpz_sgn(&step->m) <= 0 || !fmpz_divisible(&step->m, &step->q))
+        return 0;
+
+    fmpz_mod_ctx_init(ctx, N);
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(b3);
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(k);
+    P = _fmpz_vec_init(3);
+    Q = _fmpz_vec_init(3);
+
+    res = 1;
+
+    /* q > (floor(N^(1/4)) + 2)^2 >= (N^(1/4) + 1)^2 */
+    fmpz_root(t, N, 4);
+    fmpz_add_ui(t, t, 2);
+    fmpz_mul(t, t, t);
+    if (fmpz_cmp(&step->q, t) <= 0)
+        res = 0;
+
+    fmpz_mod(a, &step->a, N);
+    fmpz_mod(b, &step->b, N);
+    fmpz_mod(P + 0, &step->x, N);
+    fmpz_mod(P + 1, &step->y, N);
+    fmpz_one(P + 2);
+
+    /* 4 a^3 + 27 b^2 must be invertible */
+    if (res)
+    {
+        fmpz_mod_mul(t, a, a, ctx);
+        fmpz_mod_mul(t, t, a, ctx);
+        fmpz_mod_mul_ui(t, t, 4, ctx);
+        fmpz_mod_mul(u, b, b, ctx);
+        fmpz_mod_mul_ui(u, u, 27, ctx);
+        fmpz_mod_add(t, t, u, ctx);
+        fmpz_gcd(t, t, N);
+        res = fmpz_is_one(t);
+    }
+
+    /* the point must lie on the curve */
+    if (res)
+    {
+        fmpz_mod_mul(t, P + 0, P + 0, ctx);
+        fmpz_mod_add(t, t, a, ctx);
+        fmpz_mod_mul(t, t, P + 0, ctx);
+        fmpz_mod_add(t, t, b, ctx);
+        fmpz_mod_mul(u, P + 1, P + 1, ctx);
+        res = fmpz_equal(t, u);
+    }
+
+    if (res)
+    {
+        fmpz_mod_mul_ui(b3, b, 3, ctx);
+        fmpz_divexact(k, &step->m, &step->q);
+
+        _ecpp_point_mul(Q, P, k, a, b3, ctx);
+        fmpz_gcd(t, Q + 2, N);
+        res = fmpz_is_one(t);
+
+        if (res)
+        {
+            _ecpp_point_mul(Q, Q, &step->q, a, b3, ctx);
+            fmpz_gcd(t, Q + 1, N);
+            res = fmpz_is_zero(Q + 2) && fmpz_is_one(t);
+        }
+    }
+
+    fmpz_mod_ctx_clear(ctx);
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(b3);
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(k);
+    _fmpz_vec_clear(P, 3);
+    _fmpz_vec_clear(Q, 3);
+
+    return res;
+}
@@ -0,0 +1,74 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "ecpp.h"
+
+/*
+    Modified Cornacchia algorithm: solves 4 N = u^2 + |D| v^2 for a prime N,
+    returning 0 if no solution was found.
+*/
+int
+_ecpp_cornacchia(fmpz_t u, fmpz_t v, const fmpz_t N, slong D)
+{
+    fmpz_t a, b, r, L;
+    int res = 0;
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(r);
+    fmpz_init(L);
+
+    /* b = sqrt(D) mod N with b = D mod 2 */
+    fmpz_set_si(a, D);
+    fmpz_mod(a, a, N);
+
+    if (fmpz_sqrtmod(b, a, N))
+    {
+        if (fmpz_is_odd(b) != (D & 1))
+            fmpz_sub(b, N, b);
+
+        /* Euclid on (2N, b) until b < L = floor(2 sqrt(N)) */
+        fmpz_mul_2exp(a, N, 1);
+        fmpz_mul_2exp(L, N, 2);
+        fmpz_sqrt(L, L);
+
+        while (fmpz_cmp(b, L) > 0)
+        {
+            fmpz_mod(r, a, b);
+            fmpz_swap(a, b);
+            fmpz_swap(b, r);
+        }
+
+        /* v^2 = (4N - b^2) / |D| */
+        fmpz_mul_2exp(a, N, 2);
+        fmpz_submul(a, b, b);
+
+        if (fmpz_sgn(a) >= 0 && fmpz_fdiv_ui(a, -D) == 0)
+        {
+            fmpz_divexact_ui(a, a, -D);
+
+            if (fmpz_is_square(a))
+            {
+                fmpz_sqrt(v, a);
+                fmpz_set(u, b);
+                res = 1;
+            }
+        }
+    }
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(r);
+    fmpz_clear(L);
+
+    return res;
+}
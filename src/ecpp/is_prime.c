@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "ecpp.h"
+
+int
+ecpp_is_prime(const fmpz_t n)
+{
+    ecpp_cert_t cert;
+    int res;
+
+    ecpp_cert_init(cert);
+    res = ecpp_is_prime_cert(cert, n);
+    ecpp_cert_clear(cert);
+
+    if (res == -1)
+    {
+        flint_printf("Exception (ecpp_is_prime). Failed to prove n prime.\n");
+        fmpz_print(n); flint_printf("\n");
+        flint_abort();
+    }
+
+    return res;
+}
@@ -0,0 +1,447 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod.h"
+#include "fmpz_mod_poly.h"
+#include "fmpz_mod_poly_factor.h"
+#include "acb_modular.h"
+#include "ecpp.h"
+
+/* curve orders are trial divided by the primes below 2^15 */
+#define ECPP_TRIAL_PRIMES 3512
+
+/* CM discriminants are taken from -7 down to -ECPP_MAX_DISC */
+#define ECPP_MAX_DISC 1000000
+
+/* bounds the degree of the Hilbert class polynomials */
+#define ECPP_MAX_CLASS_NUMBER 48
+
+/* rounds of random points tried on each pair of twists */
+#define ECPP_POINT_TRIES 4
+
+static int
+is_fundamental_discriminant(slong D)
+{
+    ulong d = -D;
+
+    if (d % 4 == 3)
+        return n_is_squarefree(d);
+
+    if (d % 4 == 0)
+    {
+        d /= 4;
+        return (d % 4 == 1 || d % 4 == 2) && n_is_squarefree(d);
+    }
+
+    return 0;
+}
+
+/* class numbers are computed for blocks of this many discriminants */
+#define ECPP_DISC_BLOCK 4096
+
+/*
+    Sets h[i] to the number of reduced forms (a, b, c) of discriminant
+    -(lo + i) for 0 <= i < len, that is, to the class number when -(lo + i)
+    is a fundamental discriminant. The forms satisfy |b| <= a <= c, with
+    b >= 0 if |b| = a or a = c, so that a <= sqrt(|D| / 3).
+*/
+static void
+_ecpp_class_numbers(slong * h, ulong lo, slong len)
+{
+    ulong hi, a, c, d;
+    slong b, i;
+
+    hi = lo + len;
+
+    for (i = 0; i < len; i++)
+        h[i] = 0;
+
+    for (a = 1; 3 * a * a < hi; a++)
+    {
+        for (b = 1 - (slong) a; b <= (slong) a; b++)
+        {
+            /* smallest c >= a with 4ac - b^2 >= lo */
+            c = (lo + b * b + 4 * a - 1) / (4 * a);
+            c = FLINT_MAX(c, a);
+
+            for ( ; (d = 4 * a * c - b * b) < hi; c++)
+            {
+                if (b < 0 && c == a)
+                    continue;
+
+                h[d - lo]++;
+            }
+        }
+    }
+}
+
+/*
+    The candidate discriminants: the fundamental discriminants D, from -5
+    downwards, whose class number is at most ECPP_MAX_CLASS_NUMBER. The
+    table is extended when needed, so that class numbers are computed once
+    for all the steps of the downrun.
+*/
+typedef struct
+{
+    slong * D;
+    slong length;
+    slong alloc;
+    ulong scanned;  /* all D with |D| < scanned have been considered */
+}
+ecpp_disc_table_struct;
+
+typedef struct
+{
+    ulong lo;
+    slong * h;
+}
+class_number_work_t;
+
+static void
+class_number_worker(slong j, class_number_work_t * work)
+{
+    _ecpp_class_numbers(work->h + j * ECPP_DISC_BLOCK,
+        work->lo + j * ECPP_DISC_BLOCK, ECPP_DISC_BLOCK);
+}
+
+/* Extends the table by the discriminants in the next blocks. Returns 0
+   if all discriminants up to ECPP_MAX_DISC have been considered. */
+static int
+_ecpp_disc_table_extend(ecpp_disc_table_struct * tab)
+{
+    class_number_work_t work;
+    slong i, num_blocks;
+    ulong d;
+
+    if (tab->scanned >= ECPP_MAX_DISC)
+        return 0;
+
+    num_blocks = FLINT_MAX(flint_get_num_threads(), 1);
+
+    work.lo = tab->scanned;
+    work.h = flint_malloc(sizeof(slong) * num_blocks * ECPP_DISC_BLOCK);
+
+    flint_parallel_do((do_func_t) class_number_worker, &work, num_blocks,
+        -1, FLINT_PARALLEL_STRIDED);
+
+    for (i = 0; i < num_blocks * ECPP_DISC_BLOCK; i++)
+    {
+        d = work.lo + i;
+
+        if (d <= 4 || d >= ECPP_MAX_DISC)
+            continue;
+
+        if (work.h[i] <= ECPP_MAX_CLASS_NUMBER
+            && is_fundamental_discriminant(-(slong) d))
+        {
+            if (tab->length == tab->alloc)
+            {
+                tab->alloc = FLINT_MAX(2 * tab->alloc, 256);
+                tab->D = flint_realloc(tab->D, sizeof(slong) * tab->alloc);
+            }
+
+            tab->D[tab->length++] = -(slong) d;
+        }
+    }
+
+    tab->scanned = work.lo + num_blocks * ECPP_DISC_BLOCK;
+
+    flint_free(work.h);
+
+    return 1;
+}
+
+typedef struct
+{
+    slong D;
+    int found;
+    fmpz m;
+    fmpz q;
+}
+ecpp_candidate_t;
+
+typedef struct
+{
+    const fmpz * N;
+    const fmpz * bound;
+    const ulong * primes;
+    ecpp_candidate_t * cands;
+}
+search_work_t;
+
+/*
+    Checks whether N splits in the order of discriminant D and whether one
+    of the two possible curve orders m = N + 1 +- u is a product of small
+    primes and a probable prime q > bound.
+*/
+static void
+search_worker(slong i, search_work_t * work)
+{
+    ecpp_candidate_t * c = work->cands + i;
+    const fmpz * N = work->N;
+    fmpz_t t, u, v;
+    slong j, sign;
+
+    c->found = 0;
+
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(v);
+
+    fmpz_set_si(t, c->D);
+    fmpz_mod(t, t, N);
+
+    if (fmpz_jacobi(t, N) == 1 && _ecpp_cornacchia(u, v, N, c->D))
+    {
+        for (sign = 0; sign < 2 && !c->found; sign++)
+        {
+            fmpz_add_ui(&c->m, N, 1);
+
+            if (sign == 0)
+                fmpz_sub(&c->m, &c->m, u);
+            else
+                fmpz_add(&c->m, &c->m, u);
+
+            fmpz_set(&c->q, &c->m);
+
+            for (j = 0; j < ECPP_TRIAL_PRIMES; j++)
+            {
+                while (fmpz_fdiv_ui(&c->q, work->primes[j]) == 0)
+                    fmpz_divexact_ui(&c->q, &c->q, work->primes[j]);
+            }
+
+            c->found = fmpz_cmp(&c->q, work->bound) > 0
+                && fmpz_cmp(&c->q, N) < 0 && fmpz_is_probabprime(&c->q);
+        }
+    }
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(v);
+}
+
+/*
+    Constructs a curve with complex multiplication by the order of
+    discriminant D and a point proving N prime given that q is prime.
+    The curve is built from a root j of the Hilbert class polynomial;
+    since the order m only determines the curve up to quadratic twist,
+    both twists are tried.
+*/
+static int
+_ecpp_find_curve(ecpp_step_struct * step, const fmpz_t N, slong D,
+                    const fmpz_t m, const fmpz_t q)
+{
+    fmpz_poly_t H;
+    fmpz_mod_ctx_t ctx;
+    fmpz_mod_poly_t Hmod;
+    fmpz_mod_poly_factor_t roots;
+    fmpz_t j, k, c, t, x;
+    slong i, round, twist;
+    int found = 0;
+
+    fmpz_poly_init(H);
+    fmpz_mod_ctx_init(ctx, N);
+    fmpz_mod_poly_init(Hmod, ctx);
+    fmpz_mod_poly_factor_init(roots, ctx);
+    fmpz_init(j);
+    fmpz_init(k);
+    fmpz_init(c);
+    fmpz_init(t);
+    fmpz_init(x);
+
+    acb_modular_hilbert_class_poly(H, D);
+    fmpz_mod_poly_set_fmpz_poly(Hmod, H, ctx);
+    fmpz_mod_poly_roots(roots, Hmod, 0, ctx);
+
+    /* a quadratic nonresidue for the twist */
+    fmpz_set_ui(c, 2);
+    while (fmpz_jacobi(c, N) != -1)
+        fmpz_add_ui(c, c, 1);
+
+    fmpz_set(&step->N, N);
+    fmpz_set(&step->m, m);
+    fmpz_set(&step->q, q);
+    step->D = D;
+
+    for (i = 0; i < roots->num && !found; i++)
+    {
+        /* the factors are monic and linear */
+        fmpz_mod_neg(j, roots->poly[i].coeffs + 0, ctx);
+
+        if (fmpz_is_zero(j) || fmpz_equal_ui(j, 1728))
+            continue;
+
+        /* y^2 = x^3 + 3k x + 2k with k = j / (1728 - j) has invariant j */
+        fmpz_set_ui(t, 1728);
+        fmpz_mod_sub(t, t, j, ctx);
+        fmpz_mod_inv(t, t, ctx);
+        fmpz_mod_mul(k, j, t, ctx);
+
+        fmpz_zero(x);
+
+        for (round = 0; round < ECPP_POINT_TRIES && !found; round++)
+        {
+            fmpz_mod_mul_ui(&step->a, k, 3, ctx);
+            fmpz_mod_mul_ui(&step->b, k, 2, ctx);
+
+            for (twist = 0; twist < 2 && !found; twist++)
+            {
+                if (twist == 1)
+                {
+                    fmpz_mod_mul(t, c, c, ctx);
+                    fmpz_mod_mul(&step->a, &step->a, t, ctx);
+                    fmpz_mod_mul(t, t, c, ctx);
+                    fmpz_mod_mul(&step->b, &step->b, t, ctx);
+                }
+
+                /* find a point with x = x + 1, x + 2, ... */
+                do
+                {
+                    fmpz_add_ui(x, x, 1);
+                    fmpz_mod_mul(t, x, x, ctx);
+                    fmpz_mod_add(t, t, &step->a, ctx);
+                    fmpz_mod_mul(t, t, x, ctx);
+                    fmpz_mod_add(t, t, &step->b, ctx);
+                }
+                while (fmpz_jacobi(t, N) != 1);
+
+                fmpz_sqrtmod(&step->y, t, N);
+                fmpz_set(&step->x, x);
+
+                found = ecpp_cert_verify_step(step);
+            }
+        }
+    }
+
+    fmpz_poly_clear(H);
+    fmpz_mod_poly_clear(Hmod, ctx);
+    fmpz_mod_poly_factor_clear(roots, ctx);
+    fmpz_mod_ctx_clear(ctx);
+    fmpz_clear(j);
+    fmpz_clear(k);
+    fmpz_clear(c);
+    fmpz_clear(t);
+    fmpz_clear(x);
+
+    return found;
+}
+
+int
+ecpp_is_prime_cert(ecpp_cert_t cert, const fmpz_t n)
+{
+    ecpp_candidate_t * cands;
+    ecpp_disc_table_struct tab;
+    search_work_t work;
+    fmpz_t N, bound;
+    slong i, k, num, batch;
+    int res, found;
+
+    cert->length = 0;
+
+    if (fmpz_cmp_ui(n, 1) <= 0)
+        return 0;
+
+    if (fmpz_abs_fits_ui(n))
+        return n_is_prime(fmpz_get_ui(n));
+
+    if (!fmpz_is_probabprime(n))
+        return 0;
+
+    /* discriminants are tested in parallel batches */
+    batch = flint_get_num_threads();
+    cands = flint_malloc(sizeof(ecpp_candidate_t) * batch);
+
+    for (i = 0; i < batch; i++)
+    {
+        fmpz_init(&cands[i].m);
+        fmpz_init(&cands[i].q);
+    }
+
+    fmpz_init_set(N, n);
+    fmpz_init(bound);
+
+    work.N = N;
+    work.bound = bound;
+    work.primes = n_primes_arr_readonly(ECPP_TRIAL_PRIMES);
+    work.cands = cands;
+
+    tab.D = NULL;
+    tab.length = 0;
+    tab.alloc = 0;
+    tab.scanned = 0;
+
+    res = 1;
+
+    /* downrun: prove N prime given that a smaller q is prime */
+    while (res == 1 && !fmpz_abs_fits_ui(N))
+    {
+        ecpp_cert_fit_length(cert, cert->length + 1);
+
+        /* q > (floor(N^(1/4)) + 2)^2 */
+        fmpz_root(bound, N, 4);
+        fmpz_add_ui(bound, bound, 2);
+        fmpz_mul(bound, bound, bound);
+
+        found = 0;
+        k = 0;
+
+        while (!found && (k < tab.length || _ecpp_disc_table_extend(&tab)))
+        {
+            num = 0;
+
+            while (num < batch && k < tab.length)
+                cands[num++].D = tab.D[k++];
+
+            flint_parallel_do((do_func_t) search_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+
+            for (i = 0; i < num && !found; i++)
+            {
+                if (cands[i].found)
+                    found = _ecpp_find_curve(cert->steps + cert->length,
+                                N, cands[i].D, &cands[i].m, &cands[i].q);
+            }
+        }
+
+        if (found)
+        {
+            fmpz_set(N, &cert->steps[cert->length].q);
+            cert->length++;
+        }
+        else
+        {
+            res = -1;
+        }
+    }
+
+    /* q was only known to be a probable prime */
+    if (res == 1 && !n_is_prime(fmpz_get_ui(N)))
+        res = -1;
+
+    for (i = 0; i < batch; i++)
+    {
+        fmpz_clear(&cands[i].m);
+        fmpz_clear(&cands[i].q);
+    }
+
+    flint_free(cands);
+    flint_free(tab.D);
+    fmpz_clear(N);
+    fmpz_clear(bound);
+
+    if (res != 1)
+        cert->length = 0;
+
+    return res;
+}
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod.h"
+#include "ecpp.h"
+
+/*
+    Adds the points P = (X1 : Y1 : Z1) and Q = (X2 : Y2 : Z2) on
+    y^2 = x^3 + a x + b in projective coordinates, given b3 = 3 b.
+
+    This is Algorithm 1 of Renes, Costello and Batina, "Complete addition
+    formulas for prime order elliptic curves". Over a field the formulas
+    are correct for all inputs except when P - Q has order 2, in which case
+    the result is (0 : 0 : 0), and (0 : 0 : 0) is then preserved by all
+    further additions. Reducing a computation modulo N to any prime p | N
+    thus gives either the correct result over GF(p) or (0 : 0 : 0); this is
+    what makes certificate verification sound without knowing that N is
+    prime.
+*/
+void
+_ecpp_point_add(fmpz * R, const fmpz * P, const fmpz * Q,
+        const fmpz_t a, const fmpz_t b3, const fmpz_mod_ctx_t ctx)
+{
+    fmpz * t;
+    fmpz *X3, *Y3, *Z3;
+    const fmpz *X1 = P, *Y1 = P + 1, *Z1 = P + 2;
+    const fmpz *X2 = Q, *Y2 = Q + 1, *Z2 = Q + 2;
+
+    t = _fmpz_vec_init(9);
+    X3 = t + 6;
+    Y3 = t + 7;
+    Z3 = t + 8;
+
+    fmpz_mod_mul(t + 0, X1, X2, ctx);
+    fmpz_mod_mul(t + 1, Y1, Y2, ctx);
+    fmpz_mod_mul(t + 2, Z1, Z2, ctx);
+    fmpz_mod_add(t + 3, X1, Y1, ctx);
+    fmpz_mod_add(t + 4, X2, Y2, ctx);
+    fmpz_mod_mul(t + 3, t + 3, t + 4, ctx);
+    fmpz_mod_add(t + 4, t + 0, t + 1, ctx);
+    fmpz_mod_sub(t + 3, t + 3, t + 4, ctx);
+    fmpz_mod_add(t + 4, X1, Z1, ctx);
+    fmpz_mod_add(t + 5, X2, Z2, ctx);
+    fmpz_mod_mul(t + 4, t + 4, t + 5, ctx);
+    fmpz_mod_add(t + 5, t + 0, t + 2, ctx);
+    fmpz_mod_sub(t + 4, t + 4, t + 5, ctx);
+    fmpz_mod_add(t + 5, Y1, Z1, ctx);
+    fmpz_mod_add(X3, Y2, Z2, ctx);
+    fmpz_mod_mul(t + 5, t + 5, X3, ctx);
+    fmpz_mod_add(X3, t + 1, t + 2, ctx);
+    fmpz_mod_sub(t + 5, t + 5, X3, ctx);
+    fmpz_mod_mul(Z3, a, t + 4, ctx);
+    fmpz_mod_mul(X3, b3, t + 2, ctx);
+    fmpz_mod_add(Z3, X3, Z3, ctx);
+    fmpz_mod_sub(X3, t + 1, Z3, ctx);
+    fmpz_mod_add(Z3, t + 1, Z3, ctx);
+    fmpz_mod_mul(Y3, X3, Z3, ctx);
+    fmpz_mod_add(t + 1, t + 0, t + 0, ctx);
+    fmpz_mod_add(t + 1, t + 1, t + 0, ctx);
+    fmpz_mod_mul(t + 2, a, t + 2, ctx);
+    fmpz_mod_mul(t + 4, b3, t + 4, ctx);
+    fmpz_mod_add(t + 1, t + 1, t + 2, ctx);
+    fmpz_mod_sub(t + 2, t + 0, t + 2, ctx);
+    fmpz_mod_mul(t + 2, a, t + 2, ctx);
+    fmpz_mod_add(t + 4, t + 4, t + 2, ctx);
+    fmpz_mod_mul(t + 0, t + 1, t + 4, ctx);
+    fmpz_mod_add(Y3, Y3, t + 0, ctx);
+    fmpz_mod_mul(t + 0, t + 5, t + 4, ctx);
+    fmpz_mod_mul(X3, t + 3, X3, ctx);
+    fmpz_mod_sub(X3, X3, t + 0, ctx);
+    fmpz_mod_mul(t + 0, t + 3, t + 1, ctx);
+    fmpz_mod_mul(Z3, t + 5, Z3, ctx);
+    fmpz_mod_add(Z3, Z3, t + 0, ctx);
+
+    fmpz_swap(R + 0, X3);
+    fmpz_swap(R + 1, Y3);
+    fmpz_swap(R + 2, Z3);
+
+    _fmpz_vec_clear(t, 9);
+}
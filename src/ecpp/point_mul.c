@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod.h"
+#include "ecpp.h"
+
+/* Sets R = [e] P for e >= 0 by left-to-right binary multiplication. */
+void
+_ecpp_point_mul(fmpz * R, const fmpz * P, const fmpz_t e,
+        const fmpz_t a, const fmpz_t b3, const fmpz_mod_ctx_t ctx)
+{
+    fmpz * T;
+    fmpz * S;
+    slong i;
+
+    T = _fmpz_vec_init(3);
+    S = _fmpz_vec_init(3);
+
+    _fmpz_vec_set(T, P, 3);
+
+    /* S = O */
+    fmpz_one(S + 1);
+
+    for (i = (slong) fmpz_bits(e) - 1; i >= 0; i--)
+    {
+        _ecpp_point_add(S, S, S, a, b3, ctx);
+
+        if (fmpz_tstbit(e, i))
+            _ecpp_point_add(S, S, T, a, b3, ctx);
+    }
+
+    _fmpz_vec_swap(R, S, 3);
+
+    _fmpz_vec_clear(T, 3);
+    _fmpz_vec_clear(S, 3);
+}
@@ -0,0 +1,183 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "ecpp.h"
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("is_prime....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* primes get certificates which verify */
+    for (iter = 0; iter < 30 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        ecpp_cert_t cert, cert2;
+        fmpz_t n, t;
+        FILE * file;
+        slong i;
+        int res;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_init(n);
+        fmpz_init(t);
+        ecpp_cert_init(cert);
+        ecpp_cert_init(cert2);
+
+        fmpz_randprime(n, state, 2 + n_randint(state, 200), 0);
+
+        res = ecpp_is_prime_cert(cert, n);
+
+        if (res != 1 || !ecpp_cert_verify(cert, n))
+        {
+            flint_printf("FAIL (prime)\n");
+            flint_printf("n = "); fmpz_print(n); flint_printf("\n");
+            flint_printf("res = %d\n", res);
+            ecpp_cert_print(cert);
+            flint_abort();
+        }
+
+        /* the certificate does not prove anything else */
+        fmpz_add_ui(t, n, 2);
+        if (ecpp_cert_verify(cert, t))
+        {
+            flint_printf("FAIL (other n)\n");
+            flint_printf("n = "); fmpz_print(n); flint_printf("\n");
+            flint_abort();
+        }
+
+        /* round trip through a file */
+        file = tmpfile();
+
+        if (file == NULL)
+        {
+            flint_printf("FAIL: tmpfile\n");
+            flint_abort();
+        }
+
+        if (!ecpp_cert_fprint(file, cert))
+        {
+            flint_printf("FAIL (fprint)\n");
+            flint_abort();
+        }
+
+        rewind(file);
+
+        if (!ecpp_cert_fread(file, cert2) || !ecpp_cert_verify(cert2, n))
+        {
+            flint_printf("FAIL (fread)\n");
+            flint_printf("n = "); fmpz_print(n); flint_printf("\n");
+            flint_abort();
+        }
+
+        fclose(file);
+
+        /* tampering with any step is detected */
+        if (cert2->length != 0)
+        {
+            ecpp_step_struct * step;
+
+            i = n_randint(state, cert2->length);
+            step = cert2->steps + i;
+
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    fmpz_add_ui(&step->x, &step->x, 1);
+                    break;
+                case 1:
+                    fmpz_add_ui(&step->b, &step->b, 1);
+                    break;
+                case 2:
+                    fmpz_add_ui(&step->m, &step->m, 1);
+                    break;
+                default:
+                    fmpz_add_ui(&step->q, &step->q, 2);
+            }
+
+            if (ecpp_cert_verify(cert2, n))
+            {
+                flint_printf("FAIL (tampered)\n");
+                flint_printf("n = "); fmpz_print(n); flint_printf("\n");
+                flint_printf("i = %wd\n", i);
+                flint_abort();
+            }
+        }
+
+        fmpz_clear(n);
+        fmpz_clear(t);
+        ecpp_cert_clear(cert);
+        ecpp_cert_clear(cert2);
+    }
+
+    /* composites */
+    for (iter = 0; iter < 100 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t n, p;
+
+        fmpz_init(n);
+        fmpz_init(p);
+
+        fmpz_randprime(n, state, 2 + n_randint(state, 100), 0);
+        fmpz_randprime(p, state, 2 + n_randint(state, 100), 0);
+        fmpz_mul(n, n, p);
+
+        if (ecpp_is_prime(n) != 0)
+        {
+            flint_printf("FAIL (composite)\n");
+            flint_printf("n = "); fmpz_print(n); flint_printf("\n");
+            flint_abort();
+        }
+
+        fmpz_clear(n);
+        fmpz_clear(p);
+    }
+
+    /* a truncated file with a huge length is rejected */
+    {
+        ecpp_cert_t cert;
+        FILE * file;
+
+        ecpp_cert_init(cert);
+        file = tmpfile();
+
+        if (file == NULL)
+        {
+            flint_printf("FAIL: tmpfile\n");
+            flint_abort();
+        }
+
+        fputs("1000000000000000000\n5 1 1 6 5 1 1\n", file);
+        rewind(file);
+
+        if (ecpp_cert_fread(file, cert) || cert->alloc > 2)
+        {
+            flint_printf("FAIL (corrupt length)\n");
+            flint_abort();
+        }
+
+        fclose(file);
+        ecpp_cert_clear(cert);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,241 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod.h"
+#include "ecpp.h"
+
+/* affine reference arithmetic over GF(p); inf marks the point at infinity */
+static void
+affine_add(ulong * x3, ulong * y3, int * inf3, ulong x1, ulong y1, int inf1,
+        ulong x2, ulong y2, int inf2, ulong a, ulong p)
+{
+    ulong l;
+
+    if (inf1) { *x3 = x2; *y3 = y2; *inf3 = inf2; return; }
+    if (inf2) { *x3 = x1; *y3 = y1; *inf3 = inf1; return; }
+
+    if (x1 == x2)
+    {
+        if (n_addmod(y1, y2, p) == 0)
+        {
+            *inf3 = 1;
+            return;
+        }
+
+        /* l = (3 x1^2 + a) / (2 y1) */
+        l = n_addmod(n_mulmod2(3, n_mulmod2(x1, x1, p), p), a, p);
+        l = n_mulmod2(l, n_invmod(n_addmod(y1, y1, p), p), p);
+    }
+    else
+    {
+        l = n_mulmod2(n_submod(y2, y1, p), n_invmod(n_submod(x2, x1, p), p), p);
+    }
+
+    *x3 = n_submod(n_submod(n_mulmod2(l, l, p), x1, p), x2, p);
+    *y3 = n_submod(n_mulmod2(l, n_submod(x1, *x3, p), p), y1, p);
+    *inf3 = 0;
+}
+
+/* finds a random point on the curve */
+static void
+random_point(ulong * x, ulong * y, ulong a, ulong b, ulong p, flint_rand_t state)
+{
+    ulong r;
+
+    while (1)
+    {
+        *x = n_randint(state, p);
+        r = n_addmod(n_mulmod2(n_addmod(n_mulmod2(*x, *x, p), a, p), *x, p), b, p);
+
+        if (r == 0)
+        {
+            *y = 0;
+            return;
+        }
+
+        if (n_jacobi(r, p) == 1)
+        {
+            *y = n_sqrtmod(r, p);
+            return;
+        }
+    }
+}
+
+/* checks that the projective point P corresponds to (x, y, inf) */
+static int
+point_equal(const fmpz * P, ulong x, ulong y, int inf, ulong p)
+{
+    ulong X, Y, Z, zinv;
+
+    X = fmpz_get_ui(P + 0);
+    Y = fmpz_get_ui(P + 1);
+    Z = fmpz_get_ui(P + 2);
+
+    if (inf)
+        return Z == 0 && X == 0 && Y != 0;
+
+    if (Z == 0)
+        return 0;
+
+    zinv = n_invmod(Z, p);
+
+    return n_mulmod2(X, zinv, p) == x && n_mulmod2(Y, zinv, p) == y;
+}
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("point_add....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mod_ctx_t ctx;
+        fmpz_t a, b3, N, e;
+        fmpz * P;
+        fmpz * Q;
+        fmpz * R;
+        ulong p, aa, bb, x1, y1, x2, y2, x3, y3, s, z;
+        int inf1, inf2, inf3, exceptional;
+        slong i;
+
+        do {
+            p = n_randprime(state, 3 + n_randint(state, 20), 0);
+            aa = n_randint(state, p);
+            bb = n_randint(state, p);
+        } while (p <= 3 || n_addmod(n_mulmod2(4, n_powmod2(aa, 3, p), p),
+                                    n_mulmod2(27, n_mulmod2(bb, bb, p), p), p) == 0);
+
+        fmpz_init_set_ui(N, p);
+        fmpz_mod_ctx_init(ctx, N);
+        fmpz_init_set_ui(a, aa);
+        fmpz_init_set_ui(b3, n_mulmod2(3, bb, p));
+        fmpz_init(e);
+
+        P = _fmpz_vec_init(3);
+        Q = _fmpz_vec_init(3);
+        R = _fmpz_vec_init(3);
+
+        /* random points, possibly equal, opposite or at infinity */
+        random_point(&x1, &y1, aa, bb, p, state);
+        inf1 = (n_randint(state, 8) == 0);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                x2 = x1; y2 = y1; inf2 = inf1;
+                break;
+            case 1:
+                x2 = x1; y2 = n_negmod(y1, p); inf2 = inf1;
+                break;
+            default:
+                random_point(&x2, &y2, aa, bb, p, state);
+                inf2 = (n_randint(state, 8) == 0);
+        }
+
+        /* random projective representatives */
+        z = 1 + n_randint(state, p - 1);
+        fmpz_set_ui(P + 0, inf1 ? 0 : n_mulmod2(x1, z, p));
+        fmpz_set_ui(P + 1, inf1 ? z : n_mulmod2(y1, z, p));
+        fmpz_set_ui(P + 2, inf1 ? 0 : z);
+        z = 1 + n_randint(state, p - 1);
+        fmpz_set_ui(Q + 0, inf2 ? 0 : n_mulmod2(x2, z, p));
+        fmpz_set_ui(Q + 1, inf2 ? z : n_mulmod2(y2, z, p));
+        fmpz_set_ui(Q + 2, inf2 ? 0 : z);
+
+        affine_add(&x3, &y3, &inf3, x1, y1, inf1, x2, y2, inf2, aa, p);
+
+        if (n_randint(state, 2))
+        {
+            _ecpp_point_add(R, P, Q, a, b3, ctx);
+        }
+        else
+        {
+            _fmpz_vec_set(R, P, 3);
+            _ecpp_point_add(R, R, Q, a, b3, ctx);
+        }
+
+        /* the exceptional case: P - Q has order 2 */
+        if (fmpz_is_zero(R + 0) && fmpz_is_zero(R + 1) && fmpz_is_zero(R + 2))
+        {
+            affine_add(&x3, &y3, &inf3, x1, y1, inf1, x2, n_negmod(y2, p), inf2, aa, p);
+            exceptional = !inf3 && y3 == 0;
+        }
+        else
+        {
+            exceptional = 0;
+        }
+
+        if (!exceptional && !point_equal(R, x3, y3, inf3, p))
+        {
+            flint_printf("FAIL (add)\n");
+            flint_printf("p = %wu, a = %wu, b = %wu\n", p, aa, bb);
+            flint_printf("P = (%wu, %wu, %d), Q = (%wu, %wu, %d)\n", x1, y1, inf1, x2, y2, inf2);
+            flint_abort();
+        }
+
+        /* scalar multiplication */
+        s = n_randint(state, 100);
+        fmpz_set_ui(e, s);
+        _ecpp_point_mul(R, P, e, a, b3, ctx);
+
+        x3 = y3 = 0;
+        inf3 = 1;
+        for (i = 0; i < s; i++)
+            affine_add(&x3, &y3, &inf3, x3, y3, inf3, x1, y1, inf1, aa, p);
+
+        /* exceptional additions can only occur for points of even order */
+        if (fmpz_is_zero(R + 0) && fmpz_is_zero(R + 1) && fmpz_is_zero(R + 2))
+        {
+            ulong x4, y4;
+            int inf4;
+
+            x4 = x1; y4 = y1; inf4 = inf1;
+            for (i = 1; !inf4; i++)
+                affine_add(&x4, &y4, &inf4, x4, y4, inf4, x1, y1, inf1, aa, p);
+
+            exceptional = (i % 2 == 0);
+        }
+        else
+        {
+            exceptional = 0;
+        }
+
+        if (!exceptional && !point_equal(R, x3, y3, inf3, p))
+        {
+            flint_printf("FAIL (mul)\n");
+            flint_printf("p = %wu, a = %wu, b = %wu, e = %wu\n", p, aa, bb, s);
+            flint_printf("P = (%wu, %wu, %d)\n", x1, y1, inf1);
+            flint_abort();
+        }
+
+        _fmpz_vec_clear(P, 3);
+        _fmpz_vec_clear(Q, 3);
+        _fmpz_vec_clear(R, 3);
+        fmpz_clear(a);
+        fmpz_clear(b3);
+        fmpz_clear(e);
+        fmpz_mod_ctx_clear(ctx);
+        fmpz_clear(N);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -29,10 +29,12 @@ fmpq_mat_get_fmpz_mat_matwise(fmpz_mat_t num, fmpz_t den, const fmpq_mat_t mat)
     fmpz_init(lcm);
     fmpz_one(lcm);
 
-    /* Compute common denominator of matrix */
+    /* Compute common denominator of matrix; the denominators are
+       frequently all equal, as for solutions of linear systems */
     for (i = 0; i < mat->r; i++)
         for (j = 0; j < mat->c; j++)
-            fmpz_lcm(lcm, lcm, fmpq_mat_entry_den(mat, i, j));
+            if (!fmpz_equal(lcm, fmpq_mat_entry_den(mat, i, j)))
+                fmpz_lcm(lcm, lcm, fmpq_mat_entry_den(mat, i, j));
 
     fmpz_set(den, lcm);
 
@@ -41,7 +43,7 @@ fmpq_mat_get_fmpz_mat_matwise(fmpz_mat_t num, fmpz_t den, const fmpq_mat_t mat)
         for (j = 0; j < mat->c; j++)
         {
             /* Rescale numerators */
-            if (fmpz_is_one(lcm))
+            if (fmpz_equal(lcm, fmpq_mat_entry_den(mat, i, j)))
             {
                 fmpz_set(fmpz_mat_entry(num, i, j),
                              fmpq_mat_entry_num(mat, i, j));
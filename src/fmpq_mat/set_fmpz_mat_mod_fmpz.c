@@ -9,43 +9,41 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz.h"
 #include "fmpz_mat.h"
 #include "fmpq.h"
 #include "fmpq_mat.h"
 
-int
-fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
-                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+/*
+    Reconstructs row i of X, keeping a running denominator d which is
+    multiplied into each entry first, so that after the first few entries
+    the reconstruction usually amounts to a comparison with the bound N.
+*/
+static int
+_fmpq_mat_set_fmpz_mat_mod_fmpz_row(fmpq_mat_t X, const fmpz_mat_t Xmod,
+        slong i, const fmpz_t mod, const fmpz_t N, fmpz_t d)
 {
-    fmpz_t num, den, t, u, d;
-    slong i, j;
-
+    fmpz_t num, den, t;
+    slong j;
     int success = 1;
 
     fmpz_init(num);
     fmpz_init(den);
-    fmpz_init(d);
     fmpz_init(t);
-    fmpz_init(u);
-
-    fmpz_one(d);
 
-    for (i = 0; i < Xmod->r; i++)
+    for (j = 0; j < Xmod->c && success; j++)
     {
-        for (j = 0; j < Xmod->c; j++)
-        {
-            /* TODO: handle various special cases efficiently; zeros,
-                     small integers, etc. */
-            fmpz_mul(t, d, fmpz_mat_entry(Xmod, i, j));
-            fmpz_fdiv_qr(u, t, t, mod);
-
-            success = _fmpq_reconstruct_fmpz(num, den, t, mod);
+        /* TODO: handle various special cases efficiently; zeros,
+                 small integers, etc. */
+        fmpz_mul(t, d, fmpz_mat_entry(Xmod, i, j));
+        fmpz_mod(t, t, mod);
 
-            if (!success)
-	       goto cleanup;
+        success = _fmpq_reconstruct_fmpz_2(num, den, t, mod, N, N);
 
-	    fmpz_mul(den, den, d);
+        if (success)
+        {
+            fmpz_mul(den, den, d);
             fmpz_set(d, den);
 
             fmpz_set(fmpq_mat_entry_num(X, i, j), num);
@@ -54,12 +52,82 @@ fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
         }
     }
 
-cleanup:
     fmpz_clear(num);
     fmpz_clear(den);
-    fmpz_clear(d);
     fmpz_clear(t);
-    fmpz_clear(u);
+
+    return success;
+}
+
+typedef struct
+{
+    fmpq_mat_struct * X;
+    const fmpz_mat_struct * Xmod;
+    const fmpz * mod;
+    const fmpz * N;
+    const fmpz * d;
+    int * success;
+}
+set_mod_arg_t;
+
+static void
+_set_mod_worker(slong i, set_mod_arg_t * arg)
+{
+    fmpz_t d;
+
+    fmpz_init_set(d, arg->d);
+    arg->success[i] = _fmpq_mat_set_fmpz_mat_mod_fmpz_row(arg->X, arg->Xmod,
+                                                 i + 1, arg->mod, arg->N, d);
+    fmpz_clear(d);
+}
+
+int
+fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
+                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+{
+    fmpz_t N, d;
+    slong i;
+    int success;
+
+    if (Xmod->r == 0 || Xmod->c == 0)
+        return 1;
+
+    fmpz_init(N);
+    fmpz_init(d);
+
+    /* N = D = floor(sqrt((mod - 1) / 2)), as in fmpq_reconstruct_fmpz */
+    fmpz_fdiv_q_2exp(N, mod, 1);
+    if (fmpz_is_even(mod))
+        fmpz_sub_ui(N, N, 1);
+    fmpz_sqrt(N, N);
+
+    fmpz_one(d);
+
+    /* the first row fixes most of the common denominator, after which
+       the remaining rows are independent */
+    success = _fmpq_mat_set_fmpz_mat_mod_fmpz_row(X, Xmod, 0, mod, N, d);
+
+    if (success && Xmod->r > 1)
+    {
+        set_mod_arg_t arg;
+
+        arg.X = X;
+        arg.Xmod = Xmod;
+        arg.mod = mod;
+        arg.N = N;
+        arg.d = d;
+        arg.success = flint_malloc(sizeof(int) * (Xmod->r - 1));
+
+        flint_parallel_do((do_func_t) _set_mod_worker, &arg, Xmod->r - 1, -1, FLINT_PARALLEL_STRIDED);
+
+        for (i = 0; i < Xmod->r - 1 && success; i++)
+            success = arg.success[i];
+
+        flint_free(arg.success);
+    }
+
+    fmpz_clear(N);
+    fmpz_clear(d);
 
     return success;
 }
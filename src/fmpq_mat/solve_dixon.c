@@ -16,12 +16,9 @@
 #include "fmpz_mat.h"
 #include "fmpq_mat.h"
 
-#define USE_SLOW_MULTIPLICATION 1
-
 int
 _fmpq_mat_check_solution_fmpz_mat(const fmpq_mat_t X, const fmpz_mat_t A, const fmpz_mat_t B);
 
-
 void
 _fmpq_mat_solve_dixon(fmpq_mat_t X,
                     const fmpz_mat_t A, const fmpz_mat_t B,
@@ -29,24 +26,20 @@ _fmpq_mat_solve_dixon(fmpq_mat_t X,
                     const fmpz_t N, const fmpz_t D)
 {
     fmpz_t bound, ppow;
-    fmpz_mat_t x, y, d, Ay;
-    fmpz_t prod;
+    fmpz_mat_t x, d;
     mp_limb_t * crt_primes;
     nmod_mat_t * A_mod;
-    nmod_mat_t Ay_mod, d_mod, y_mod;
-    slong i, j, n, nexti, cols, num_primes;
-    int stabilised; /* has lifting stabilised */
+    nmod_mat_t d_mod;
+    nmod_mat_struct * y;
+    slong i, j, k, n, nexti, cols, num_primes, num_steps, chunk;
 
     n = A->r;
     cols = B->c;
 
     fmpz_init(bound);
     fmpz_init(ppow);
-    fmpz_init(prod);
 
     fmpz_mat_init(x, n, cols);
-    fmpz_mat_init(y, n, cols);
-    fmpz_mat_init(Ay, n, cols);
     fmpz_mat_init_set(d, B);
 
     /* Compute bound for the needed modulus. TODO: if one of N and D
@@ -62,102 +55,76 @@ _fmpq_mat_solve_dixon(fmpq_mat_t X,
 
     crt_primes = fmpz_mat_dixon_get_crt_primes(&num_primes, A, p);
     A_mod = (nmod_mat_t *) flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    for (j = 0; j < num_primes; j++)
+    for (k = 0; k < num_primes; k++)
     {
-        nmod_mat_init(A_mod[j], n, n, crt_primes[j]);
-        fmpz_mat_get_nmod_mat(A_mod[j], A);
+        nmod_mat_init(A_mod[k], n, n, crt_primes[k]);
+        fmpz_mat_get_nmod_mat(A_mod[k], A);
     }
 
-    nmod_mat_init(Ay_mod, n, cols, UWORD(1));
     nmod_mat_init(d_mod, n, cols, p);
-    nmod_mat_init(y_mod, n, cols, p);
+    fmpz_mat_get_nmod_mat(d_mod, d);
+
+    /* the p-adic digits are added to x in chunks, see _fmpz_mat_solve_dixon */
+    num_steps = _fmpz_mat_dixon_num_steps(bound, p);
+    chunk = n_sqrt(num_steps);
+
+    y = flint_malloc(sizeof(nmod_mat_struct) * chunk);
+    for (j = 0; j < chunk; j++)
+        nmod_mat_init(y + j, n, cols, p);
 
     fmpz_one(ppow);
 
-    i = 1; /* working with p^i */
     nexti = 1; /* iteration of next termination test */
 
-    while (fmpz_cmp(ppow, bound) <= 0)
+    for (i = 1, j = 0; i <= num_steps; i++)
     {
         /* y = A^(-1) * d  (mod p) */
-        fmpz_mat_get_nmod_mat(d_mod, d);
-        nmod_mat_mul(y_mod, Ainv, d_mod);
+        nmod_mat_mul(y + j, Ainv, d_mod);
 
-        /* x = x + y * p^i    [= A^(-1) * b mod p^(i+1)] */
-        fmpz_mat_scalar_addmul_nmod_mat_fmpz(x, y_mod, ppow);
-
-        /* ppow = p^(i+1) */
-        fmpz_mul_ui(ppow, ppow, p);
-        if (fmpz_cmp(ppow, bound) > 0)
-            break;
-
-        stabilised = i == nexti;
-	    if (stabilised)
-            nexti = (slong)(i*1.4) + 1; /* set iteration of next test */
+        /* d = (d - Ay) / p */
+        if (i < num_steps)
+            _fmpz_mat_dixon_update(d, d_mod, y + j, A_mod, crt_primes, num_primes);
 
-        /* full matrix stabilisation check */
-        if (stabilised)
+        /* x = x + y * p^i    [= A^(-1) * b mod p^(i+1)] */
+        if (++j == chunk || i == nexti || i == num_steps)
         {
-            stabilised = fmpq_mat_set_fmpz_mat_mod_fmpz(X, x, ppow);
-
-	        if (stabilised)
-            {
-                if (_fmpq_mat_check_solution_fmpz_mat(X, A, B))
-                    goto dixon_done;
-            }
+            _fmpz_mat_dixon_add_digits(x, y, j, ppow);
+            for ( ; j > 0; j--)
+                fmpz_mul_ui(ppow, ppow, p);
         }
-        i++;
 
-        /* d = (d - Ay) / p */
-#if USE_SLOW_MULTIPLICATION
-        fmpz_mat_set_nmod_mat_unsigned(y, y_mod);
-        fmpz_mat_mul(Ay, A, y);
-#else
-        for (j = 0; j < num_primes; j++)
+        /* full matrix stabilisation check */
+        if (i == nexti && i < num_steps)
         {
-            nmod_mat_set_mod(y_mod, crt_primes[j]);
-            nmod_mat_set_mod(Ay_mod, crt_primes[j]);
-            nmod_mat_mul(Ay_mod, A_mod[j], y_mod);
-            if (j == 0)
-            {
-                fmpz_mat_set_nmod_mat(Ay, Ay_mod);
-                fmpz_set_ui(prod, crt_primes[0]);
-            }
-            else
-            {
-                fmpz_mat_CRT_ui(Ay, Ay, prod, Ay_mod, 1);
-                fmpz_mul_ui(prod, prod, crt_primes[j]);
-            }
-        }
-#endif
+            nexti = (slong)(i*1.4) + 1; /* set iteration of next test */
 
-        nmod_mat_set_mod(y_mod, p);
-        fmpz_mat_sub(d, d, Ay);
-        fmpz_mat_scalar_divexact_ui(d, d, p);
+            if (fmpq_mat_set_fmpz_mat_mod_fmpz(X, x, ppow) &&
+                _fmpq_mat_check_solution_fmpz_mat(X, A, B))
+                goto dixon_done;
+        }
     }
 
     fmpq_mat_set_fmpz_mat_mod_fmpz(X, x, ppow);
 
 dixon_done:
 
-    nmod_mat_clear(y_mod);
+    for (j = 0; j < chunk; j++)
+        nmod_mat_clear(y + j);
+    flint_free(y);
+
     nmod_mat_clear(d_mod);
-    nmod_mat_clear(Ay_mod);
 
-    for (j = 0; j < num_primes; j++)
-        nmod_mat_clear(A_mod[j]);
+    for (k = 0; k < num_primes; k++)
+        nmod_mat_clear(A_mod[k]);
 
     flint_free(A_mod);
     flint_free(crt_primes);
 
     fmpz_clear(bound);
     fmpz_clear(ppow);
-    fmpz_clear(prod);
 
     fmpz_mat_clear(d);
     fmpz_mat_clear(x);
-    fmpz_mat_clear(y);
-    fmpz_mat_clear(Ay);
 }
 
 int
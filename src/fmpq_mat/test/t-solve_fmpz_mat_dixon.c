@@ -37,6 +37,8 @@ main(void)
         m = n_randint(state, 40);
         bits = 1 + n_randint(state, 100);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         fmpz_mat_init(A, n, n);
         fmpz_mat_init(B, n, m);
         fmpz_mat_init(AX_Z, n, m);
@@ -119,6 +121,7 @@ main(void)
 
 
     FLINT_TEST_CLEANUP(state);
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -752,6 +752,7 @@ void fmpz_lucas_chain_VtoU(fmpz_t Um, fmpz_t Um1, const fmpz_t Vm, const fmpz_t
 int fmpz_is_probabprime_lucas(const fmpz_t n);
 int fmpz_is_probabprime_BPSW(const fmpz_t n);
 int fmpz_is_probabprime(const fmpz_t p);
+void fmpz_is_probabprime_vec(int * res, const fmpz * vec, slong len);
 int fmpz_is_strong_probabprime(const fmpz_t n, const fmpz_t a);
 
 int fmpz_is_prime_pseudosquare(const fmpz_t n);
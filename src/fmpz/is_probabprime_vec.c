@@ -0,0 +1,195 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "thread_support.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/* Sets rem[i] = P mod x[i] for 0 <= i < n using a remainder tree. */
+static void
+_fmpz_vec_rem_tree(fmpz * rem, const fmpz_t P, const fmpz * x, slong n)
+{
+    fmpz ** tree;
+    fmpz_t t;
+    slong * len;
+    slong i, k, depth;
+
+    for (depth = 1, k = n; k > 1; k = (k + 1) / 2)
+        depth++;
+
+    tree = flint_malloc(sizeof(fmpz *) * depth);
+    len = flint_malloc(sizeof(slong) * depth);
+
+    /* product tree; level 0 is shared with the input */
+    tree[0] = (fmpz *) x;
+    len[0] = n;
+
+    for (k = 1; k < depth; k++)
+    {
+        len[k] = (len[k - 1] + 1) / 2;
+        tree[k] = _fmpz_vec_init(len[k]);
+
+        for (i = 0; i < len[k - 1] / 2; i++)
+            fmpz_mul(tree[k] + i, tree[k - 1] + 2 * i, tree[k - 1] + 2 * i + 1);
+
+        if (len[k - 1] % 2)
+            fmpz_set(tree[k] + len[k] - 1, tree[k - 1] + len[k - 1] - 1);
+    }
+
+    /* reduce down the tree, reusing the upper levels for remainders */
+    if (depth == 1)
+    {
+        fmpz_mod(rem, P, x);
+    }
+    else
+    {
+        fmpz_init(t);
+
+        fmpz_mod(t, P, tree[depth - 1]);
+        fmpz_swap(t, tree[depth - 1]);
+
+        for (k = depth - 1; k >= 1; k--)
+        {
+            fmpz * dest = (k == 1) ? rem : tree[k - 1];
+
+            for (i = len[k - 1] - 1; i >= 0; i--)
+            {
+                fmpz_mod(t, tree[k] + i / 2, tree[k - 1] + i);
+                fmpz_swap(dest + i, t);
+            }
+        }
+
+        fmpz_clear(t);
+    }
+
+    for (k = 1; k < depth; k++)
+        _fmpz_vec_clear(tree[k], len[k]);
+
+    flint_free(tree);
+    flint_free(len);
+}
+
+typedef struct
+{
+    int * res;
+    const fmpz * vec;
+    const slong * idx;
+}
+work_t;
+
+static void
+worker(slong i, work_t * work)
+{
+    const fmpz * n = work->vec + work->idx[i];
+
+    work->res[work->idx[i]] = !fmpz_is_square(n) && fmpz_is_probabprime_BPSW(n);
+}
+
+void
+fmpz_is_probabprime_vec(int * res, const fmpz * vec, slong len)
+{
+    slong i, j, num, num_small, bits, trial_primes;
+    slong * idx;
+    ulong * small;
+    int * small_res;
+    fmpz * x;
+    fmpz * rem;
+    fmpz_t P, g;
+    work_t work;
+
+    idx = flint_malloc(sizeof(slong) * FLINT_MAX(len, 1));
+    small = flint_malloc(sizeof(ulong) * FLINT_MAX(len, 1));
+
+    /* split into word-sized entries, trivial cases and candidates */
+    num = num_small = 0;
+    trial_primes = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (fmpz_sgn(vec + i) <= 0)
+        {
+            res[i] = 0;
+        }
+        else if (fmpz_abs_fits_ui(vec + i))
+        {
+            small[num_small++] = fmpz_get_ui(vec + i);
+        }
+        else if (fmpz_is_even(vec + i))
+        {
+            res[i] = 0;
+        }
+        else
+        {
+            idx[num++] = i;
+
+            /* as in fmpz_is_probabprime */
+            bits = fmpz_bits(vec + i) + FLINT_BITS;
+            trial_primes = FLINT_MAX(trial_primes, bits);
+        }
+    }
+
+    if (num_small != 0)
+    {
+        small_res = flint_malloc(sizeof(int) * num_small);
+        n_is_prime_vec(small_res, small, num_small);
+
+        for (i = j = 0; i < len; i++)
+            if (fmpz_sgn(vec + i) > 0 && fmpz_abs_fits_ui(vec + i))
+                res[i] = small_res[j++];
+
+        flint_free(small_res);
+    }
+
+    if (num != 0)
+    {
+        /* shared trial division: gcd(P mod x, x) for the product P of
+           all trial primes, which are all smaller than any candidate */
+        x = _fmpz_vec_init(num);
+        rem = _fmpz_vec_init(num);
+        fmpz_init(P);
+        fmpz_init(g);
+
+        for (i = 0; i < num; i++)
+            fmpz_set(x + i, vec + idx[i]);
+
+        fmpz_primorial(P, n_nth_prime(trial_primes));
+        _fmpz_vec_rem_tree(rem, P, x, num);
+
+        for (i = j = 0; i < num; i++)
+        {
+            fmpz_gcd(g, rem + i, x + i);
+
+            if (fmpz_is_one(g))
+                idx[j++] = idx[i];
+            else
+                res[idx[i]] = 0;
+        }
+
+        _fmpz_vec_clear(x, num);
+        _fmpz_vec_clear(rem, num);
+        fmpz_clear(P);
+        fmpz_clear(g);
+
+        num = j;
+
+        /* the remaining tests are independent */
+        work.res = res;
+        work.vec = vec;
+        work.idx = idx;
+
+        flint_parallel_do((do_func_t) worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+    }
+
+    flint_free(idx);
+    flint_free(small);
+}
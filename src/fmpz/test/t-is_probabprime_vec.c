@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("is_probabprime_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        fmpz * vec;
+        fmpz_t a;
+        int * res;
+        slong i, len, bits;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 40);
+        bits = 2 + n_randint(state, 300);
+
+        vec = _fmpz_vec_init(len);
+        res = flint_malloc(sizeof(int) * FLINT_MAX(len, 1));
+        fmpz_init(a);
+
+        for (i = 0; i < len; i++)
+        {
+            switch (n_randint(state, 5))
+            {
+                case 0:
+                    fmpz_randtest(vec + i, state, bits);
+                    break;
+                case 1:
+                    fmpz_randprime(vec + i, state, 2 + n_randint(state, bits), 0);
+                    break;
+                case 2:
+                    /* composites with a small factor */
+                    fmpz_randprime(vec + i, state, 2 + n_randint(state, bits), 0);
+                    fmpz_mul_ui(vec + i, vec + i, n_randprime(state, 2 + n_randint(state, 12), 0));
+                    break;
+                case 3:
+                    /* composites without small factors */
+                    fmpz_randprime(vec + i, state, 2 + n_randint(state, bits), 0);
+                    fmpz_randprime(a, state, 2 + n_randint(state, bits), 0);
+                    fmpz_mul(vec + i, vec + i, a);
+                    break;
+                default:
+                    /* squares of primes */
+                    fmpz_randprime(vec + i, state, 2 + n_randint(state, bits / 2 + 1), 0);
+                    fmpz_mul(vec + i, vec + i, vec + i);
+            }
+        }
+
+        fmpz_is_probabprime_vec(res, vec, len);
+
+        for (i = 0; i < len; i++)
+        {
+            if (res[i] != fmpz_is_probabprime(vec + i))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("i = %wd, len = %wd, res = %d\n", i, len, res[i]);
+                flint_printf("n = "); fmpz_print(vec + i); flint_printf("\n");
+                flint_abort();
+            }
+        }
+
+        _fmpz_vec_clear(vec, len);
+        flint_free(res);
+        fmpz_clear(a);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
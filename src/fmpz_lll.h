@@ -160,6 +160,12 @@ int fmpz_lll_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const f
 
 void fmpz_lll_storjohann_ulll(fmpz_mat_t FM, slong new_size, const fmpz_lll_t fl);
 
+/* Blocked LLL and BKZ  ******************************************************/
+
+void fmpz_lll_blocked(fmpz_mat_t B, fmpz_mat_t U, slong block_size, const fmpz_lll_t fl);
+
+void fmpz_lll_bkz(fmpz_mat_t B, fmpz_mat_t U, slong block_size, const fmpz_lll_t fl);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,472 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpq.h"
+#include "fmpz_mat.h"
+#include "fmpz_lll.h"
+
+/* Tours without an insertion end the reduction; this bounds their number */
+#define FMPZ_LLL_BKZ_MAX_TOURS 100
+
+/*
+    Exact Gram-Schmidt data of the rows z, ..., n - 1 of B, which must be
+    linearly independent, in the integral form used by fraction-free LLL:
+    D[z] = 1 and D[i + 1] = D[i] r_i where r_i is the squared length of
+    b_i^*, and L[i][j] = D[j + 1] mu_ij for j < i.
+
+    Only the data that depends on the rows f, ..., h - 1 is recomputed;
+    the remaining rows must be unchanged and span the same lattice with
+    the first h rows as before, so that the data is unchanged for rows
+    before f, for rows from h on in the columns outside f, ..., h - 1,
+    and for D[i] with i > h. Use f = z, h = n for the initial computation.
+*/
+static void
+_fmpz_lll_bkz_gso_exact(fmpz_mat_t L, fmpz * D, const fmpz_mat_t B,
+                        slong z, slong f, slong h)
+{
+    fmpz_t u, t;
+    slong i, j, k, n, j0, j1;
+
+    n = B->r;
+
+    fmpz_init(u);
+    fmpz_init(t);
+
+    fmpz_one(D + z);
+
+    for (i = f; i < n; i++)
+    {
+        j0 = (i < h) ? z : f;
+        j1 = (i < h) ? i : h - 1;
+
+        for (j = j0; j <= j1; j++)
+        {
+            _fmpz_vec_dot(u, B->rows[i], B->rows[j], B->c);
+
+            for (k = z; k < j; k++)
+            {
+                fmpz_mul(u, u, D + k + 1);
+                fmpz_mul(t, fmpz_mat_entry(L, i, k), fmpz_mat_entry(L, j, k));
+                fmpz_sub(u, u, t);
+                fmpz_divexact(u, u, D + k);
+            }
+
+            if (j < i)
+                fmpz_set(fmpz_mat_entry(L, i, j), u);
+            else
+                fmpz_set(D + i + 1, u);
+        }
+    }
+
+    fmpz_clear(u);
+    fmpz_clear(t);
+}
+
+/* a / b * 2^(-e), computed without overflow */
+static double
+_fmpz_ratio_d_2exp(const fmpz_t a, const fmpz_t b, slong e)
+{
+    slong ea, eb;
+    double ma, mb;
+
+    ma = fmpz_get_d_2exp(&ea, a);
+    mb = fmpz_get_d_2exp(&eb, b);
+
+    return ldexp(ma / mb, ea - eb - e);
+}
+
+/*
+    Gram-Schmidt coefficients mu and squared lengths r of the rows z, ..., n - 1
+    of B in double precision, rounded from the exact data. The lengths are
+    scaled by a common power of two.
+*/
+static void
+_fmpz_lll_bkz_gso(d_mat_t mu, double * r, const fmpz_mat_t L, const fmpz * D,
+                  slong z, slong n)
+{
+    slong i, j, e;
+
+    e = 0;
+    for (i = z; i < n; i++)
+        e = FLINT_MAX(e, fmpz_bits(D + i + 1) - fmpz_bits(D + i));
+
+    for (i = z; i < n; i++)
+    {
+        for (j = z; j < i; j++)
+            d_mat_entry(mu, i, j) = _fmpz_ratio_d_2exp(fmpz_mat_entry(L, i, j), D + j + 1, 0);
+
+        r[i] = _fmpz_ratio_d_2exp(D + i + 1, D + i, e);
+    }
+}
+
+/*
+    Returns whether the projection orthogonal to b_z, ..., b_(k-1) of
+    sum x_i b_(k+i), 0 <= i < d, has squared length less than delta times
+    that of b_k^*, using the exact Gram-Schmidt data. The projection is
+    sum c_i b_i^* with c_i = N_i / D[i + 1], so that its squared length
+    is sum N_i^2 / (D[i] D[i + 1]).
+*/
+static int
+_fmpz_lll_bkz_improves(const slong * x, const fmpz_mat_t L, const fmpz * D,
+                       slong k, slong d, const fmpq_t delta)
+{
+    fmpz_t N;
+    fmpq_t s, t;
+    slong i, j;
+    int res;
+
+    fmpz_init(N);
+    fmpq_init(s);
+    fmpq_init(t);
+
+    for (i = k; i < k + d; i++)
+    {
+        fmpz_mul_si(N, D + i + 1, x[i - k]);
+
+        for (j = i + 1; j < k + d; j++)
+            fmpz_addmul_si(N, fmpz_mat_entry(L, j, i), x[j - k]);
+
+        fmpz_mul(fmpq_numref(t), N, N);
+        fmpz_mul(fmpq_denref(t), D + i, D + i + 1);
+        fmpq_canonicalise(t);
+        fmpq_add(s, s, t);
+    }
+
+    fmpz_set(fmpq_numref(t), D + k + 1);
+    fmpz_set(fmpq_denref(t), D + k);
+    fmpq_canonicalise(t);
+    fmpq_mul(t, t, delta);
+
+    res = (fmpq_cmp(s, t) < 0);
+
+    fmpz_clear(N);
+    fmpq_clear(s);
+    fmpq_clear(t);
+
+    return res;
+}
+
+/*
+    Schnorr-Euchner enumeration of the shortest nonzero vector in the
+    projected block of rows k, ..., k + d - 1. Returns 1 and sets the
+    coefficients x if a vector of squared length less than bound is found.
+*/
+static int
+_fmpz_lll_bkz_enum(slong * x, const d_mat_t mu, const double * r,
+                   slong k, slong d, double bound)
+{
+    double * c, * l;
+    slong * y, * dx, * ddx;
+    slong i, j;
+    int found = 0;
+
+    c = flint_malloc(sizeof(double) * d);
+    l = flint_malloc(sizeof(double) * (d + 1));
+    y = flint_malloc(sizeof(slong) * d);
+    dx = flint_malloc(sizeof(slong) * d);
+    ddx = flint_malloc(sizeof(slong) * d);
+
+    for (i = 0; i < d; i++)
+    {
+        c[i] = l[i] = 0.0;
+        y[i] = dx[i] = ddx[i] = 0;
+    }
+
+    l[d] = 0.0;
+    y[0] = 1;
+    i = 0;
+
+    while (1)
+    {
+        double t = y[i] - c[i];
+
+        l[i] = l[i + 1] + t * t * r[k + i];
+
+        if (l[i] < bound)
+        {
+            if (i > 0)
+            {
+                /* go down a level, starting at the nearest integer */
+                i--;
+
+                c[i] = 0.0;
+                for (j = i + 1; j < d; j++)
+                    c[i] -= y[j] * d_mat_entry(mu, k + j, k + i);
+
+                y[i] = (slong) floor(c[i] + 0.5);
+                dx[i] = ddx[i] = (c[i] >= y[i]) ? 1 : -1;
+                continue;
+            }
+
+            bound = l[0];
+            for (j = 0; j < d; j++)
+                x[j] = y[j];
+            found = 1;
+        }
+        else
+        {
+            i++;
+            if (i == d)
+                break;
+        }
+
+        /* next candidate at level i, zigzagging around the center, except
+           that only positive values are tried while all higher coefficients
+           vanish, so that v and -v are not both enumerated */
+        if (l[i + 1] == 0.0)
+        {
+            y[i]++;
+        }
+        else
+        {
+            y[i] += dx[i];
+            ddx[i] = -ddx[i];
+            dx[i] = ddx[i] - dx[i];
+        }
+    }
+
+    flint_free(c);
+    flint_free(l);
+    flint_free(y);
+    flint_free(dx);
+    flint_free(ddx);
+
+    return found;
+}
+
+/* (b_i, b_j) := (a b_i + b b_j, c b_i + d b_j) */
+static void
+_fmpz_mat_rows_transform(fmpz_mat_t B, slong i, slong j, const fmpz_t a,
+                         const fmpz_t b, const fmpz_t c, const fmpz_t d)
+{
+    fmpz * t = _fmpz_vec_init(B->c);
+
+    _fmpz_vec_scalar_mul_fmpz(t, B->rows[i], B->c, c);
+    _fmpz_vec_scalar_addmul_fmpz(t, B->rows[j], B->c, d);
+    _fmpz_vec_scalar_mul_fmpz(B->rows[i], B->rows[i], B->c, a);
+    _fmpz_vec_scalar_addmul_fmpz(B->rows[i], B->rows[j], B->c, b);
+    _fmpz_vec_swap(B->rows[j], t, B->c);
+
+    _fmpz_vec_clear(t, B->c);
+}
+
+/*
+    Replaces the rows k, ..., k + d - 1 of B by a basis of the same lattice
+    whose first vector is sum x_i b_(k+i), for coprime x_i, using a sequence
+    of unimodular 2 x 2 transformations.
+*/
+static void
+_fmpz_lll_bkz_insert(fmpz_mat_t B, fmpz_mat_t U, const slong * x, slong k, slong d)
+{
+    fmpz_t a, b, g, s, t, ag, bg;
+    slong j;
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(g);
+    fmpz_init(s);
+    fmpz_init(t);
+    fmpz_init(ag);
+    fmpz_init(bg);
+
+    fmpz_set_si(b, x[d - 1]);
+
+    for (j = d - 1; j > 0; j--)
+    {
+        fmpz_set_si(a, x[j - 1]);
+
+        if (fmpz_is_zero(b))
+        {
+            fmpz_swap(a, b);
+            continue;
+        }
+
+        /* v = a b_(j-1) + b b_j = g ((a/g) b_(j-1) + (b/g) b_j) */
+        fmpz_xgcd_canonical_bezout(g, s, t, a, b);
+        fmpz_divexact(ag, a, g);
+        fmpz_divexact(bg, b, g);
+        fmpz_neg(t, t);
+
+        _fmpz_mat_rows_transform(B, k + j - 1, k + j, ag, bg, t, s);
+
+        if (U != NULL)
+            _fmpz_mat_rows_transform(U, k + j - 1, k + j, ag, bg, t, s);
+
+        fmpz_swap(b, g);
+    }
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(g);
+    fmpz_clear(s);
+    fmpz_clear(t);
+    fmpz_clear(ag);
+    fmpz_clear(bg);
+}
+
+/*
+    LLL-reduces the first h rows of B, which span the same lattice as
+    before the insertion, leaving the remaining rows untouched. This uses
+    the double precision L^2 without the final reducedness check of
+    fmpz_lll, which dominates for nearly reduced input; the result is
+    checked once at the end of the BKZ reduction.
+*/
+static void
+_fmpz_lll_bkz_lll_prefix(fmpz_mat_t B, fmpz_mat_t U, slong h, const fmpz_lll_t fl)
+{
+    fmpz_mat_t P, UP;
+    slong i;
+
+    if (h == B->r)
+    {
+        if (fmpz_lll_d(B, U, fl) == -1)
+            fmpz_lll(B, U, fl);
+        return;
+    }
+
+    fmpz_mat_init(P, h, B->c);
+    for (i = 0; i < h; i++)
+        _fmpz_vec_swap(P->rows[i], B->rows[i], B->c);
+
+    if (U != NULL)
+    {
+        fmpz_mat_init(UP, h, U->c);
+        for (i = 0; i < h; i++)
+            _fmpz_vec_swap(UP->rows[i], U->rows[i], U->c);
+    }
+
+    if (fmpz_lll_d(P, (U != NULL) ? UP : NULL, fl) == -1)
+        fmpz_lll(P, (U != NULL) ? UP : NULL, fl);
+
+    for (i = 0; i < h; i++)
+        _fmpz_vec_swap(P->rows[i], B->rows[i], B->c);
+
+    fmpz_mat_clear(P);
+
+    if (U != NULL)
+    {
+        for (i = 0; i < h; i++)
+            _fmpz_vec_swap(UP->rows[i], U->rows[i], U->c);
+
+        fmpz_mat_clear(UP);
+    }
+}
+
+void
+fmpz_lll_bkz(fmpz_mat_t B, fmpz_mat_t U, slong block_size, const fmpz_lll_t fl)
+{
+    d_mat_t mu;
+    double * r;
+    slong * x;
+    fmpz_mat_t L, C;
+    fmpz * D;
+    fmpq_t delta;
+    mpq_t deltax;
+    slong n, z, k, d, clean, i, j, tours;
+
+    if (fl->rt != Z_BASIS)
+    {
+        flint_printf("Exception (fmpz_lll_bkz). Only Z_BASIS is supported.\n");
+        flint_abort();
+    }
+
+    fmpz_lll(B, U, fl);
+
+    n = B->r;
+
+    /* linearly dependent rows have been reduced to zero rows at the top */
+    for (z = 0; z < n && _fmpz_vec_is_zero(B->rows[z], B->c); z++) ;
+
+    block_size = FLINT_MIN(block_size, n - z);
+
+    if (block_size < 2)
+        return;
+
+    d_mat_init(mu, n, n);
+    r = flint_malloc(sizeof(double) * n);
+    x = flint_malloc(sizeof(slong) * block_size);
+    fmpz_mat_init(L, n, n);
+    fmpz_mat_init(C, n, B->c);
+    D = _fmpz_vec_init(n + 1);
+
+    fmpq_init(delta);
+    mpq_init(deltax);
+    mpq_set_d(deltax, fl->delta);
+    fmpq_set_mpq(delta, deltax);
+    mpq_clear(deltax);
+
+    _fmpz_lll_bkz_gso_exact(L, D, B, z, z, n);
+    _fmpz_lll_bkz_gso(mu, r, L, D, z, n);
+
+    /* tours over k = z, ..., n - 2 until no block gives an improvement;
+       the enumeration is done in double precision, so an insertion is only
+       made when the improvement is confirmed exactly */
+    clean = 0;
+    tours = 0;
+    k = z;
+
+    while (clean < n - z - 1 && tours < FMPZ_LLL_BKZ_MAX_TOURS)
+    {
+        d = FLINT_MIN(block_size, n - k);
+
+        if (_fmpz_lll_bkz_enum(x, mu, r, k, d, fl->delta * r[k]))
+        {
+            /* skip the trivial solution b_k */
+            for (j = 1; j < d && x[j] == 0; j++) ;
+
+            if (j < d && _fmpz_lll_bkz_improves(x, L, D, k, d, delta))
+            {
+                /* the LLL reduction usually leaves the rows before k
+                   alone, but may move the new vector further up */
+                for (i = z; i < k; i++)
+                    _fmpz_vec_set(C->rows[i], B->rows[i], B->c);
+
+                _fmpz_lll_bkz_insert(B, U, x, k, d);
+                _fmpz_lll_bkz_lll_prefix(B, U, k + d, fl);
+
+                for (i = z; i < k && _fmpz_vec_equal(C->rows[i], B->rows[i], B->c); i++) ;
+
+                _fmpz_lll_bkz_gso_exact(L, D, B, z, i, k + d);
+                _fmpz_lll_bkz_gso(mu, r, L, D, z, n);
+                clean = 0;
+            }
+            else
+            {
+                clean++;
+            }
+        }
+        else
+        {
+            clean++;
+        }
+
+        k++;
+        if (k == n - 1)
+        {
+            k = z;
+            tours++;
+        }
+    }
+
+    /* ensure that the output is LLL-reduced */
+    fmpz_lll(B, U, fl);
+
+    d_mat_clear(mu);
+    flint_free(r);
+    flint_free(x);
+    fmpz_mat_clear(L);
+    fmpz_mat_clear(C);
+    _fmpz_vec_clear(D, n + 1);
+    fmpq_clear(delta);
+}
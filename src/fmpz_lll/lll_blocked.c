@@ -0,0 +1,229 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "double_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_lll.h"
+
+typedef struct
+{
+    fmpz_mat_struct * B;
+    fmpz_mat_struct * U;
+    slong block_size;
+    const fmpz_lll_struct * fl;
+}
+lll_blocked_arg_t;
+
+static void _fmpz_lll_blocked(fmpz_mat_t B, fmpz_mat_t U, slong block_size,
+                              const fmpz_lll_t fl, int top);
+
+static void
+_fmpz_lll_blocked_worker(slong i, lll_blocked_arg_t * args)
+{
+    _fmpz_lll_blocked(args[i].B, args[i].U, args[i].block_size, args[i].fl, 0);
+}
+
+/*
+    The reductions use the double precision L^2 when it succeeds. Only the
+    final result is checked for reducedness, as in fmpz_lll_wrapper, and
+    fmpz_lll is only run again on the whole basis if the check fails.
+*/
+static void
+_fmpz_lll_blocked_base(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl, int top)
+{
+    if (fmpz_lll_d(B, U, fl) == -1 || (top && !fmpz_lll_is_reduced(B, fl, D_BITS)))
+        fmpz_lll(B, U, fl);
+}
+
+static void
+_fmpz_mat_set_rows(fmpz_mat_t A, const fmpz_mat_t B, slong r0)
+{
+    slong i;
+
+    for (i = 0; i < A->r; i++)
+        _fmpz_vec_set(A->rows[i], B->rows[r0 + i], A->c);
+}
+
+static void
+_fmpz_mat_get_rows(fmpz_mat_t B, slong r0, const fmpz_mat_t A)
+{
+    slong i;
+
+    for (i = 0; i < A->r; i++)
+        _fmpz_vec_set(B->rows[r0 + i], A->rows[i], A->c);
+}
+
+/*
+    Size reduces the rows of H against the lattice spanned by the rows of T,
+    as a block: the coefficients of the projections of H onto the span of T
+    are C = H T^t (T T^t)^(-1), and H is replaced by H - round(C) T. The same
+    operation is applied to UH using UT. The rows of T must be linearly
+    independent.
+*/
+static void
+_fmpz_lll_block_size_reduce(fmpz_mat_t H, fmpz_mat_t UH,
+                            const fmpz_mat_t T, const fmpz_mat_t UT)
+{
+    fmpz_mat_t G, R, Rt, Tt, X;
+    fmpz_t den, den2;
+    slong i, j;
+
+    fmpz_mat_init(G, T->r, T->r);
+    fmpz_mat_init(R, H->r, T->r);
+    fmpz_mat_init(Tt, T->c, T->r);
+    fmpz_mat_init(X, T->r, H->r);
+    fmpz_init(den);
+    fmpz_init(den2);
+
+    fmpz_mat_transpose(Tt, T);
+    fmpz_mat_mul(G, T, Tt);
+    fmpz_mat_mul(R, H, Tt);
+
+    /* G is symmetric, so G X = R^t gives X = C^t */
+    fmpz_mat_init(Rt, T->r, H->r);
+    fmpz_mat_transpose(Rt, R);
+
+    if (fmpz_mat_solve(X, den, G, Rt))
+    {
+        /* X := round(X / den) = floor((2 X + den) / (2 den)) */
+        fmpz_mul_2exp(den2, den, 1);
+
+        for (i = 0; i < X->r; i++)
+        {
+            for (j = 0; j < X->c; j++)
+            {
+                fmpz * x = fmpz_mat_entry(X, i, j);
+
+                fmpz_mul_2exp(x, x, 1);
+                fmpz_add(x, x, den);
+                fmpz_fdiv_q(x, x, den2);
+            }
+        }
+
+        if (!fmpz_mat_is_zero(X))
+        {
+            fmpz_mat_t C, CT;
+
+            fmpz_mat_init(C, H->r, T->r);
+            fmpz_mat_init(CT, H->r, T->c);
+
+            fmpz_mat_transpose(C, X);
+            fmpz_mat_mul(CT, C, T);
+            fmpz_mat_sub(H, H, CT);
+
+            if (UH != NULL)
+            {
+                fmpz_mat_clear(CT);
+                fmpz_mat_init(CT, H->r, UT->c);
+                fmpz_mat_mul(CT, C, UT);
+                fmpz_mat_sub(UH, UH, CT);
+            }
+
+            fmpz_mat_clear(C);
+            fmpz_mat_clear(CT);
+        }
+    }
+
+    fmpz_mat_clear(G);
+    fmpz_mat_clear(R);
+    fmpz_mat_clear(Rt);
+    fmpz_mat_clear(Tt);
+    fmpz_mat_clear(X);
+    fmpz_clear(den);
+    fmpz_clear(den2);
+}
+
+static void
+_fmpz_lll_blocked(fmpz_mat_t B, fmpz_mat_t U, slong block_size,
+                  const fmpz_lll_t fl, int top)
+{
+    fmpz_mat_t T, H, UT, UH, T2, UT2;
+    lll_blocked_arg_t args[2];
+    slong r, h, z;
+
+    r = B->r;
+    block_size = FLINT_MAX(block_size, 2);
+
+    if (fl->rt != Z_BASIS || r <= 2 * block_size)
+    {
+        _fmpz_lll_blocked_base(B, U, fl, top);
+        return;
+    }
+
+    /* reduce the two halves independently */
+    h = r / 2;
+
+    fmpz_mat_init(T, h, B->c);
+    fmpz_mat_init(H, r - h, B->c);
+    _fmpz_mat_set_rows(T, B, 0);
+    _fmpz_mat_set_rows(H, B, h);
+
+    if (U != NULL)
+    {
+        fmpz_mat_init(UT, h, U->c);
+        fmpz_mat_init(UH, r - h, U->c);
+        _fmpz_mat_set_rows(UT, U, 0);
+        _fmpz_mat_set_rows(UH, U, h);
+    }
+
+    args[0].B = T;
+    args[0].U = (U != NULL) ? UT : NULL;
+    args[1].B = H;
+    args[1].U = (U != NULL) ? UH : NULL;
+    args[0].block_size = args[1].block_size = block_size;
+    args[0].fl = args[1].fl = fl;
+
+    flint_parallel_do((do_func_t) _fmpz_lll_blocked_worker, args, 2, -1, FLINT_PARALLEL_UNIFORM);
+
+    /* zero rows of the reduced upper half come first */
+    for (z = 0; z < h && _fmpz_vec_is_zero(T->rows[z], T->c); z++) ;
+
+    if (z < h)
+    {
+        fmpz_mat_window_init(T2, T, z, 0, h, T->c);
+
+        if (U != NULL)
+            fmpz_mat_window_init(UT2, UT, z, 0, h, UT->c);
+
+        _fmpz_lll_block_size_reduce(H, (U != NULL) ? UH : NULL, T2, (U != NULL) ? UT2 : NULL);
+
+        fmpz_mat_window_clear(T2);
+
+        if (U != NULL)
+            fmpz_mat_window_clear(UT2);
+    }
+
+    _fmpz_mat_get_rows(B, 0, T);
+    _fmpz_mat_get_rows(B, h, H);
+
+    if (U != NULL)
+    {
+        _fmpz_mat_get_rows(U, 0, UT);
+        _fmpz_mat_get_rows(U, h, UH);
+        fmpz_mat_clear(UT);
+        fmpz_mat_clear(UH);
+    }
+
+    fmpz_mat_clear(T);
+    fmpz_mat_clear(H);
+
+    /* merge */
+    _fmpz_lll_blocked_base(B, U, fl, top);
+}
+
+void
+fmpz_lll_blocked(fmpz_mat_t B, fmpz_mat_t U, slong block_size, const fmpz_lll_t fl)
+{
+    _fmpz_lll_blocked(B, U, block_size, fl, 1);
+}
@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "fmpz_lll.h"
+
+int
+main(void)
+{
+    slong i;
+    fmpz_mat_t W, mat, mat2, U;
+    fmpz_lll_t fl;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lll_blocked....");
+    fflush(stdout);
+
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        slong r, c, block_size;
+        flint_bitcnt_t bits;
+        int with_U, result;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_lll_randtest(fl, state);
+        fl->rt = Z_BASIS;
+
+        block_size = n_randint(state, 8);
+        bits = n_randint(state, 100) + 1;
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                r = 2 * (n_randint(state, 20) + 1);
+                c = r;
+                fmpz_mat_init(mat, r, c);
+                fmpz_mat_randntrulike(mat, state, FLINT_MIN(bits, 20), n_randint(state, 200) + 1);
+                break;
+            case 1:
+                r = n_randint(state, 40) + 1;
+                c = r + 1;
+                fmpz_mat_init(mat, r, c);
+                fmpz_mat_randintrel(mat, state, bits);
+                break;
+            default:
+                /* rank deficient */
+                r = n_randint(state, 30) + 1;
+                c = n_randint(state, 30) + 1;
+                fmpz_mat_init(mat, r, c);
+                fmpz_mat_randrank(mat, state, n_randint(state, FLINT_MIN(r, c) + 1), bits);
+        }
+
+        with_U = n_randint(state, 2);
+
+        fmpz_mat_init(mat2, r, c);
+        fmpz_mat_init(U, r, r);
+        fmpz_mat_set(mat2, mat);
+        fmpz_mat_one(U);
+
+        fmpz_lll_blocked(mat, with_U ? U : NULL, block_size, fl);
+
+        /* linearly dependent rows are reduced to zero rows at the top */
+        _fmpz_mat_read_only_window_init_strip_initial_zero_rows(W, mat);
+        result = fmpz_mat_is_reduced(W, fl->delta, fl->eta);
+        _fmpz_mat_read_only_window_clear(W);
+
+        if (!result)
+        {
+            flint_printf("FAIL (reduced):\n");
+            fmpz_mat_print_pretty(mat2);
+            fmpz_mat_print_pretty(mat);
+            flint_printf("delta = %g, eta = %g\n", fl->delta, fl->eta);
+            flint_printf("block_size = %wd\n", block_size);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (with_U)
+        {
+            fmpz_t d;
+
+            fmpz_init(d);
+            fmpz_mat_det(d, U);
+            fmpz_mat_mul(mat2, U, mat2);
+
+            if (!fmpz_mat_equal(mat, mat2) || !fmpz_is_pm1(d))
+            {
+                flint_printf("FAIL (transformation):\n");
+                fmpz_mat_print_pretty(mat);
+                fmpz_mat_print_pretty(mat2);
+                fmpz_mat_print_pretty(U);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            fmpz_clear(d);
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(U);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_cleanup_master();
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -418,6 +418,15 @@ mp_limb_t *
 fmpz_mat_dixon_get_crt_primes(slong * num_primes,
 		                              const fmpz_mat_t A, mp_limb_t p);
 
+void _fmpz_mat_dixon_update(fmpz_mat_t d, nmod_mat_t d_mod,
+                const nmod_mat_t y_mod, nmod_mat_t * A_mod,
+                                const mp_limb_t * primes, slong num_primes);
+
+void _fmpz_mat_dixon_add_digits(fmpz_mat_t x, const nmod_mat_struct * y,
+                                               slong k, const fmpz_t ppow);
+
+slong _fmpz_mat_dixon_num_steps(const fmpz_t bound, mp_limb_t p);
+
 void
 _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 		  const fmpz_mat_t A, const fmpz_mat_t B,
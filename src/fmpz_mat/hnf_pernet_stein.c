@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "perm.h"
 #include "nmod.h"
 #include "nmod_mat.h"
@@ -18,14 +19,17 @@
 #include "fmpq.h"
 #include "fmpq_mat.h"
 
+/* k must be a basis of the right kernel of the first n - 1 rows of the
+   leading n x n submatrix of B, where n is the number of rows of B */
 static void
-add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t state)
+add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1,
+        const fmpz_mat_t k, flint_rand_t state)
 {
     int neg;
     slong i, j, n, bits;
     fmpz_t den, tmp, one;
     fmpq_t num, alpha;
-    fmpz_mat_t Bu, B1, cols, k;
+    fmpz_mat_t Bu, B1, cols;
     fmpq_mat_t H1_q, cols_q, x;
 
     n = B->r;
@@ -33,7 +37,6 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     fmpz_mat_init(Bu, n, n);
     fmpz_mat_init(B1, n - 1, n);
     fmpz_mat_init(cols, n, B->c - n);
-    fmpz_mat_init(k, n, 1);
     fmpq_mat_init(x, n, B->c - n);
     fmpq_mat_init(cols_q, n, B->c - n);
     fmpq_mat_init(H1_q, n, n);
@@ -50,14 +53,6 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
         }
     }
 
-    /* find kernel basis vector */
-    if (fmpz_mat_nullspace(k, B1) != 1)
-    {
-        flint_printf("Exception (fmpz_mat_hnf_pernet_stein). "
-                "Nullspace was not dimension one.\n");
-        flint_abort();
-    }
-
     bits = fmpz_mat_max_bits(B1);
     if (bits < 0)
         bits = -bits;
@@ -148,7 +143,6 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     fmpq_mat_clear(H1_q);
     fmpq_mat_clear(x);
     fmpq_mat_clear(cols_q);
-    fmpz_mat_clear(k);
     fmpz_mat_clear(cols);
     fmpz_mat_clear(Bu);
 }
@@ -258,18 +252,69 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
     fmpz_clear(b);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * B;
+    const fmpz_mat_struct * c;
+    const fmpz_mat_struct * d;
+    const mp_limb_t * primes;
+    mp_limb_t * v1;
+    mp_limb_t * v2;
+}
+double_det_work_t;
+
+/* determinant of the transpose of B with the row c appended, mod p */
+static mp_limb_t
+_det_mod_p(const fmpz_mat_t B, const fmpz_mat_t c, mp_limb_t p)
+{
+    slong i, j, n = B->c, *P;
+    mp_limb_t v;
+    nmod_mat_t Btmod;
+
+    P = _perm_init(n);
+    nmod_mat_init(Btmod, n, n, p);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n - 1; j++)
+            nmod_mat_entry(Btmod, i, j) =
+                fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
+        nmod_mat_entry(Btmod, i, n - 1) =
+            fmpz_fdiv_ui(fmpz_mat_entry(c, 0, i), p);
+    }
+    nmod_mat_lu(P, Btmod, 0);
+    v = UWORD(1);
+    for (i = 0; i < n; i++)
+        v = n_mulmod2_preinv(v, nmod_mat_entry(Btmod, i, i), p,
+                Btmod->mod.ninv);
+    if (_perm_parity(P, n) == 1)
+        v = nmod_neg(v, Btmod->mod);
+
+    nmod_mat_clear(Btmod);
+    _perm_clear(P);
+
+    return v;
+}
+
+static void
+double_det_worker(slong i, double_det_work_t * work)
+{
+    work->v1[i] = _det_mod_p(work->B, work->c, work->primes[i]);
+    work->v2[i] = _det_mod_p(work->B, work->d, work->primes[i]);
+}
+
 static void
 double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         const fmpz_mat_t d)
 {
-    slong i, j, n;
-    slong *P;
+    slong i, j, k, n, num;
     mp_limb_t p, u1mod, u2mod, v1mod, v2mod;
+    mp_limb_t *primes, *vv1, *vv2;
     fmpz_t bound, prod, s1, s2, t, u1, u2, v1, v2;
     fmpz_mat_t dt, Bt;
     fmpq_t tmpq;
     fmpq_mat_t x;
-    nmod_mat_t Btmod;
+    double_det_work_t work;
 
     n = B->c;
 
@@ -353,59 +398,54 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         fmpz_mul_ui(bound, bound, UWORD(2));
 
         fmpz_one(prod);
-        P = _perm_init(n);
-        nmod_mat_init(Btmod, n, n, 2);
         p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
-        /* compute determinants divided by u1 and u2 */
+
+        /* compute determinants divided by u1 and u2, for batches of
+           primes in parallel */
+        num = FLINT_MAX(flint_get_num_threads(), 1);
+        primes = flint_malloc(sizeof(mp_limb_t) * num);
+        vv1 = flint_malloc(sizeof(mp_limb_t) * num);
+        vv2 = flint_malloc(sizeof(mp_limb_t) * num);
+
+        work.B = B;
+        work.c = c;
+        work.d = d;
+        work.primes = primes;
+        work.v1 = vv1;
+        work.v2 = vv2;
+
         while (fmpz_cmp(prod, bound) <= 0)
         {
-            p = n_nextprime(p, 0);
-            u1mod = fmpz_fdiv_ui(u1, p);
-            u2mod = fmpz_fdiv_ui(u2, p);
-            if (!(u1mod || u2mod))
-                continue;
-            nmod_mat_set_mod(Btmod, p);
-            for (i = 0; i < n; i++)
+            for (k = 0; k < num; k++)
             {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(c, 0, i), p);
+                do {
+                    p = n_nextprime(p, 0);
+                } while (fmpz_fdiv_ui(u1, p) == 0 || fmpz_fdiv_ui(u2, p) == 0);
+
+                primes[k] = p;
             }
-            nmod_mat_lu(P, Btmod, 0);
-            v1mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v1mod = n_mulmod2_preinv(v1mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v1mod = nmod_neg(v1mod, Btmod->mod);
 
-            for (i = 0; i < n; i++)
+            flint_parallel_do((do_func_t) double_det_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+
+            for (k = 0; k < num && fmpz_cmp(prod, bound) <= 0; k++)
             {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(d, 0, i), p);
+                p = primes[k];
+                u1mod = fmpz_fdiv_ui(u1, p);
+                u2mod = fmpz_fdiv_ui(u2, p);
+                v1mod = n_mulmod2_preinv(vv1[k], n_invmod(u1mod, p), p,
+                        n_preinvert_limb(p));
+                v2mod = n_mulmod2_preinv(vv2[k], n_invmod(u2mod, p), p,
+                        n_preinvert_limb(p));
+                fmpz_CRT_ui(v1, v1, prod, v1mod, p, 1);
+                fmpz_CRT_ui(v2, v2, prod, v2mod, p, 1);
+                fmpz_mul_ui(prod, prod, p);
             }
-            nmod_mat_lu(P, Btmod, 0);
-            v2mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v2mod = n_mulmod2_preinv(v2mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v2mod = nmod_neg(v2mod, Btmod->mod);
-
-            v1mod = n_mulmod2_preinv(v1mod, n_invmod(u1mod, p), p,
-                    Btmod->mod.ninv);
-            v2mod = n_mulmod2_preinv(v2mod, n_invmod(u2mod, p), p,
-                    Btmod->mod.ninv);
-            fmpz_CRT_ui(v1, v1, prod, v1mod, p, 1);
-            fmpz_CRT_ui(v2, v2, prod, v2mod, p, 1);
-            fmpz_mul_ui(prod, prod, p);
         }
 
+        flint_free(primes);
+        flint_free(vv1);
+        flint_free(vv2);
+
         fmpz_mul(d1, u1, v1);
         fmpz_mul(d2, u2, v2);
 
@@ -418,8 +458,6 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         fmpz_clear(v1);
         fmpz_clear(v2);
         fmpz_clear(t);
-        _perm_clear(P);
-        nmod_mat_clear(Btmod);
     }
     else                        /* can't use the clever method above so naively compute both dets */
     {
@@ -434,13 +472,35 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
     fmpq_mat_clear(x);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * B;
+    const fmpz_mat_struct * c;
+    const fmpz_mat_struct * d;
+    fmpz * d1;
+    fmpz * d2;
+    fmpz_mat_struct * k;
+    slong nullity;
+}
+det_kernel_work_t;
+
+static void
+det_kernel_worker(slong i, det_kernel_work_t * work)
+{
+    if (i == 0)
+        double_det(work->d1, work->d2, work->B, work->c, work->d);
+    else
+        work->nullity = fmpz_mat_nullspace(work->k, work->B);
+}
+
 void
 fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
 {
     slong i, j, m, n, p, r, *P, *pivots, finished;
     fmpz_t d1, d2, g, s, t;
-    fmpz_mat_t c, d, B, C, H1, H2, H3;
+    fmpz_mat_t c, d, k, B, C, H1, H2, H3;
     nmod_mat_t Amod;
+    det_kernel_work_t work;
 
     m = fmpz_mat_nrows(A);
     n = fmpz_mat_ncols(A);
@@ -535,7 +595,26 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
             fmpz_init(d1);
             fmpz_init(d2);
 
-            double_det(d1, d2, B, c, d);
+            /* the determinants and the kernel used by add_columns only
+               depend on B, c and d, and are computed concurrently */
+            fmpz_mat_init(k, r - 1, 1);
+
+            work.B = B;
+            work.c = c;
+            work.d = d;
+            work.d1 = d1;
+            work.d2 = d2;
+            work.k = k;
+
+            flint_parallel_do((do_func_t) det_kernel_worker, &work, 2, -1, FLINT_PARALLEL_UNIFORM);
+
+            if (work.nullity != 1)
+            {
+                flint_printf("Exception (fmpz_mat_hnf_pernet_stein). "
+                        "Nullspace was not dimension one.\n");
+                flint_abort();
+            }
+
             fmpz_xgcd(g, s, t, d1, d2);
 
             for (j = 0; j < r - 1; j++)
@@ -576,7 +655,7 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
             fmpz_mat_init(H2, r - 1, n);
             fmpz_mat_init(H3, m + 1, n);
 
-            add_columns(H2, B, H1, state);
+            add_columns(H2, B, H1, k, state);
 
             for (i = 0; i < r - 1; i++)
                 for (j = 0; j < n; j++)
@@ -624,6 +703,9 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
             finished = 1;
         }
 
+        if (r > 2)
+            fmpz_mat_clear(k);
+
         fmpz_clear(t);
         fmpz_clear(s);
         fmpz_clear(g);
@@ -50,6 +50,42 @@ _fmpz_mat_hnf_transform_naive(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
     fmpz_mat_clear(H2);
 }
 
+/*
+    For nonsingular square A the transformation is determined by the Hermite
+    form, U = H A^(-1), so it is recovered with a single solve instead of
+    computing the Hermite form of a larger matrix.
+*/
+static void
+_fmpz_mat_hnf_transform_solve(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
+{
+    slong n = fmpz_mat_nrows(A);
+    fmpz_mat_t H2, At, Ht, X;
+    fmpz_t den;
+
+    fmpz_mat_init(H2, n, n);
+    fmpz_mat_init(At, n, n);
+    fmpz_mat_init(Ht, n, n);
+    fmpz_mat_init(X, n, n);
+    fmpz_init(den);
+
+    fmpz_mat_hnf(H2, A);
+
+    /* A^T X = den H^T, so that U = X^T / den */
+    fmpz_mat_transpose(At, A);
+    fmpz_mat_transpose(Ht, H2);
+    fmpz_mat_solve(X, den, At, Ht);
+    fmpz_mat_transpose(U, X);
+    fmpz_mat_scalar_divexact_fmpz(U, U, den);
+
+    fmpz_mat_swap(H, H2);
+
+    fmpz_mat_clear(H2);
+    fmpz_mat_clear(At);
+    fmpz_mat_clear(Ht);
+    fmpz_mat_clear(X);
+    fmpz_clear(den);
+}
+
 void
 fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
 {
@@ -75,7 +111,9 @@ fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
 
         flint_randclear(state);
 
-        if (r == n) /* Full column rank */
+        if (r == n && m == n) /* nonsingular */
+            _fmpz_mat_hnf_transform_solve(H, U, A);
+        else if (r == n) /* Full column rank */
             fmpz_mat_hnf_minors_transform(H, U, A);
         else
             _fmpz_mat_hnf_transform_naive(H, U, A);
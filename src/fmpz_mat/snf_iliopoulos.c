@@ -9,15 +9,99 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_mat.h"
 
+/* use threads when the active submatrix has at least this many entries */
+#define SNF_ILIOPOULOS_PARALLEL_CUTOFF 400
+
+typedef struct
+{
+    fmpz_mat_struct * S;
+    slong i;
+    const fmpz * mod;
+    const fmpz * g;
+    const fmpz * t;
+    const fmpz * r;
+}
+elim_work_t;
+
+static int
+_thread_limit(const fmpz_mat_t S, slong i)
+{
+    return ((S->r - i) * (S->c - i) >= SNF_ILIOPOULOS_PARALLEL_CUTOFF) ? -1 : 1;
+}
+
+/* S[i][j] += sum_k t[k - i - 1] S[k][j] for column j = i + jj */
+static void
+_col_combine_worker(slong jj, elim_work_t * w)
+{
+    fmpz_mat_struct * S = w->S;
+    slong i = w->i, j = i + jj, k;
+
+    for (k = i + 1; k < S->r; k++)
+        fmpz_addmul(fmpz_mat_entry(S, i, j), w->t + k - i - 1,
+                fmpz_mat_entry(S, k, j));
+}
+
+/* reduces row k = i + 1 + kk with row i and then modulo mod */
+static void
+_col_reduce_worker(slong kk, elim_work_t * w)
+{
+    fmpz_mat_struct * S = w->S;
+    slong i = w->i, k = i + 1 + kk, j;
+    fmpz_t r1g;
+
+    if (!fmpz_is_zero(w->g))
+    {
+        fmpz_init(r1g);
+        fmpz_divexact(r1g, fmpz_mat_entry(S, k, i), w->g);
+        fmpz_neg(r1g, r1g);
+        for (j = i; j < S->c; j++)
+            fmpz_addmul(fmpz_mat_entry(S, k, j), r1g,
+                    fmpz_mat_entry(S, i, j));
+        fmpz_mod(fmpz_mat_entry(S, k, i), fmpz_mat_entry(S, k, i), w->mod);
+        fmpz_clear(r1g);
+    }
+
+    for (j = i + 1; j < S->c; j++)
+        fmpz_fdiv_r(fmpz_mat_entry(S, k, j), fmpz_mat_entry(S, k, j), w->mod);
+}
+
+/* column operations on row j = i + jj: col i += sum_k t[k - i - 1] col k,
+   then col k += r[k - i - 1] col i, then reduction modulo mod */
+static void
+_row_reduce_worker(slong jj, elim_work_t * w)
+{
+    fmpz_mat_struct * S = w->S;
+    slong i = w->i, j = i + jj, k;
+
+    for (k = i + 1; k < S->c; k++)
+        fmpz_addmul(fmpz_mat_entry(S, j, i), w->t + k - i - 1,
+                fmpz_mat_entry(S, j, k));
+
+    if (!fmpz_is_zero(w->g))
+    {
+        for (k = i + 1; k < S->c; k++)
+            fmpz_addmul(fmpz_mat_entry(S, j, k), w->r + k - i - 1,
+                    fmpz_mat_entry(S, j, i));
+    }
+
+    if (j > i)
+    {
+        for (k = i; k < S->c; k++)
+            fmpz_fdiv_r(fmpz_mat_entry(S, j, k), fmpz_mat_entry(S, j, k), w->mod);
+    }
+}
+
 static void _eliminate_col(fmpz_mat_t S, slong i, const fmpz_t mod)
 {
     slong j, k, m, n;
     fmpz * t;
     fmpz_t b, g, u, v, r1g, r2g;
+    elim_work_t work;
 
     m = S->r;
     n = S->c;
@@ -68,34 +152,28 @@ static void _eliminate_col(fmpz_mat_t S, slong i, const fmpz_t mod)
             fmpz_mul(t + k, t + k, u);
     }
 
+    for (k = 0; k < m - i - 1; k++)
+        fmpz_mod(t + k, t + k, mod);
+
+    work.S = S;
+    work.i = i;
+    work.mod = mod;
+    work.g = g;
+    work.t = t;
+    work.r = NULL;
+
     /* set row i to have gcd in col i */
-    for (k = i + 1; k < m; k++)
-    {
-        fmpz_mod(t + k - i - 1, t + k - i - 1, mod);
-        for (j = i; j < n; j++)
-            fmpz_addmul(fmpz_mat_entry(S, i, j), t + k - i - 1,
-                    fmpz_mat_entry(S, k, j));
-    }
+    flint_parallel_do((do_func_t) _col_combine_worker, &work, n - i,
+            _thread_limit(S, i), FLINT_PARALLEL_UNIFORM);
+
+    /* reduce each row k with row i; the rows are independent */
+    flint_parallel_do((do_func_t) _col_reduce_worker, &work, m - i - 1,
+            _thread_limit(S, i), FLINT_PARALLEL_UNIFORM);
 
     _fmpz_vec_clear(t, m - i - 1);
 
-    /* reduce each row k with row i */
-    if (!fmpz_is_zero(g)) /* if g = 0 then don't need to reduce */
-    {
-        for (k = i + 1; k < m; k++)
-        {
-            fmpz_divexact(r1g, fmpz_mat_entry(S, k, i), g);
-            fmpz_neg(r1g, r1g);
-            for (j = i; j < n; j++)
-                fmpz_addmul(fmpz_mat_entry(S, k, j), r1g,
-                        fmpz_mat_entry(S, i, j));
-        }
-        for (k = i + 1; k < m; k++)
-            fmpz_mod(fmpz_mat_entry(S, k, i), fmpz_mat_entry(S, k, i), mod);
-    }
-    for (j = i; j < m; j++)
-        for (k = i + 1; k < n; k++)
-            fmpz_fdiv_r(fmpz_mat_entry(S, j, k), fmpz_mat_entry(S, j, k), mod);
+    for (k = i + 1; k < n; k++)
+        fmpz_fdiv_r(fmpz_mat_entry(S, i, k), fmpz_mat_entry(S, i, k), mod);
     fmpz_gcd(fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, i, i), mod);
 
     fmpz_clear(b);
@@ -108,8 +186,9 @@ static void _eliminate_col(fmpz_mat_t S, slong i, const fmpz_t mod)
 static void _eliminate_row(fmpz_mat_t S, slong i, const fmpz_t mod)
 {
     slong j, k, m, n;
-    fmpz * t;
-    fmpz_t b, g, u, v, r1g, r2g, halfmod;
+    fmpz * t, * r;
+    fmpz_t b, g, u, v, r1g, r2g;
+    elim_work_t work;
 
     m = S->r;
     n = S->c;
@@ -125,8 +204,6 @@ static void _eliminate_row(fmpz_mat_t S, slong i, const fmpz_t mod)
     fmpz_init(b);
     fmpz_init(r1g);
     fmpz_init(r2g);
-    fmpz_init(halfmod);
-    fmpz_fdiv_q_2exp(halfmod, mod, 1);
 
     if (!fmpz_is_zero(fmpz_mat_entry(S, i, i)))
     {
@@ -152,6 +229,7 @@ static void _eliminate_row(fmpz_mat_t S, slong i, const fmpz_t mod)
 
     /* compute extended gcd of entries in row i */
     t = _fmpz_vec_init(n - i - 1);
+    r = _fmpz_vec_init(n - i - 1);
 
     fmpz_set(g, fmpz_mat_entry(S, i, i + 1));
     fmpz_one(t);
@@ -162,32 +240,34 @@ static void _eliminate_row(fmpz_mat_t S, slong i, const fmpz_t mod)
             fmpz_mul(t + k, t + k, u);
     }
 
-    /* reduce col i to have gcd in row i */
-    for (k = i + 1; k < n; k++)
-    {
-        fmpz_mod(t + k - i - 1, t + k - i - 1, mod);
-        for (j = i; j < m; j++)
-            fmpz_addmul(fmpz_mat_entry(S, j, i), t + k - i - 1,
-                    fmpz_mat_entry(S, j, k));
-    }
+    for (k = 0; k < n - i - 1; k++)
+        fmpz_mod(t + k, t + k, mod);
 
-    _fmpz_vec_clear(t, n - i - 1);
-
-    /* reduce each col k with col i */
-    if (!fmpz_is_zero(g)) /* if g = 0 then don't need to reduce */
+    /* multipliers for reducing each col k with col i; the entries of row i
+       right of the diagonal are not changed by the column combination */
+    if (!fmpz_is_zero(g))
     {
         for (k = i + 1; k < n; k++)
         {
-            fmpz_divexact(r1g, fmpz_mat_entry(S, i, k), g);
-            fmpz_neg(r1g, r1g);
-            for (j = i; j < m; j++)
-                fmpz_addmul(fmpz_mat_entry(S, j, k), r1g,
-                        fmpz_mat_entry(S, j, i));
+            fmpz_divexact(r + k - i - 1, fmpz_mat_entry(S, i, k), g);
+            fmpz_neg(r + k - i - 1, r + k - i - 1);
         }
     }
-    for (j = i + 1; j < m; j++)
-        for (k = i; k < n; k++)
-            fmpz_fdiv_r(fmpz_mat_entry(S, j, k), fmpz_mat_entry(S, j, k), mod);
+
+    work.S = S;
+    work.i = i;
+    work.mod = mod;
+    work.g = g;
+    work.t = t;
+    work.r = r;
+
+    /* the column operations act independently on each row */
+    flint_parallel_do((do_func_t) _row_reduce_worker, &work, m - i,
+            _thread_limit(S, i), FLINT_PARALLEL_UNIFORM);
+
+    _fmpz_vec_clear(t, n - i - 1);
+    _fmpz_vec_clear(r, n - i - 1);
+
     fmpz_gcd(fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, i, i), mod);
 
     fmpz_clear(b);
@@ -195,7 +275,6 @@ static void _eliminate_row(fmpz_mat_t S, slong i, const fmpz_t mod)
     fmpz_clear(u);
     fmpz_clear(r1g);
     fmpz_clear(r2g);
-    fmpz_clear(halfmod);
 }
 
 void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A, const fmpz_t mod)
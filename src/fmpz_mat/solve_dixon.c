@@ -9,7 +9,9 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "ulong_extras.h"
+#include "nmod.h"
 #include "nmod_mat.h"
 #include "fmpz.h"
 #include "fmpz_mat.h"
@@ -44,14 +46,12 @@ fmpz_mat_find_good_prime_and_invert(nmod_mat_t Ainv,
     return p;
 }
 
-/* We need to perform several matrix-vector products Ay, and speed them
+/* We need to perform several matrix products Ay, and speed them
    up by using modular multiplication (this is only faster if we
    precompute the modular matrices). Note: we assume that all
    primes are >= p. This allows reusing y_mod as the right-hand
    side without reducing it. */
 
-#define USE_SLOW_MULTIPLICATION 0
-
 mp_limb_t * fmpz_mat_dixon_get_crt_primes(slong * num_primes, const fmpz_mat_t A, mp_limb_t p)
 {
     fmpz_t bound, prod;
@@ -89,6 +89,254 @@ mp_limb_t * fmpz_mat_dixon_get_crt_primes(slong * num_primes, const fmpz_mat_t A
     return primes;
 }
 
+typedef struct
+{
+    fmpz_mat_struct * d;
+    nmod_mat_struct * d_mod;
+    const nmod_mat_struct * y_mod;
+    nmod_mat_t * A_mod;
+    nmod_mat_struct * Ay_mod;
+    const fmpz_comb_struct * comb;
+    slong num_primes;
+    mp_limb_t pinv;     /* p^(-1) mod primes[1] */
+    mp_limb_t half[2];  /* floor(p primes[1] / 2) */
+}
+dixon_update_arg_t;
+
+static void
+_dixon_mul_worker(slong j, dixon_update_arg_t * arg)
+{
+    nmod_mat_t y;
+
+    /* the entries of y are reduced modulo p < primes[j + 1] */
+    nmod_mat_window_init(y, arg->y_mod, 0, 0, arg->y_mod->r, arg->y_mod->c);
+    nmod_mat_set_mod(y, arg->Ay_mod[j].mod.n);
+    nmod_mat_mul(arg->Ay_mod + j, arg->A_mod[j + 1], y);
+    nmod_mat_window_clear(y);
+}
+
+static void
+_dixon_update_worker(slong i, dixon_update_arg_t * arg)
+{
+    fmpz * d = arg->d->rows[i];
+    mp_ptr d_mod = arg->d_mod->rows[i];
+    nmod_t mod = arg->d_mod->mod;
+    slong j, l, cols = arg->d->c, num_primes = arg->num_primes;
+    mp_ptr r = NULL;
+    fmpz_comb_temp_t temp;
+    fmpz_t t;
+
+    fmpz_init(t);
+
+    if (num_primes > 1)
+    {
+        r = flint_malloc(sizeof(mp_limb_t) * num_primes);
+        fmpz_comb_temp_init(temp, arg->comb);
+    }
+
+    for (j = 0; j < cols; j++)
+    {
+        if (num_primes == 2 && !COEFF_IS_MPZ(d[j]))
+        {
+            /* Ay = r0 + p u for u = (r1 - r0) / p mod q, centered, whence
+               d - Ay = ((d - r0) / p - u) p, all in single words */
+            nmod_t qmod = arg->Ay_mod[0].mod;
+            mp_limb_t r0 = d_mod[j], u, hi, lo;
+            slong e = d[j];
+
+            u = nmod_sub(arg->Ay_mod[0].rows[i][j], r0, qmod);
+            u = nmod_mul(u, arg->pinv, qmod);
+
+            umul_ppmm(hi, lo, mod.n, u);
+            add_ssaaaa(hi, lo, hi, lo, 0, r0);
+
+            e = (e - (slong) r0) / (slong) mod.n - (slong) u;
+
+            if (hi > arg->half[1] || (hi == arg->half[1] && lo > arg->half[0]))
+                e += (slong) qmod.n;
+
+            fmpz_set_si(d + j, e);
+
+            if (e >= 0)
+            {
+                NMOD_RED(d_mod[j], e, mod);
+            }
+            else
+            {
+                NMOD_RED(u, -e, mod);
+                d_mod[j] = nmod_neg(u, mod);
+            }
+
+            continue;
+        }
+
+        /* t = (Ay)_ij, where Ay = d mod p */
+        if (num_primes == 1)
+        {
+            if (d_mod[j] > mod.n / 2)
+                fmpz_neg_ui(t, mod.n - d_mod[j]);
+            else
+                fmpz_set_ui(t, d_mod[j]);
+        }
+        else
+        {
+            r[0] = d_mod[j];
+            for (l = 1; l < num_primes; l++)
+                r[l] = arg->Ay_mod[l - 1].rows[i][j];
+
+            fmpz_multi_CRT_ui(t, r, arg->comb, temp, 1);
+        }
+
+        fmpz_sub(d + j, d + j, t);
+        fmpz_divexact_ui(d + j, d + j, mod.n);
+        d_mod[j] = fmpz_get_nmod(d + j, mod);
+    }
+
+    if (num_primes > 1)
+    {
+        flint_free(r);
+        fmpz_comb_temp_clear(temp);
+    }
+
+    fmpz_clear(t);
+}
+
+/*
+    Sets d to (d - Ay) / p and d_mod to d mod p, where y = A^(-1) d mod p.
+    Since Ay = d modulo p = primes[0], only the products modulo the remaining
+    CRT primes need to be computed. These products are computed in
+    parallel, followed by the entrywise updates, in parallel over the rows.
+*/
+void
+_fmpz_mat_dixon_update(fmpz_mat_t d, nmod_mat_t d_mod, const nmod_mat_t y_mod,
+                   nmod_mat_t * A_mod, const mp_limb_t * primes, slong num_primes)
+{
+    dixon_update_arg_t arg;
+    nmod_mat_struct * Ay_mod;
+    fmpz_comb_t comb;
+    slong j;
+
+    Ay_mod = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
+
+    for (j = 1; j < num_primes; j++)
+        nmod_mat_init(Ay_mod + j - 1, d->r, d->c, primes[j]);
+
+    if (num_primes > 1)
+        fmpz_comb_init(comb, primes, num_primes);
+
+    arg.d = d;
+    arg.d_mod = d_mod;
+    arg.y_mod = y_mod;
+    arg.A_mod = A_mod;
+    arg.Ay_mod = Ay_mod;
+    arg.comb = (num_primes > 1) ? comb : NULL;
+    arg.num_primes = num_primes;
+
+    if (num_primes == 2)
+    {
+        arg.pinv = n_invmod(primes[0], primes[1]);
+        umul_ppmm(arg.half[1], arg.half[0], primes[0], primes[1]);
+        arg.half[0] = (arg.half[0] >> 1) | (arg.half[1] << (FLINT_BITS - 1));
+        arg.half[1] >>= 1;
+    }
+
+    flint_parallel_do((do_func_t) _dixon_mul_worker, &arg, num_primes - 1, -1, FLINT_PARALLEL_UNIFORM);
+
+    flint_parallel_do((do_func_t) _dixon_update_worker, &arg, d->r, -1, FLINT_PARALLEL_STRIDED);
+
+    for (j = 1; j < num_primes; j++)
+        nmod_mat_clear(Ay_mod + j - 1);
+
+    if (num_primes > 1)
+        fmpz_comb_clear(comb);
+
+    flint_free(Ay_mod);
+}
+
+typedef struct
+{
+    fmpz_mat_struct * x;
+    const nmod_mat_struct * y;
+    slong k;
+    const fmpz * ppow;
+}
+dixon_digits_arg_t;
+
+static void
+_dixon_digits_worker(slong i, dixon_digits_arg_t * arg)
+{
+    const nmod_mat_struct * y = arg->y;
+    mp_limb_t p = y->mod.n, c;
+    mp_ptr v;
+    slong j, l, vn, k = arg->k;
+    fmpz_t t;
+
+    fmpz_init(t);
+    v = flint_malloc(sizeof(mp_limb_t) * (k + 1));
+
+    for (j = 0; j < arg->x->c; j++)
+    {
+        /* v = sum y_l p^l by Horner's rule */
+        v[0] = y[k - 1].rows[i][j];
+        vn = 1;
+
+        for (l = k - 2; l >= 0; l--)
+        {
+            c = mpn_mul_1(v, v, vn, p);
+            if (c != 0)
+                v[vn++] = c;
+
+            c = mpn_add_1(v, v, vn, y[l].rows[i][j]);
+            if (c != 0)
+                v[vn++] = c;
+        }
+
+        fmpz_set_ui_array(t, v, vn);
+        fmpz_addmul(fmpz_mat_entry(arg->x, i, j), t, arg->ppow);
+    }
+
+    flint_free(v);
+    fmpz_clear(t);
+}
+
+/*
+    Sets x to x + (y_0 + y_1 p + ... + y_(k-1) p^(k-1)) ppow, where the
+    p-adic digits y_l are matrices modulo p. Adding the digits in chunks
+    avoids the cost of an addition to the full size x for every digit.
+*/
+void
+_fmpz_mat_dixon_add_digits(fmpz_mat_t x, const nmod_mat_struct * y,
+                                                slong k, const fmpz_t ppow)
+{
+    dixon_digits_arg_t arg;
+
+    if (k == 0)
+        return;
+
+    arg.x = x;
+    arg.y = y;
+    arg.k = k;
+    arg.ppow = ppow;
+
+    flint_parallel_do((do_func_t) _dixon_digits_worker, &arg, x->r, -1, FLINT_PARALLEL_STRIDED);
+}
+
+slong
+_fmpz_mat_dixon_num_steps(const fmpz_t bound, mp_limb_t p)
+{
+    fmpz_t ppow;
+    slong k;
+
+    fmpz_init(ppow);
+    fmpz_one(ppow);
+
+    for (k = 0; fmpz_cmp(ppow, bound) <= 0; k++)
+        fmpz_mul_ui(ppow, ppow, p);
+
+    fmpz_clear(ppow);
+
+    return k;
+}
 
 void
 _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
@@ -97,23 +345,20 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
                     const fmpz_t N, const fmpz_t D)
 {
     fmpz_t bound, ppow;
-    fmpz_mat_t x, d, y, Ay;
-    fmpz_t prod;
+    fmpz_mat_t x, d;
     mp_limb_t * crt_primes;
     nmod_mat_t * A_mod;
-    nmod_mat_t Ay_mod, d_mod, y_mod;
-    slong i, n, cols, num_primes;
+    nmod_mat_t d_mod;
+    nmod_mat_struct * y;
+    slong i, j, n, cols, num_primes, num_steps, chunk;
 
     n = A->r;
     cols = B->c;
 
     fmpz_init(bound);
     fmpz_init(ppow);
-    fmpz_init(prod);
 
     fmpz_mat_init(x, n, cols);
-    fmpz_mat_init(y, n, cols);
-    fmpz_mat_init(Ay, n, cols);
     fmpz_mat_init_set(d, B);
 
     /* Compute bound for the needed modulus. TODO: if one of N and D
@@ -135,60 +380,45 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         fmpz_mat_get_nmod_mat(A_mod[i], A);
     }
 
-    nmod_mat_init(Ay_mod, n, cols, UWORD(1));
     nmod_mat_init(d_mod, n, cols, p);
-    nmod_mat_init(y_mod, n, cols, p);
+    fmpz_mat_get_nmod_mat(d_mod, d);
+
+    /* the p-adic digits are added to x in chunks of about sqrt(num_steps) */
+    num_steps = _fmpz_mat_dixon_num_steps(bound, p);
+    chunk = n_sqrt(num_steps);
+
+    y = flint_malloc(sizeof(nmod_mat_struct) * chunk);
+    for (j = 0; j < chunk; j++)
+        nmod_mat_init(y + j, n, cols, p);
 
     fmpz_one(ppow);
 
-    while (fmpz_cmp(ppow, bound) <= 0)
+    for (i = 0, j = 0; i < num_steps; i++)
     {
         /* y = A^(-1) * d  (mod p) */
-        fmpz_mat_get_nmod_mat(d_mod, d);
-        nmod_mat_mul(y_mod, Ainv, d_mod);
-
-        /* x = x + y * p^i    [= A^(-1) * b mod p^(i+1)] */
-        fmpz_mat_scalar_addmul_nmod_mat_fmpz(x, y_mod, ppow);
-
-        /* ppow = p^(i+1) */
-        fmpz_mul_ui(ppow, ppow, p);
-        if (fmpz_cmp(ppow, bound) > 0)
-            break;
+        nmod_mat_mul(y + j, Ainv, d_mod);
 
         /* d = (d - Ay) / p */
-#if USE_SLOW_MULTIPLICATION
-        fmpz_mat_set_nmod_mat_unsigned(y, y_mod);
-        fmpz_mat_mul(Ay, A, y);
-#else
-        for (i = 0; i < num_primes; i++)
+        if (i < num_steps - 1)
+            _fmpz_mat_dixon_update(d, d_mod, y + j, A_mod, crt_primes, num_primes);
+
+        /* x = x + y * p^i    [= A^(-1) * b mod p^(i+1)] */
+        if (++j == chunk || i == num_steps - 1)
         {
-            nmod_mat_set_mod(y_mod, crt_primes[i]);
-            nmod_mat_set_mod(Ay_mod, crt_primes[i]);
-            nmod_mat_mul(Ay_mod, A_mod[i], y_mod);
-            if (i == 0)
-            {
-                fmpz_mat_set_nmod_mat(Ay, Ay_mod);
-                fmpz_set_ui(prod, crt_primes[0]);
-            }
-            else
-            {
-                fmpz_mat_CRT_ui(Ay, Ay, prod, Ay_mod, 1);
-                fmpz_mul_ui(prod, prod, crt_primes[i]);
-            }
+            _fmpz_mat_dixon_add_digits(x, y, j, ppow);
+            for ( ; j > 0; j--)
+                fmpz_mul_ui(ppow, ppow, p);
         }
-#endif
-
-        nmod_mat_set_mod(y_mod, p);
-        fmpz_mat_sub(d, d, Ay);
-        fmpz_mat_scalar_divexact_ui(d, d, p);
     }
 
     fmpz_set(mod, ppow);
     fmpz_mat_set(X, x);
 
-    nmod_mat_clear(y_mod);
+    for (j = 0; j < chunk; j++)
+        nmod_mat_clear(y + j);
+    flint_free(y);
+
     nmod_mat_clear(d_mod);
-    nmod_mat_clear(Ay_mod);
 
     for (i = 0; i < num_primes; i++)
         nmod_mat_clear(A_mod[i]);
@@ -198,12 +428,9 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
     fmpz_clear(bound);
     fmpz_clear(ppow);
-    fmpz_clear(prod);
 
     fmpz_mat_clear(x);
-    fmpz_mat_clear(y);
     fmpz_mat_clear(d);
-    fmpz_mat_clear(Ay);
 }
 
 int
@@ -28,6 +28,8 @@ main(void)
         slong m, n, r, b, d;
         int equal;
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         n = 1 + n_randint(state, 10);
         m = 1 + n_randint(state, 10);
         r = n_randint(state, FLINT_MIN(m, n) + 1);
@@ -157,6 +159,7 @@ main(void)
     }
 
     FLINT_TEST_CLEANUP(state);
+    flint_cleanup_master();
 
     flint_printf("PASS\n");
     return 0;
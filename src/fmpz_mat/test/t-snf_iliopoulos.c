@@ -28,7 +28,13 @@ main(void)
         slong m, n, b, d;
         int equal;
 
-        m = n_randint(state, 10);
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        /* occasionally large enough for the threaded elimination */
+        if (iter % 1000 == 0)
+            m = 20 + n_randint(state, 10);
+        else
+            m = n_randint(state, 10);
         n = m;
 
         fmpz_init(mod);
@@ -60,6 +66,34 @@ main(void)
             flint_abort();
         }
 
+        if (m >= 20)
+        {
+            slong i, num_threads = flint_get_num_threads();
+            fmpz_t p;
+
+            flint_set_num_threads(1);
+            fmpz_mat_snf_iliopoulos(S2, A, mod);
+            flint_set_num_threads(num_threads);
+
+            fmpz_init(p);
+            fmpz_one(p);
+            for (i = 0; i < m; i++)
+                fmpz_mul(p, p, fmpz_mat_entry(S, i, i));
+
+            if (!fmpz_mat_equal(S, S2) || !fmpz_equal(p, mod))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("threaded snf not consistent!\n");
+                fmpz_mat_print_pretty(A); flint_printf("\n\n");
+                fmpz_mat_print_pretty(S); flint_printf("\n\n");
+                fmpz_mat_print_pretty(S2); flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+
+            fmpz_clear(p);
+        }
+
         fmpz_mat_snf_iliopoulos(S2, S, mod);
         equal = fmpz_mat_equal(S, S2);
 
@@ -95,6 +129,7 @@ main(void)
     }
 
     FLINT_TEST_CLEANUP(state);
+    flint_cleanup_master();
 
     flint_printf("PASS\n");
     return 0;
@@ -11,6 +11,7 @@
 
 #include "fmpz.h"
 #include "fmpz_mat.h"
+#include "fmpq_mat.h"
 
 int
 main(void)
@@ -30,6 +31,8 @@ main(void)
         m = n_randint(state, 20);
         n = n_randint(state, 20);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         fmpz_mat_init(A, m, m);
         fmpz_mat_init(B, m, n);
         fmpz_mat_init(Bm, m, n);
@@ -76,6 +79,58 @@ main(void)
         fmpz_clear(mod);
     }
 
+    /* Test many right-hand sides, recovering the rational solution */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpq_mat_t Q, AQ;
+
+        m = 1 + n_randint(state, 30);
+        n = 1 + n_randint(state, 60);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_mat_init(A, m, m);
+        fmpz_mat_init(B, m, n);
+        fmpz_mat_init(X, m, n);
+        fmpq_mat_init(Q, m, n);
+        fmpq_mat_init(AQ, m, n);
+        fmpz_init(mod);
+
+        fmpz_mat_randrank(A, state, m, 1+n_randint(state, 2)*n_randint(state, 100));
+        fmpz_mat_randops(A, state, 1+n_randint(state, 1 + m*m));
+        fmpz_mat_randtest(B, state, 1+n_randint(state, 2)*n_randint(state, 100));
+
+        success = fmpz_mat_solve_dixon(X, mod, A, B);
+
+        if (!success || !fmpq_mat_set_fmpz_mat_mod_fmpz(Q, X, mod))
+        {
+            flint_printf("FAIL (many right-hand sides):\n");
+            flint_printf("success = %d\n", success);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpq_mat_mul_r_fmpz_mat(AQ, A, Q);
+        fmpz_mat_init(AX, m, n);
+
+        if (!fmpq_mat_get_fmpz_mat(AX, AQ) || !fmpz_mat_equal(AX, B))
+        {
+            flint_printf("FAIL (many right-hand sides):\n");
+            flint_printf("A:\n"), fmpz_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("B:\n"), fmpz_mat_print_pretty(B), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(X);
+        fmpz_mat_clear(AX);
+        fmpq_mat_clear(Q);
+        fmpq_mat_clear(AQ);
+        fmpz_clear(mod);
+    }
+
     /* Test singular systems */
     for (i = 0; i < 100 * flint_test_multiplier(); i++)
     {
@@ -110,6 +165,7 @@ main(void)
     }
 
     FLINT_TEST_CLEANUP(state);
+    flint_cleanup_master();
 
     flint_printf("PASS\n");
     return 0;
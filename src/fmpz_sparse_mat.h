@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef FMPZ_SPARSE_MAT_H
+#define FMPZ_SPARSE_MAT_H
+
+#ifdef FMPZ_SPARSE_MAT_INLINES_C
+#define FMPZ_SPARSE_MAT_INLINE
+#else
+#define FMPZ_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#include "fmpz_types.h"
+#include "nmod_sparse_mat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Compressed sparse row storage as for nmod_sparse_mat; the entries
+    entries[k] for nnz <= k < alloc are initialised but unused.
+*/
+typedef struct
+{
+    slong r;
+    slong c;
+    slong * row_start;
+    slong * cols;
+    fmpz * entries;
+    slong alloc;
+}
+fmpz_sparse_mat_struct;
+
+typedef fmpz_sparse_mat_struct fmpz_sparse_mat_t[1];
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_nrows(const fmpz_sparse_mat_t A)
+{
+    return A->r;
+}
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_ncols(const fmpz_sparse_mat_t A)
+{
+    return A->c;
+}
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_nnz(const fmpz_sparse_mat_t A)
+{
+    return A->row_start[A->r];
+}
+
+/* Memory management */
+
+void fmpz_sparse_mat_init(fmpz_sparse_mat_t A, slong rows, slong cols);
+
+void fmpz_sparse_mat_clear(fmpz_sparse_mat_t A);
+
+void fmpz_sparse_mat_fit_nnz(fmpz_sparse_mat_t A, slong nnz);
+
+void fmpz_sparse_mat_swap(fmpz_sparse_mat_t A, fmpz_sparse_mat_t B);
+
+void fmpz_sparse_mat_zero(fmpz_sparse_mat_t A);
+
+void fmpz_sparse_mat_set(fmpz_sparse_mat_t A, const fmpz_sparse_mat_t B);
+
+/* Conversions */
+
+void fmpz_sparse_mat_set_entries(fmpz_sparse_mat_t A, const slong * rows,
+                      const slong * cols, const fmpz * entries, slong len);
+
+void fmpz_sparse_mat_set_fmpz_mat(fmpz_sparse_mat_t A, const fmpz_mat_t B);
+
+void fmpz_sparse_mat_get_fmpz_mat(fmpz_mat_t A, const fmpz_sparse_mat_t B);
+
+void fmpz_sparse_mat_get_nmod_sparse_mat(nmod_sparse_mat_t Amod,
+                                                 const fmpz_sparse_mat_t A);
+
+void fmpz_sparse_mat_get_entry(fmpz_t x, const fmpz_sparse_mat_t A,
+                                                         slong i, slong j);
+
+/* Basic properties and operations */
+
+int fmpz_sparse_mat_equal(const fmpz_sparse_mat_t A, const fmpz_sparse_mat_t B);
+
+void fmpz_sparse_mat_randtest(fmpz_sparse_mat_t A, flint_rand_t state,
+                               slong min_nnz, slong max_nnz, flint_bitcnt_t bits);
+
+void fmpz_sparse_mat_transpose(fmpz_sparse_mat_t B, const fmpz_sparse_mat_t A);
+
+/* Multiplication */
+
+void fmpz_sparse_mat_mul_vec(fmpz * y, const fmpz_sparse_mat_t A, const fmpz * x);
+
+void fmpz_sparse_mat_mul_fmpz_mat(fmpz_mat_t C, const fmpz_sparse_mat_t A,
+                                                          const fmpz_mat_t B);
+
+/* Solving */
+
+int fmpz_sparse_mat_solve_dixon(fmpz_mat_t X, fmpz_t den,
+        const fmpz_sparse_mat_t A, const fmpz_mat_t B, flint_rand_t state);
+
+/* Rank and nullspace */
+
+slong _fmpz_sparse_mat_echelon(fmpz_sparse_mat_t R, slong * perm,
+                                            const fmpz_sparse_mat_t A);
+
+slong fmpz_sparse_mat_rank(const fmpz_sparse_mat_t A);
+
+slong fmpz_sparse_mat_nullspace(fmpz_sparse_mat_t X, const fmpz_sparse_mat_t A);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
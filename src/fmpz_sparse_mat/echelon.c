@@ -0,0 +1,267 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_sparse_mat.h"
+
+typedef struct
+{
+    slong key;
+    slong idx;
+}
+_key_t;
+
+static int
+_key_cmp(const void * a, const void * b)
+{
+    slong x = ((const _key_t *) a)->key;
+    slong y = ((const _key_t *) b)->key;
+    slong u = ((const _key_t *) a)->idx;
+    slong v = ((const _key_t *) b)->idx;
+
+    if (x != y)
+        return (x > y) - (x < y);
+
+    return (u > v) - (u < v);
+}
+
+typedef struct
+{
+    slong * pos;
+    fmpz * val;
+    slong len;
+}
+_row_t;
+
+/* dst = a * src - b * piv, where both rows are sorted by position */
+static slong
+_row_lincomb(slong * dpos, fmpz * dval, const fmpz_t a, const slong * spos,
+       const fmpz * sval, slong slen, const fmpz_t b, const _row_t * piv)
+{
+    slong i, j, k;
+
+    i = j = k = 0;
+
+    while (i < slen && j < piv->len)
+    {
+        if (spos[i] < piv->pos[j])
+        {
+            dpos[k] = spos[i];
+            fmpz_mul(dval + k, sval + i, a);
+            i++;
+            k++;
+        }
+        else if (spos[i] > piv->pos[j])
+        {
+            dpos[k] = piv->pos[j];
+            fmpz_mul(dval + k, piv->val + j, b);
+            fmpz_neg(dval + k, dval + k);
+            j++;
+            k++;
+        }
+        else
+        {
+            fmpz_mul(dval + k, sval + i, a);
+            fmpz_submul(dval + k, piv->val + j, b);
+
+            if (!fmpz_is_zero(dval + k))
+            {
+                dpos[k] = spos[i];
+                k++;
+            }
+
+            i++;
+            j++;
+        }
+    }
+
+    for ( ; i < slen; i++, k++)
+    {
+        dpos[k] = spos[i];
+        fmpz_mul(dval + k, sval + i, a);
+    }
+
+    for ( ; j < piv->len; j++, k++)
+    {
+        dpos[k] = piv->pos[j];
+        fmpz_mul(dval + k, piv->val + j, b);
+        fmpz_neg(dval + k, dval + k);
+    }
+
+    return k;
+}
+
+slong
+_fmpz_sparse_mat_echelon(fmpz_sparse_mat_t R, slong * perm,
+                                            const fmpz_sparse_mat_t A)
+{
+    _key_t * keys;
+    _row_t * piv;
+    slong * inv, * pos[2];
+    fmpz * val[2];
+    fmpz_t a, b, g;
+    slong i, j, k, len, rank, nnz, alloc, cur;
+
+    /* order the columns by increasing number of entries */
+    keys = flint_malloc(sizeof(_key_t) * FLINT_MAX(FLINT_MAX(A->r, A->c), 1));
+    inv = flint_malloc(sizeof(slong) * FLINT_MAX(A->c, 1));
+
+    for (j = 0; j < A->c; j++)
+    {
+        keys[j].key = 0;
+        keys[j].idx = j;
+    }
+
+    for (k = 0; k < fmpz_sparse_mat_nnz(A); k++)
+        keys[A->cols[k]].key++;
+
+    qsort(keys, A->c, sizeof(_key_t), _key_cmp);
+
+    for (j = 0; j < A->c; j++)
+    {
+        perm[j] = keys[j].idx;
+        inv[keys[j].idx] = j;
+    }
+
+    /* eliminate the shortest rows first */
+    for (i = 0; i < A->r; i++)
+    {
+        keys[i].key = A->row_start[i + 1] - A->row_start[i];
+        keys[i].idx = i;
+    }
+
+    qsort(keys, A->r, sizeof(_key_t), _key_cmp);
+
+    piv = flint_calloc(FLINT_MAX(A->c, 1), sizeof(_row_t));
+
+    alloc = FLINT_MAX(A->c, 1);
+    pos[0] = flint_malloc(sizeof(slong) * alloc);
+    pos[1] = flint_malloc(sizeof(slong) * alloc);
+    val[0] = _fmpz_vec_init(alloc);
+    val[1] = _fmpz_vec_init(alloc);
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(g);
+
+    rank = 0;
+
+    for (i = 0; i < A->r && rank < A->c; i++)
+    {
+        slong r = keys[i].idx;
+        _key_t * tmp;
+
+        len = A->row_start[r + 1] - A->row_start[r];
+
+        if (len == 0)
+            continue;
+
+        /* the row in pivot positions, sorted */
+        tmp = flint_malloc(sizeof(_key_t) * len);
+        for (k = 0; k < len; k++)
+        {
+            tmp[k].key = inv[A->cols[A->row_start[r] + k]];
+            tmp[k].idx = k;
+        }
+        qsort(tmp, len, sizeof(_key_t), _key_cmp);
+        for (k = 0; k < len; k++)
+        {
+            pos[0][k] = tmp[k].key;
+            fmpz_set(val[0] + k, A->entries + A->row_start[r] + tmp[k].idx);
+        }
+        flint_free(tmp);
+
+        cur = 0;
+
+        /* fraction-free reduction of the leading entry until it is not a
+           pivot position, removing the content to limit the growth */
+        while (len != 0 && piv[pos[cur][0]].len != 0)
+        {
+            const _row_t * p = piv + pos[cur][0];
+
+            fmpz_gcd(g, p->val, val[cur]);
+            fmpz_divexact(a, p->val, g);
+            fmpz_divexact(b, val[cur], g);
+
+            len = _row_lincomb(pos[1 - cur], val[1 - cur], a, pos[cur],
+                               val[cur], len, b, p);
+            cur = 1 - cur;
+
+            _fmpz_vec_content(g, val[cur], len);
+            if (len != 0 && !fmpz_is_one(g))
+                _fmpz_vec_scalar_divexact_fmpz(val[cur], val[cur], len, g);
+        }
+
+        if (len != 0)
+        {
+            _row_t * p = piv + pos[cur][0];
+
+            p->len = len;
+            p->pos = flint_malloc(sizeof(slong) * len);
+            p->val = _fmpz_vec_init(len);
+
+            for (k = 0; k < len; k++)
+                p->pos[k] = pos[cur][k];
+
+            if (fmpz_sgn(val[cur]) < 0)
+                _fmpz_vec_neg(p->val, val[cur], len);
+            else
+                _fmpz_vec_set(p->val, val[cur], len);
+
+            rank++;
+        }
+    }
+
+    /* the pivot rows in order of their leading positions */
+    nnz = 0;
+    for (j = 0; j < A->c; j++)
+        nnz += piv[j].len;
+
+    fmpz_sparse_mat_clear(R);
+    fmpz_sparse_mat_init(R, rank, A->c);
+    fmpz_sparse_mat_fit_nnz(R, nnz);
+
+    for (i = j = nnz = 0; j < A->c; j++)
+    {
+        if (piv[j].len == 0)
+            continue;
+
+        R->row_start[i] = nnz;
+
+        for (k = 0; k < piv[j].len; k++, nnz++)
+        {
+            R->cols[nnz] = piv[j].pos[k];
+            fmpz_swap(R->entries + nnz, piv[j].val + k);
+        }
+
+        flint_free(piv[j].pos);
+        _fmpz_vec_clear(piv[j].val, piv[j].len);
+        i++;
+    }
+
+    R->row_start[rank] = nnz;
+
+    flint_free(keys);
+    flint_free(inv);
+    flint_free(piv);
+    flint_free(pos[0]);
+    flint_free(pos[1]);
+    _fmpz_vec_clear(val[0], alloc);
+    _fmpz_vec_clear(val[1], alloc);
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(g);
+
+    return rank;
+}
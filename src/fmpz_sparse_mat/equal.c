@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_sparse_mat.h"
+
+int
+fmpz_sparse_mat_equal(const fmpz_sparse_mat_t A, const fmpz_sparse_mat_t B)
+{
+    slong i;
+
+    if (A->r != B->r || A->c != B->c)
+        return 0;
+
+    for (i = 0; i <= A->r; i++)
+        if (A->row_start[i] != B->row_start[i])
+            return 0;
+
+    for (i = 0; i < fmpz_sparse_mat_nnz(A); i++)
+        if (A->cols[i] != B->cols[i] || !fmpz_equal(A->entries + i, B->entries + i))
+            return 0;
+
+    return 1;
+}
@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_fit_nnz(fmpz_sparse_mat_t A, slong nnz)
+{
+    slong i;
+
+    if (nnz > A->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2 * A->alloc);
+
+        A->cols = flint_realloc(A->cols, sizeof(slong) * nnz);
+        A->entries = flint_realloc(A->entries, sizeof(fmpz) * nnz);
+
+        for (i = A->alloc; i < nnz; i++)
+            fmpz_init(A->entries + i);
+
+        A->alloc = nnz;
+    }
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_get_entry(fmpz_t x, const fmpz_sparse_mat_t A, slong i, slong j)
+{
+    slong lo, hi, mid;
+
+    /* binary search in row i */
+    lo = A->row_start[i];
+    hi = A->row_start[i + 1];
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+
+        if (A->cols[mid] < j)
+            lo = mid + 1;
+        else if (A->cols[mid] > j)
+            hi = mid;
+        else
+        {
+            fmpz_set(x, A->entries + mid);
+            return;
+        }
+    }
+
+    fmpz_zero(x);
+}
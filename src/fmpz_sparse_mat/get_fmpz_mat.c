@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_get_fmpz_mat(fmpz_mat_t A, const fmpz_sparse_mat_t B)
+{
+    slong i, k;
+
+    fmpz_mat_zero(A);
+
+    for (i = 0; i < B->r; i++)
+        for (k = B->row_start[i]; k < B->row_start[i + 1]; k++)
+            fmpz_set(fmpz_mat_entry(A, i, B->cols[k]), B->entries + k);
+}
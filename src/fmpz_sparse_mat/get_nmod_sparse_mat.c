@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_get_nmod_sparse_mat(nmod_sparse_mat_t Amod,
+                                                const fmpz_sparse_mat_t A)
+{
+    slong i, k, nnz;
+    mp_limb_t t;
+
+    if (Amod->r != A->r)
+    {
+        Amod->row_start = flint_realloc(Amod->row_start, sizeof(slong) * (A->r + 1));
+        Amod->r = A->r;
+    }
+
+    Amod->c = A->c;
+
+    nmod_sparse_mat_fit_nnz(Amod, fmpz_sparse_mat_nnz(A));
+
+    /* entries divisible by the modulus are dropped */
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        Amod->row_start[i] = nnz;
+
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+        {
+            t = fmpz_get_nmod(A->entries + k, Amod->mod);
+
+            if (t != 0)
+            {
+                Amod->cols[nnz] = A->cols[k];
+                Amod->entries[nnz] = t;
+                nnz++;
+            }
+        }
+    }
+
+    Amod->row_start[A->r] = nnz;
+}
@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "thread_support.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+
+#define FMPZ_SPARSE_MAT_MUL_BLOCK 1024
+
+typedef struct
+{
+    fmpz_mat_struct * C;
+    const fmpz_sparse_mat_struct * A;
+    const fmpz_mat_struct * B;
+    slong block;
+}
+mul_mat_arg_t;
+
+static void
+_fmpz_sparse_mat_mul_fmpz_mat_rows(fmpz_mat_t C, const fmpz_sparse_mat_t A,
+                                  const fmpz_mat_t B, slong start, slong stop)
+{
+    slong i, k;
+
+    for (i = start; i < stop; i++)
+    {
+        _fmpz_vec_zero(C->rows[i], B->c);
+
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+            _fmpz_vec_scalar_addmul_fmpz(C->rows[i], B->rows[A->cols[k]],
+                                                     B->c, A->entries + k);
+    }
+}
+
+static void
+_mul_mat_worker(slong i, mul_mat_arg_t * arg)
+{
+    slong start = i * arg->block;
+    slong stop = FLINT_MIN(start + arg->block, arg->A->r);
+
+    _fmpz_sparse_mat_mul_fmpz_mat_rows(arg->C, arg->A, arg->B, start, stop);
+}
+
+void
+fmpz_sparse_mat_mul_fmpz_mat(fmpz_mat_t C, const fmpz_sparse_mat_t A,
+                                                          const fmpz_mat_t B)
+{
+    mul_mat_arg_t arg;
+    slong work, num_blocks;
+
+    if (C == B)
+    {
+        fmpz_mat_t T;
+        fmpz_mat_init(T, C->r, C->c);
+        fmpz_sparse_mat_mul_fmpz_mat(T, A, B);
+        fmpz_mat_swap_entrywise(C, T);
+        fmpz_mat_clear(T);
+        return;
+    }
+
+    if (B->c == 0)
+        return;
+
+    work = fmpz_sparse_mat_nnz(A) * B->c;
+
+    if (work < FMPZ_SPARSE_MAT_MUL_BLOCK || flint_get_num_threads() == 1)
+    {
+        _fmpz_sparse_mat_mul_fmpz_mat_rows(C, A, B, 0, A->r);
+        return;
+    }
+
+    num_blocks = work / FMPZ_SPARSE_MAT_MUL_BLOCK;
+    arg.block = FLINT_MAX((A->r + num_blocks - 1) / num_blocks, 1);
+    num_blocks = (A->r + arg.block - 1) / arg.block;
+
+    arg.C = C;
+    arg.A = A;
+    arg.B = B;
+
+    flint_parallel_do((do_func_t) _mul_mat_worker, &arg, num_blocks, -1, FLINT_PARALLEL_STRIDED);
+}
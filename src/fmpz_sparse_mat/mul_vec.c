@@ -0,0 +1,76 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "thread_support.h"
+#include "fmpz.h"
+#include "fmpz_sparse_mat.h"
+
+#define FMPZ_SPARSE_MAT_MUL_BLOCK 1024
+
+typedef struct
+{
+    fmpz * y;
+    const fmpz_sparse_mat_struct * A;
+    const fmpz * x;
+    slong block;
+}
+mul_vec_arg_t;
+
+static void
+_fmpz_sparse_mat_mul_vec_rows(fmpz * y, const fmpz_sparse_mat_t A,
+                                       const fmpz * x, slong start, slong stop)
+{
+    slong i, k;
+
+    for (i = start; i < stop; i++)
+    {
+        fmpz_zero(y + i);
+
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+            fmpz_addmul(y + i, A->entries + k, x + A->cols[k]);
+    }
+}
+
+static void
+_mul_vec_worker(slong i, mul_vec_arg_t * arg)
+{
+    slong start = i * arg->block;
+    slong stop = FLINT_MIN(start + arg->block, arg->A->r);
+
+    _fmpz_sparse_mat_mul_vec_rows(arg->y, arg->A, arg->x, start, stop);
+}
+
+void
+fmpz_sparse_mat_mul_vec(fmpz * y, const fmpz_sparse_mat_t A, const fmpz * x)
+{
+    mul_vec_arg_t arg;
+    slong nnz, num_blocks;
+
+    nnz = fmpz_sparse_mat_nnz(A);
+
+    if (nnz < FMPZ_SPARSE_MAT_MUL_BLOCK || flint_get_num_threads() == 1)
+    {
+        _fmpz_sparse_mat_mul_vec_rows(y, A, x, 0, A->r);
+        return;
+    }
+
+    /* blocks of rows with about FMPZ_SPARSE_MAT_MUL_BLOCK entries on average */
+    num_blocks = nnz / FMPZ_SPARSE_MAT_MUL_BLOCK;
+    arg.block = (A->r + num_blocks - 1) / num_blocks;
+    num_blocks = (A->r + arg.block - 1) / arg.block;
+
+    arg.y = y;
+    arg.A = A;
+    arg.x = x;
+
+    flint_parallel_do((do_func_t) _mul_vec_worker, &arg, num_blocks, -1, FLINT_PARALLEL_STRIDED);
+}
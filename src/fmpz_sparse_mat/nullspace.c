@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_sparse_mat.h"
+
+slong
+fmpz_sparse_mat_nullspace(fmpz_sparse_mat_t X, const fmpz_sparse_mat_t A)
+{
+    fmpz_sparse_mat_t R;
+    slong * perm, * lead, * rows, * cols;
+    fmpz * x, * entries;
+    fmpz_t s, g, t;
+    slong i, j, k, u, rank, nullity, len, alloc;
+
+    fmpz_sparse_mat_init(R, 0, A->c);
+    perm = flint_malloc(sizeof(slong) * FLINT_MAX(A->c, 1));
+
+    rank = _fmpz_sparse_mat_echelon(R, perm, A);
+    nullity = A->c - rank;
+
+    /* lead[j] is the row of R with leading position j, or -1 */
+    lead = flint_malloc(sizeof(slong) * FLINT_MAX(A->c, 1));
+    for (j = 0; j < A->c; j++)
+        lead[j] = -1;
+    for (i = 0; i < rank; i++)
+        lead[R->cols[R->row_start[i]]] = i;
+
+    x = _fmpz_vec_init(A->c);
+    fmpz_init(s);
+    fmpz_init(g);
+    fmpz_init(t);
+
+    alloc = FLINT_MAX(nullity, 1);
+    rows = flint_malloc(sizeof(slong) * alloc);
+    cols = flint_malloc(sizeof(slong) * alloc);
+    entries = _fmpz_vec_init(alloc);
+    len = 0;
+
+    /* one basis vector for each free position, by fraction-free back
+       substitution: the vector is rescaled whenever a leading entry does
+       not divide the sum to be cancelled */
+    for (j = k = 0; j < A->c; j++)
+    {
+        if (lead[j] != -1)
+            continue;
+
+        _fmpz_vec_zero(x, j + 1);
+        fmpz_one(x + j);
+
+        for (i = rank - 1; i >= 0; i--)
+        {
+            slong p = R->cols[R->row_start[i]];
+            const fmpz * l = R->entries + R->row_start[i];
+
+            if (p > j)
+                continue;
+
+            fmpz_zero(s);
+            for (u = R->row_start[i] + 1; u < R->row_start[i + 1]; u++)
+                if (R->cols[u] <= j)
+                    fmpz_addmul(s, R->entries + u, x + R->cols[u]);
+
+            fmpz_gcd(g, s, l);
+
+            if (!fmpz_equal(g, l))
+            {
+                fmpz_divexact(t, l, g);
+                _fmpz_vec_scalar_mul_fmpz(x + p + 1, x + p + 1, j - p, t);
+            }
+
+            fmpz_divexact(x + p, s, g);
+            fmpz_neg(x + p, x + p);
+        }
+
+        _fmpz_vec_content(g, x, j + 1);
+        _fmpz_vec_scalar_divexact_fmpz(x, x, j + 1, g);
+
+        for (i = 0; i <= j; i++)
+        {
+            if (fmpz_is_zero(x + i))
+                continue;
+
+            if (len == alloc)
+            {
+                entries = flint_realloc(entries, sizeof(fmpz) * 2 * alloc);
+                for (u = alloc; u < 2 * alloc; u++)
+                    fmpz_init(entries + u);
+                alloc = 2 * alloc;
+                rows = flint_realloc(rows, sizeof(slong) * alloc);
+                cols = flint_realloc(cols, sizeof(slong) * alloc);
+            }
+
+            rows[len] = k;
+            cols[len] = perm[i];
+            fmpz_swap(entries + len, x + i);
+            len++;
+        }
+
+        k++;
+    }
+
+    fmpz_sparse_mat_clear(X);
+    fmpz_sparse_mat_init(X, nullity, A->c);
+    fmpz_sparse_mat_set_entries(X, rows, cols, entries, len);
+
+    fmpz_sparse_mat_clear(R);
+    flint_free(perm);
+    flint_free(lead);
+    _fmpz_vec_clear(x, A->c);
+    fmpz_clear(s);
+    fmpz_clear(g);
+    fmpz_clear(t);
+    flint_free(rows);
+    flint_free(cols);
+    _fmpz_vec_clear(entries, alloc);
+
+    return nullity;
+}
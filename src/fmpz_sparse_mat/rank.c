@@ -0,0 +1,30 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_sparse_mat.h"
+
+slong
+fmpz_sparse_mat_rank(const fmpz_sparse_mat_t A)
+{
+    fmpz_sparse_mat_t R;
+    slong * perm, rank;
+
+    fmpz_sparse_mat_init(R, 0, A->c);
+    perm = flint_malloc(sizeof(slong) * FLINT_MAX(A->c, 1));
+
+    rank = _fmpz_sparse_mat_echelon(R, perm, A);
+
+    fmpz_sparse_mat_clear(R);
+    flint_free(perm);
+
+    return rank;
+}
@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_vec.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_set(fmpz_sparse_mat_t A, const fmpz_sparse_mat_t B)
+{
+    slong i, nnz;
+
+    if (A == B)
+        return;
+
+    nnz = fmpz_sparse_mat_nnz(B);
+
+    if (A->r != B->r)
+    {
+        A->row_start = flint_realloc(A->row_start, sizeof(slong) * (B->r + 1));
+        A->r = B->r;
+    }
+
+    A->c = B->c;
+
+    fmpz_sparse_mat_fit_nnz(A, nnz);
+
+    for (i = 0; i <= B->r; i++)
+        A->row_start[i] = B->row_start[i];
+
+    for (i = 0; i < nnz; i++)
+        A->cols[i] = B->cols[i];
+
+    _fmpz_vec_set(A->entries, B->entries, nnz);
+}
@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include "fmpz.h"
+#include "fmpz_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    slong idx;
+}
+_entry_t;
+
+static int
+_entry_cmp(const void * a, const void * b)
+{
+    slong x = ((const _entry_t *) a)->col;
+    slong y = ((const _entry_t *) b)->col;
+
+    return (x > y) - (x < y);
+}
+
+void
+fmpz_sparse_mat_set_entries(fmpz_sparse_mat_t A, const slong * rows,
+                      const slong * cols, const fmpz * entries, slong len)
+{
+    _entry_t * T;
+    slong * pos;
+    slong i, k, nnz;
+
+    T = flint_malloc(sizeof(_entry_t) * FLINT_MAX(len, 1));
+    pos = flint_calloc(A->r + 1, sizeof(slong));
+
+    /* bucket the entries by row */
+    for (i = 0; i < len; i++)
+    {
+        if (rows[i] < 0 || rows[i] >= A->r || cols[i] < 0 || cols[i] >= A->c)
+        {
+            flint_printf("Exception (fmpz_sparse_mat_set_entries). Index out of range.\n");
+            flint_abort();
+        }
+
+        pos[rows[i] + 1]++;
+    }
+
+    for (i = 0; i < A->r; i++)
+        pos[i + 1] += pos[i];
+
+    for (i = 0; i < len; i++)
+    {
+        k = pos[rows[i]]++;
+        T[k].col = cols[i];
+        T[k].idx = i;
+    }
+
+    /* pos[i] is now the end of row i; sort each row and merge duplicates */
+    fmpz_sparse_mat_fit_nnz(A, len);
+
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        slong start = (i == 0) ? 0 : pos[i - 1];
+
+        A->row_start[i] = nnz;
+
+        qsort(T + start, pos[i] - start, sizeof(_entry_t), _entry_cmp);
+
+        for (k = start; k < pos[i]; k++)
+        {
+            if (nnz > A->row_start[i] && A->cols[nnz - 1] == T[k].col)
+            {
+                fmpz_add(A->entries + nnz - 1, A->entries + nnz - 1, entries + T[k].idx);
+            }
+            else
+            {
+                /* drop a preceding entry which summed to zero */
+                if (nnz > A->row_start[i] && fmpz_is_zero(A->entries + nnz - 1))
+                    nnz--;
+
+                A->cols[nnz] = T[k].col;
+                fmpz_set(A->entries + nnz, entries + T[k].idx);
+                nnz++;
+            }
+        }
+
+        if (nnz > A->row_start[i] && fmpz_is_zero(A->entries + nnz - 1))
+            nnz--;
+    }
+
+    A->row_start[A->r] = nnz;
+
+    flint_free(T);
+    flint_free(pos);
+}
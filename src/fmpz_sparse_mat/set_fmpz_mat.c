@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_set_fmpz_mat(fmpz_sparse_mat_t A, const fmpz_mat_t B)
+{
+    slong i, j, k, nnz;
+
+    nnz = 0;
+    for (i = 0; i < B->r; i++)
+        for (j = 0; j < B->c; j++)
+            nnz += !fmpz_is_zero(fmpz_mat_entry(B, i, j));
+
+    if (A->r != B->r)
+    {
+        A->row_start = flint_realloc(A->row_start, sizeof(slong) * (B->r + 1));
+        A->r = B->r;
+    }
+
+    A->c = B->c;
+
+    fmpz_sparse_mat_fit_nnz(A, nnz);
+
+    k = 0;
+    for (i = 0; i < B->r; i++)
+    {
+        A->row_start[i] = k;
+
+        for (j = 0; j < B->c; j++)
+        {
+            if (!fmpz_is_zero(fmpz_mat_entry(B, i, j)))
+            {
+                A->cols[k] = j;
+                fmpz_set(A->entries + k, fmpz_mat_entry(B, i, j));
+                k++;
+            }
+        }
+    }
+
+    A->row_start[B->r] = k;
+}
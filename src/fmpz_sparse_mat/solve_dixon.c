@@ -0,0 +1,283 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpq_mat.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "fmpz_sparse_mat.h"
+
+#define DIXON_MAX_PRIMES 3
+
+/* number of projections tried for a step before giving up on a prime */
+#define DIXON_MAX_ATTEMPTS 8
+
+/*
+    Bounds |det(A)| <= D by Hadamard's inequality on the columns of A,
+    and the numerators of Cramer's rule by N = D * max ||b||, as in
+    fmpz_mat_solve_bound.
+*/
+static void
+_fmpz_sparse_mat_solve_bound(fmpz_t N, fmpz_t D,
+                            const fmpz_sparse_mat_t A, const fmpz_mat_t B)
+{
+    fmpz * norm;
+    fmpz_t t, u;
+    slong i, j, k;
+
+    norm = _fmpz_vec_init(A->c);
+    fmpz_init(t);
+    fmpz_init(u);
+
+    for (k = 0; k < fmpz_sparse_mat_nnz(A); k++)
+        fmpz_addmul(norm + A->cols[k], A->entries + k, A->entries + k);
+
+    fmpz_one(D);
+    for (j = 0; j < A->c; j++)
+    {
+        fmpz_sqrtrem(t, u, norm + j);
+        if (!fmpz_is_zero(u))
+            fmpz_add_ui(t, t, 1);
+        fmpz_mul(D, D, t);
+    }
+
+    fmpz_zero(t);
+    for (j = 0; j < B->c; j++)
+    {
+        fmpz_zero(u);
+        for (i = 0; i < B->r; i++)
+            fmpz_addmul(u, fmpz_mat_entry(B, i, j), fmpz_mat_entry(B, i, j));
+        if (fmpz_cmp(t, u) < 0)
+            fmpz_set(t, u);
+    }
+
+    fmpz_sqrtrem(t, u, t);
+    if (!fmpz_is_zero(u))
+        fmpz_add_ui(t, t, 1);
+
+    fmpz_mul(N, D, t);
+
+    _fmpz_vec_clear(norm, A->c);
+    fmpz_clear(t);
+    fmpz_clear(u);
+}
+
+/*
+    Sets y = A^(-1) d mod p using the annihilating polynomial f of A mod p,
+    which is extended by further Wiedemann projections until the result
+    is verified. Returns 0 if A is found to be singular mod p.
+*/
+static int
+_fmpz_sparse_mat_dixon_step(nmod_mat_t y, nmod_poly_t f,
+        const nmod_sparse_mat_t Amod, const nmod_mat_t d, flint_rand_t state)
+{
+    nmod_poly_t g, h;
+    nmod_mat_t t;
+    slong attempt;
+    int success = 0;
+
+    nmod_poly_init_mod(g, Amod->mod);
+    nmod_poly_init_mod(h, Amod->mod);
+    nmod_mat_init(t, d->r, d->c, Amod->mod.n);
+
+    for (attempt = 0; attempt < DIXON_MAX_ATTEMPTS; attempt++)
+    {
+        if (f->coeffs[0] != 0)
+        {
+            /* y = -f(0)^(-1) ((f - f(0)) / x)(A) d */
+            nmod_poly_shift_right(g, f, 1);
+            nmod_sparse_mat_poly_mul_nmod_mat(y, g, Amod, d);
+            nmod_mat_scalar_mul(y, y, nmod_neg(nmod_inv(f->coeffs[0],
+                                                Amod->mod), Amod->mod));
+
+            nmod_sparse_mat_mul_nmod_mat(t, Amod, y);
+
+            if (nmod_mat_equal(t, d))
+            {
+                success = 1;
+                break;
+            }
+        }
+
+        nmod_sparse_mat_minpoly_wiedemann(g, Amod, state);
+        nmod_poly_gcd(h, f, g);
+        nmod_poly_div(g, g, h);
+        nmod_poly_mul(f, f, g);
+
+        if (f->coeffs[0] == 0)
+            break;
+    }
+
+    nmod_poly_clear(g);
+    nmod_poly_clear(h);
+    nmod_mat_clear(t);
+
+    return success;
+}
+
+static int
+_fmpz_sparse_mat_solve_dixon(fmpz_mat_t X, fmpz_t den,
+                const fmpz_sparse_mat_t A, const fmpz_mat_t B, mp_limb_t p,
+                            const fmpz_t N, const fmpz_t D, flint_rand_t state)
+{
+    nmod_sparse_mat_t Amod;
+    nmod_poly_t f;
+    nmod_mat_struct * y;
+    nmod_mat_t d_mod;
+    fmpz_mat_t x, d, t, ylift;
+    fmpq_mat_t Q;
+    fmpz_t bound, ppow;
+    slong i, j, n, cols, num_steps, chunk;
+    int success = 1;
+
+    n = A->r;
+    cols = B->c;
+
+    nmod_sparse_mat_init(Amod, n, n, p);
+    fmpz_sparse_mat_get_nmod_sparse_mat(Amod, A);
+
+    nmod_poly_init(f, p);
+    nmod_sparse_mat_minpoly_wiedemann(f, Amod, state);
+
+    /* a zero root of a factor of the minimal polynomial */
+    if (f->coeffs[0] == 0)
+    {
+        nmod_sparse_mat_clear(Amod);
+        nmod_poly_clear(f);
+        return 0;
+    }
+
+    fmpz_init(bound);
+    fmpz_init(ppow);
+
+    if (fmpz_cmpabs(N, D) < 0)
+        fmpz_mul(bound, D, D);
+    else
+        fmpz_mul(bound, N, N);
+    fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
+
+    fmpz_mat_init(x, n, cols);
+    fmpz_mat_init_set(d, B);
+    fmpz_mat_init(t, n, cols);
+    fmpz_mat_init(ylift, n, cols);
+    nmod_mat_init(d_mod, n, cols, p);
+    fmpz_mat_get_nmod_mat(d_mod, d);
+
+    /* the p-adic digits are added to x in chunks of about sqrt(num_steps) */
+    num_steps = _fmpz_mat_dixon_num_steps(bound, p);
+    chunk = n_sqrt(num_steps);
+
+    y = flint_malloc(sizeof(nmod_mat_struct) * chunk);
+    for (j = 0; j < chunk; j++)
+        nmod_mat_init(y + j, n, cols, p);
+
+    fmpz_one(ppow);
+
+    for (i = 0, j = 0; i < num_steps; i++)
+    {
+        /* y = A^(-1) * d  (mod p) */
+        if (!_fmpz_sparse_mat_dixon_step(y + j, f, Amod, d_mod, state))
+        {
+            success = 0;
+            break;
+        }
+
+        /* d = (d - Ay) / p */
+        if (i < num_steps - 1)
+        {
+            fmpz_mat_set_nmod_mat_unsigned(ylift, y + j);
+            fmpz_sparse_mat_mul_fmpz_mat(t, A, ylift);
+            fmpz_mat_sub(d, d, t);
+            fmpz_mat_scalar_divexact_ui(d, d, p);
+            fmpz_mat_get_nmod_mat(d_mod, d);
+        }
+
+        /* x = x + y * p^i    [= A^(-1) * b mod p^(i+1)] */
+        if (++j == chunk || i == num_steps - 1)
+        {
+            _fmpz_mat_dixon_add_digits(x, y, j, ppow);
+            for ( ; j > 0; j--)
+                fmpz_mul_ui(ppow, ppow, p);
+        }
+    }
+
+    if (success)
+    {
+        fmpq_mat_init(Q, n, cols);
+        success = fmpq_mat_set_fmpz_mat_mod_fmpz(Q, x, ppow);
+
+        if (success)
+            fmpq_mat_get_fmpz_mat_matwise(X, den, Q);
+
+        fmpq_mat_clear(Q);
+    }
+
+    for (j = 0; j < chunk; j++)
+        nmod_mat_clear(y + j);
+    flint_free(y);
+
+    nmod_sparse_mat_clear(Amod);
+    nmod_poly_clear(f);
+    nmod_mat_clear(d_mod);
+    fmpz_mat_clear(x);
+    fmpz_mat_clear(d);
+    fmpz_mat_clear(t);
+    fmpz_mat_clear(ylift);
+    fmpz_clear(bound);
+    fmpz_clear(ppow);
+
+    return success;
+}
+
+int
+fmpz_sparse_mat_solve_dixon(fmpz_mat_t X, fmpz_t den,
+        const fmpz_sparse_mat_t A, const fmpz_mat_t B, flint_rand_t state)
+{
+    fmpz_t N, D;
+    mp_limb_t p;
+    slong i;
+    int success = 0;
+
+    if (A->r != A->c || B->r != A->r || X->r != A->c || X->c != B->c)
+    {
+        flint_printf("Exception (fmpz_sparse_mat_solve_dixon). "
+                     "Incompatible matrix dimensions.\n");
+        flint_abort();
+    }
+
+    if (A->r == 0 || B->c == 0)
+    {
+        fmpz_one(den);
+        return 1;
+    }
+
+    fmpz_init(N);
+    fmpz_init(D);
+    _fmpz_sparse_mat_solve_bound(N, D, A, B);
+
+    /* a random prime divides the determinant of a nonsingular matrix with
+       negligible probability */
+    for (i = 0; i < DIXON_MAX_PRIMES && !success; i++)
+    {
+        p = n_randprime(state, FLINT_BITS - 2, 0);
+        success = _fmpz_sparse_mat_solve_dixon(X, den, A, B, p, N, D, state);
+    }
+
+    fmpz_clear(N);
+    fmpz_clear(D);
+
+    return success;
+}
@@ -0,0 +1,21 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_swap(fmpz_sparse_mat_t A, fmpz_sparse_mat_t B)
+{
+    fmpz_sparse_mat_struct t = *A;
+    *A = *B;
+    *B = t;
+}
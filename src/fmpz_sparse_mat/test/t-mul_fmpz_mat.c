@@ -0,0 +1,142 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_fmpz_mat....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        fmpz_sparse_mat_t A, At;
+        fmpz_mat_t D, Dt, E, B, C, F;
+        fmpz * x, * y;
+        slong m, c, k, i;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 300);
+            c = n_randint(state, 300);
+        }
+        else
+        {
+            m = n_randint(state, 30);
+            c = n_randint(state, 30);
+        }
+
+        k = n_randint(state, 10);
+
+        fmpz_sparse_mat_init(A, m, c);
+        fmpz_sparse_mat_init(At, 0, 0);
+        fmpz_mat_init(D, m, c);
+        fmpz_mat_init(Dt, c, m);
+        fmpz_mat_init(E, c, m);
+        fmpz_mat_init(B, c, k);
+        fmpz_mat_init(C, m, k);
+        fmpz_mat_init(F, m, k);
+        x = _fmpz_vec_init(c);
+        y = _fmpz_vec_init(m);
+
+        fmpz_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 10), 1 + n_randint(state, 200));
+        fmpz_sparse_mat_get_fmpz_mat(D, A);
+
+        /* transpose */
+        fmpz_sparse_mat_transpose(At, A);
+        fmpz_sparse_mat_get_fmpz_mat(E, At);
+        fmpz_mat_transpose(Dt, D);
+
+        if (!fmpz_mat_equal(E, Dt))
+        {
+            flint_printf("FAIL: transpose\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* block product */
+        fmpz_mat_randtest(B, state, 1 + n_randint(state, 200));
+        fmpz_mat_randtest(C, state, 10);
+
+        fmpz_sparse_mat_mul_fmpz_mat(C, A, B);
+        fmpz_mat_mul(F, D, B);
+
+        if (!fmpz_mat_equal(C, F))
+        {
+            flint_printf("FAIL: mul_fmpz_mat\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (m == c)
+        {
+            fmpz_sparse_mat_mul_fmpz_mat(B, A, B);
+
+            if (!fmpz_mat_equal(B, F))
+            {
+                flint_printf("FAIL: aliasing\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        /* vector product */
+        _fmpz_vec_randtest(x, state, c, 1 + n_randint(state, 200));
+        fmpz_sparse_mat_mul_vec(y, A, x);
+
+        if (k > 0)
+        {
+            for (i = 0; i < c; i++)
+                fmpz_set(fmpz_mat_entry(B, i, 0), x + i);
+
+            fmpz_mat_mul(F, D, B);
+
+            for (i = 0; i < m; i++)
+            {
+                if (!fmpz_equal(y + i, fmpz_mat_entry(F, i, 0)))
+                {
+                    flint_printf("FAIL: mul_vec\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        fmpz_sparse_mat_clear(A);
+        fmpz_sparse_mat_clear(At);
+        fmpz_mat_clear(D);
+        fmpz_mat_clear(Dt);
+        fmpz_mat_clear(E);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(F);
+        _fmpz_vec_clear(x, c);
+        _fmpz_vec_clear(y, m);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
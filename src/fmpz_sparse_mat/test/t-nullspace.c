@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        fmpz_sparse_mat_t A, K;
+        fmpz_mat_t D, Kd, Kt, P;
+        slong m, n, i, rank, nullity;
+
+        m = n_randint(state, 25);
+        n = n_randint(state, 25);
+
+        fmpz_sparse_mat_init(A, m, n);
+        fmpz_sparse_mat_init(K, 0, 0);
+        fmpz_mat_init(D, m, n);
+
+        fmpz_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 5), 1 + n_randint(state, 20));
+
+        /* repeated rows lower the rank */
+        if (m > 1 && n_randint(state, 2))
+        {
+            fmpz_sparse_mat_get_fmpz_mat(D, A);
+            for (i = 1; i < m; i += 2)
+            {
+                fmpz_mat_t r;
+                fmpz_mat_window_init(r, D, i, 0, i + 1, n);
+                fmpz_mat_scalar_mul_si(r, r, 0);
+                _fmpz_vec_add(D->rows[i], D->rows[i], D->rows[i - 1], n);
+                fmpz_mat_window_clear(r);
+            }
+            fmpz_sparse_mat_set_fmpz_mat(A, D);
+        }
+
+        fmpz_sparse_mat_get_fmpz_mat(D, A);
+
+        rank = fmpz_sparse_mat_rank(A);
+
+        if (rank != fmpz_mat_rank(D))
+        {
+            flint_printf("FAIL: rank\n");
+            fmpz_mat_print_pretty(D);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nullity = fmpz_sparse_mat_nullspace(K, A);
+
+        if (nullity + rank != n || K->r != nullity || K->c != n)
+        {
+            flint_printf("FAIL: nullity\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_init(Kd, nullity, n);
+        fmpz_mat_init(Kt, n, nullity);
+        fmpz_mat_init(P, m, nullity);
+
+        fmpz_sparse_mat_get_fmpz_mat(Kd, K);
+        fmpz_mat_transpose(Kt, Kd);
+        fmpz_sparse_mat_mul_fmpz_mat(P, A, Kt);
+
+        if (!fmpz_mat_is_zero(P) || fmpz_mat_rank(Kd) != nullity)
+        {
+            flint_printf("FAIL: basis\n");
+            fmpz_mat_print_pretty(D);
+            fmpz_mat_print_pretty(Kd);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_sparse_mat_clear(A);
+        fmpz_sparse_mat_clear(K);
+        fmpz_mat_clear(D);
+        fmpz_mat_clear(Kd);
+        fmpz_mat_clear(Kt);
+        fmpz_mat_clear(P);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
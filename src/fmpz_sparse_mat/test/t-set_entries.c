@@ -0,0 +1,156 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "nmod_mat.h"
+#include "fmpz_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_entries....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_sparse_mat_t A, B;
+        nmod_sparse_mat_t Amod, Bmod;
+        fmpz_mat_t D, E;
+        nmod_mat_t Dmod;
+        slong * rows, * cols;
+        fmpz * vals;
+        fmpz_t x;
+        slong m, c, i, j, len;
+
+        m = n_randint(state, 20);
+        c = n_randint(state, 20);
+        len = (m == 0 || c == 0) ? 0 : n_randint(state, 3 * m * c + 1);
+
+        fmpz_sparse_mat_init(A, m, c);
+        fmpz_sparse_mat_init(B, m, c);
+        fmpz_mat_init(D, m, c);
+        fmpz_mat_init(E, m, c);
+        fmpz_init(x);
+
+        rows = flint_malloc(sizeof(slong) * (len + 1));
+        cols = flint_malloc(sizeof(slong) * (len + 1));
+        vals = _fmpz_vec_init(len + 1);
+
+        /* unordered entries with repetitions and cancellations */
+        for (i = 0; i < len; i++)
+        {
+            rows[i] = n_randint(state, m);
+            cols[i] = n_randint(state, c);
+
+            if (i > 0 && n_randint(state, 4) == 0)
+            {
+                rows[i] = rows[i - 1];
+                cols[i] = cols[i - 1];
+                fmpz_neg(vals + i, vals + i - 1);
+            }
+            else
+            {
+                fmpz_randtest(vals + i, state, 100);
+            }
+
+            fmpz_add(fmpz_mat_entry(D, rows[i], cols[i]),
+                     fmpz_mat_entry(D, rows[i], cols[i]), vals + i);
+        }
+
+        fmpz_sparse_mat_set_entries(A, rows, cols, vals, len);
+        fmpz_sparse_mat_get_fmpz_mat(E, A);
+
+        if (!fmpz_mat_equal(D, E))
+        {
+            flint_printf("FAIL: entries\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = A->row_start[i]; j < A->row_start[i + 1]; j++)
+            {
+                if (fmpz_is_zero(A->entries + j) ||
+                        (j > A->row_start[i] && A->cols[j] <= A->cols[j - 1]))
+                {
+                    flint_printf("FAIL: normalisation\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+
+                fmpz_sparse_mat_get_entry(x, A, i, A->cols[j]);
+
+                if (!fmpz_equal(x, A->entries + j))
+                {
+                    flint_printf("FAIL: get_entry\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        fmpz_sparse_mat_set_fmpz_mat(B, D);
+
+        if (!fmpz_sparse_mat_equal(A, B))
+        {
+            flint_printf("FAIL: set_fmpz_mat\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* reduction */
+        {
+            mp_limb_t n = n_randtest_not_zero(state);
+
+            nmod_sparse_mat_init(Amod, 0, 0, n);
+            nmod_sparse_mat_init(Bmod, m, c, n);
+            nmod_mat_init(Dmod, m, c, n);
+
+            fmpz_sparse_mat_get_nmod_sparse_mat(Amod, A);
+            fmpz_mat_get_nmod_mat(Dmod, D);
+            nmod_sparse_mat_set_nmod_mat(Bmod, Dmod);
+
+            if (!nmod_sparse_mat_equal(Amod, Bmod))
+            {
+                flint_printf("FAIL: get_nmod_sparse_mat\n");
+                fflush(stdout);
+                flint_abort();
+            }
+
+            nmod_sparse_mat_clear(Amod);
+            nmod_sparse_mat_clear(Bmod);
+            nmod_mat_clear(Dmod);
+        }
+
+        fmpz_sparse_mat_clear(A);
+        fmpz_sparse_mat_clear(B);
+        fmpz_mat_clear(D);
+        fmpz_mat_clear(E);
+        fmpz_clear(x);
+        flint_free(rows);
+        flint_free(cols);
+        _fmpz_vec_clear(vals, len + 1);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_dixon....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        fmpz_sparse_mat_t A;
+        fmpz_mat_t D, B, X, AX, Bden;
+        fmpz_t den;
+        slong n, k;
+        int success;
+
+        n = n_randint(state, 30);
+        k = 1 + n_randint(state, 5);
+
+        fmpz_sparse_mat_init(A, n, n);
+        fmpz_mat_init(D, n, n);
+        fmpz_mat_init(B, n, k);
+        fmpz_mat_init(X, n, k);
+        fmpz_mat_init(AX, n, k);
+        fmpz_mat_init(Bden, n, k);
+        fmpz_init(den);
+
+        fmpz_sparse_mat_randtest(A, state, 1, 1 + n_randint(state, 5), 1 + n_randint(state, 50));
+        fmpz_sparse_mat_get_fmpz_mat(D, A);
+        fmpz_mat_randtest(B, state, 1 + n_randint(state, 50));
+
+        success = fmpz_sparse_mat_solve_dixon(X, den, A, B, state);
+
+        if (success != (fmpz_mat_rank(D) == n))
+        {
+            flint_printf("FAIL: singularity\n");
+            fmpz_mat_print_pretty(D);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (success)
+        {
+            fmpz_sparse_mat_mul_fmpz_mat(AX, A, X);
+            fmpz_mat_scalar_mul_fmpz(Bden, B, den);
+
+            if (!fmpz_mat_equal(AX, Bden) || fmpz_is_zero(den))
+            {
+                flint_printf("FAIL: A X != den B\n");
+                fmpz_mat_print_pretty(D);
+                fmpz_mat_print_pretty(X);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fmpz_sparse_mat_clear(A);
+        fmpz_mat_clear(D);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(X);
+        fmpz_mat_clear(AX);
+        fmpz_mat_clear(Bden);
+        fmpz_clear(den);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
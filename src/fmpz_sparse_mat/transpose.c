@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_transpose(fmpz_sparse_mat_t B, const fmpz_sparse_mat_t A)
+{
+    slong i, k, nnz;
+    slong * pos;
+
+    if (A == B)
+    {
+        fmpz_sparse_mat_t T;
+        fmpz_sparse_mat_init(T, A->c, A->r);
+        fmpz_sparse_mat_transpose(T, A);
+        fmpz_sparse_mat_swap(B, T);
+        fmpz_sparse_mat_clear(T);
+        return;
+    }
+
+    nnz = fmpz_sparse_mat_nnz(A);
+
+    if (B->r != A->c)
+    {
+        B->row_start = flint_realloc(B->row_start, sizeof(slong) * (A->c + 1));
+        B->r = A->c;
+    }
+
+    B->c = A->r;
+
+    fmpz_sparse_mat_fit_nnz(B, nnz);
+
+    /* counting sort by column; scanning the rows of A in order keeps the
+       columns of each row of B sorted */
+    pos = flint_calloc(A->c + 1, sizeof(slong));
+
+    for (k = 0; k < nnz; k++)
+        pos[A->cols[k] + 1]++;
+
+    for (i = 0; i < A->c; i++)
+        pos[i + 1] += pos[i];
+
+    for (i = 0; i <= A->c; i++)
+        B->row_start[i] = pos[i];
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+        {
+            slong t = pos[A->cols[k]]++;
+            B->cols[t] = i;
+            fmpz_set(B->entries + t, A->entries + k);
+        }
+    }
+
+    flint_free(pos);
+}
@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_zero(fmpz_sparse_mat_t A)
+{
+    slong i;
+
+    for (i = 0; i <= A->r; i++)
+        A->row_start[i] = 0;
+}
@@ -0,0 +1,145 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GF2_MAT_H
+#define GF2_MAT_H
+
+#ifdef GF2_MAT_INLINES_C
+#define GF2_MAT_INLINE
+#else
+#define GF2_MAT_INLINE static __inline__
+#endif
+
+#include "nmod_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Dense matrices over GF(2), packed FLINT_BITS entries per limb: entry
+    (i, j) is bit j % FLINT_BITS of rows[i][j / FLINT_BITS]. Each row takes
+    stride limbs, and the unused bits at the end of each row are always zero.
+*/
+typedef struct
+{
+    mp_ptr entries;
+    slong r;
+    slong c;
+    slong stride;
+    mp_ptr * rows;
+}
+gf2_mat_struct;
+
+typedef gf2_mat_struct gf2_mat_t[1];
+
+#define GF2_MAT_WORDS(c) (((c) + FLINT_BITS - 1) / FLINT_BITS)
+
+/* mask of the valid bits in the last limb of a row of c entries */
+#define GF2_MAT_LAST_MASK(c) \
+    (((c) % FLINT_BITS == 0) ? ~UWORD(0) : (UWORD(1) << ((c) % FLINT_BITS)) - 1)
+
+GF2_MAT_INLINE
+slong gf2_mat_nrows(const gf2_mat_t A)
+{
+    return A->r;
+}
+
+GF2_MAT_INLINE
+slong gf2_mat_ncols(const gf2_mat_t A)
+{
+    return A->c;
+}
+
+GF2_MAT_INLINE
+int gf2_mat_get_entry(const gf2_mat_t A, slong i, slong j)
+{
+    return (A->rows[i][j / FLINT_BITS] >> (j % FLINT_BITS)) & 1;
+}
+
+GF2_MAT_INLINE
+void gf2_mat_set_entry(gf2_mat_t A, slong i, slong j, int x)
+{
+    mp_limb_t bit = UWORD(1) << (j % FLINT_BITS);
+
+    if (x & 1)
+        A->rows[i][j / FLINT_BITS] |= bit;
+    else
+        A->rows[i][j / FLINT_BITS] &= ~bit;
+}
+
+GF2_MAT_INLINE
+void gf2_mat_flip_entry(gf2_mat_t A, slong i, slong j)
+{
+    A->rows[i][j / FLINT_BITS] ^= UWORD(1) << (j % FLINT_BITS);
+}
+
+/* Memory management */
+
+void gf2_mat_init(gf2_mat_t A, slong rows, slong cols);
+
+void gf2_mat_clear(gf2_mat_t A);
+
+void gf2_mat_swap(gf2_mat_t A, gf2_mat_t B);
+
+void gf2_mat_set(gf2_mat_t A, const gf2_mat_t B);
+
+void gf2_mat_zero(gf2_mat_t A);
+
+void gf2_mat_one(gf2_mat_t A);
+
+/* Conversions */
+
+void gf2_mat_set_nmod_mat(gf2_mat_t A, const nmod_mat_t B);
+
+void gf2_mat_get_nmod_mat(nmod_mat_t A, const gf2_mat_t B);
+
+/* Basic properties and operations */
+
+int gf2_mat_equal(const gf2_mat_t A, const gf2_mat_t B);
+
+int gf2_mat_is_zero(const gf2_mat_t A);
+
+void gf2_mat_randtest(gf2_mat_t A, flint_rand_t state);
+
+void gf2_mat_print_pretty(const gf2_mat_t A);
+
+void gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A);
+
+void gf2_mat_add(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+/* Multiplication */
+
+void gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+void gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+void gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+/* Gaussian elimination */
+
+slong gf2_mat_lu(slong * P, gf2_mat_t A, int rank_check);
+
+slong _gf2_mat_rref(gf2_mat_t A, int reduced);
+
+slong gf2_mat_rref(gf2_mat_t A);
+
+slong gf2_mat_rank(const gf2_mat_t A);
+
+slong gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A);
+
+int gf2_mat_inv(gf2_mat_t B, const gf2_mat_t A);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,19 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_clear(gf2_mat_t A)
+{
+    flint_free(A->entries);
+    flint_free(A->rows);
+}
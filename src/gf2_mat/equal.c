@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+int
+gf2_mat_equal(const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i;
+
+    if (A->r != B->r || A->c != B->c)
+        return 0;
+
+    for (i = 0; i < A->r; i++)
+        if (mpn_cmp(A->rows[i], B->rows[i], A->stride) != 0)
+            return 0;
+
+    return 1;
+}
@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_init(gf2_mat_t A, slong rows, slong cols)
+{
+    slong i;
+
+    A->r = rows;
+    A->c = cols;
+    A->stride = GF2_MAT_WORDS(cols);
+
+    if (rows != 0 && A->stride != 0)
+        A->entries = flint_calloc(rows * A->stride, sizeof(mp_limb_t));
+    else
+        A->entries = NULL;
+
+    if (rows != 0)
+        A->rows = flint_malloc(rows * sizeof(mp_ptr));
+    else
+        A->rows = NULL;
+
+    for (i = 0; i < rows; i++)
+        A->rows[i] = A->entries + i * A->stride;
+}
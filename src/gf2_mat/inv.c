@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+int
+gf2_mat_inv(gf2_mat_t B, const gf2_mat_t A)
+{
+    gf2_mat_t T;
+    slong i, n, s;
+    int result;
+
+    n = A->r;
+    s = A->stride;
+
+    if (n != A->c)
+    {
+        flint_printf("Exception (gf2_mat_inv). Non-square matrix.\n");
+        flint_abort();
+    }
+
+    /* [A | I], with the identity starting at a limb boundary */
+    gf2_mat_init(T, n, s * FLINT_BITS + n);
+
+    for (i = 0; i < n; i++)
+    {
+        flint_mpn_copyi(T->rows[i], A->rows[i], s);
+        gf2_mat_set_entry(T, i, s * FLINT_BITS + i, 1);
+    }
+
+    result = (_gf2_mat_rref(T, 1) == n) &&
+             (n == 0 || gf2_mat_get_entry(T, n - 1, n - 1));
+
+    if (result)
+    {
+        for (i = 0; i < n; i++)
+            flint_mpn_copyi(B->rows[i], T->rows[i] + s, s);
+    }
+
+    gf2_mat_clear(T);
+
+    return result;
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "mpn_extras.h"
+#include "gf2_mat.h"
+
+int
+gf2_mat_is_zero(const gf2_mat_t A)
+{
+    slong i;
+
+    for (i = 0; i < A->r; i++)
+        if (!flint_mpn_zero_p(A->rows[i], A->stride))
+            return 0;
+
+    return 1;
+}
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+/*
+    Same output format as nmod_mat_lu: on return P A = L U with the unit
+    lower triangular L stored below the diagonal of the first rank columns
+    and U in the remaining positions. Each elimination step only touches
+    the limbs from the pivot column onwards.
+*/
+slong
+gf2_mat_lu(slong * P, gf2_mat_t A, int rank_check)
+{
+    slong i, j, k, m, n, w, rank, row, col;
+    mp_limb_t mask;
+    mp_ptr t, p;
+
+    m = A->r;
+    n = A->c;
+
+    rank = row = col = 0;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    while (row < m && col < n)
+    {
+        for (j = row; j < m && !gf2_mat_get_entry(A, j, col); j++) ;
+
+        if (j == m)
+        {
+            if (rank_check)
+                return 0;
+            col++;
+            continue;
+        }
+
+        if (j != row)
+        {
+            t = A->rows[j];
+            A->rows[j] = A->rows[row];
+            A->rows[row] = t;
+
+            k = P[j];
+            P[j] = P[row];
+            P[row] = k;
+        }
+
+        rank++;
+
+        p = A->rows[row];
+        w = col / FLINT_BITS;
+
+        /* only the bits after the pivot take part in the update */
+        mask = (col % FLINT_BITS == FLINT_BITS - 1) ? 0 :
+               ~((UWORD(2) << (col % FLINT_BITS)) - 1);
+
+        for (i = row + 1; i < m; i++)
+        {
+            t = A->rows[i];
+
+            if (gf2_mat_get_entry(A, i, col))
+            {
+                t[w] ^= p[w] & mask;
+                for (k = w + 1; k < A->stride; k++)
+                    t[k] ^= p[k];
+
+                if (rank - 1 != col)
+                {
+                    gf2_mat_set_entry(A, i, col, 0);
+                    gf2_mat_set_entry(A, i, rank - 1, 1);
+                }
+            }
+        }
+
+        row++;
+        col++;
+    }
+
+    return rank;
+}
@@ -0,0 +1,21 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    if (A->r < 100 || A->c < 64)
+        gf2_mat_mul_classical(C, A, B);
+    else
+        gf2_mat_mul_m4rm(C, A, B);
+}
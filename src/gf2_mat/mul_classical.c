@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, j, l, w;
+    mp_limb_t a;
+    mp_ptr c;
+    mp_srcptr b;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->r, B->c);
+        gf2_mat_mul_classical(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    gf2_mat_zero(C);
+
+    for (i = 0; i < A->r; i++)
+    {
+        c = C->rows[i];
+
+        for (l = 0; l < A->stride; l++)
+        {
+            for (a = A->rows[i][l]; a != 0; a &= a - 1)
+            {
+                j = l * FLINT_BITS + flint_ctz(a);
+                b = B->rows[j];
+
+                for (w = 0; w < B->stride; w++)
+                    c[w] ^= b[w];
+            }
+        }
+    }
+}
@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "gf2_mat.h"
+
+/* width in limbs of the column chunks of C, chosen so that the eight
+   tables of a chunk fit comfortably in the L2 cache */
+#define GF2_MAT_M4RM_CHUNK 16
+
+/* minimum number of rows of A per task, amortising the table setup */
+#define GF2_MAT_M4RM_ROWS 256
+
+typedef struct
+{
+    gf2_mat_struct * C;
+    const gf2_mat_struct * A;
+    const gf2_mat_struct * B;
+    slong row_blocks;
+    slong col_chunks;
+}
+mul_m4rm_arg_t;
+
+/*
+    Method of the Four Russians on the rows [r0, r1) and the limbs [w0, w1)
+    of C. For each limb of A, the 8 x 256 linear combinations of the 64
+    corresponding rows of B, in groups of 8, are tabulated, each entry at
+    the cost of a single row addition. Each row of C then receives eight
+    table lookups per limb of A instead of up to 64 row additions.
+*/
+static void
+_gf2_mat_mul_m4rm_block(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B,
+                        slong r0, slong r1, slong w0, slong w1)
+{
+    slong i, g, l, w, x, W, j, nb;
+    mp_ptr T, Tg, c;
+    mp_srcptr b, t0, t1, t2, t3, t4, t5, t6, t7;
+    mp_limb_t a;
+
+    W = w1 - w0;
+    T = flint_calloc(8 * 256 * W, sizeof(mp_limb_t));
+
+    for (l = 0; l < A->stride; l++)
+    {
+        for (g = 0; g < FLINT_BITS / 8; g++)
+        {
+            Tg = T + g * 256 * W;
+            j = l * FLINT_BITS + 8 * g;
+            nb = FLINT_MAX(0, FLINT_MIN(8, B->r - j));
+
+            for (x = 1; x < (WORD(1) << nb); x++)
+            {
+                b = B->rows[j + flint_ctz(x)] + w0;
+                t0 = Tg + (x & (x - 1)) * W;
+
+                for (w = 0; w < W; w++)
+                    Tg[x * W + w] = t0[w] ^ b[w];
+            }
+        }
+
+#if FLINT64
+        for (i = r0; i < r1; i++)
+        {
+            a = A->rows[i][l];
+
+            if (a == 0)
+                continue;
+
+            c = C->rows[i] + w0;
+
+            t0 = T + 0 * 256 * W + ((a >>  0) & 255) * W;
+            t1 = T + 1 * 256 * W + ((a >>  8) & 255) * W;
+            t2 = T + 2 * 256 * W + ((a >> 16) & 255) * W;
+            t3 = T + 3 * 256 * W + ((a >> 24) & 255) * W;
+            t4 = T + 4 * 256 * W + ((a >> 32) & 255) * W;
+            t5 = T + 5 * 256 * W + ((a >> 40) & 255) * W;
+            t6 = T + 6 * 256 * W + ((a >> 48) & 255) * W;
+            t7 = T + 7 * 256 * W + ((a >> 56) & 255) * W;
+
+            for (w = 0; w < W; w++)
+                c[w] ^= t0[w] ^ t1[w] ^ t2[w] ^ t3[w]
+                      ^ t4[w] ^ t5[w] ^ t6[w] ^ t7[w];
+        }
+#else
+        for (i = r0; i < r1; i++)
+        {
+            a = A->rows[i][l];
+
+            if (a == 0)
+                continue;
+
+            c = C->rows[i] + w0;
+
+            t0 = T + 0 * 256 * W + ((a >>  0) & 255) * W;
+            t1 = T + 1 * 256 * W + ((a >>  8) & 255) * W;
+            t2 = T + 2 * 256 * W + ((a >> 16) & 255) * W;
+            t3 = T + 3 * 256 * W + ((a >> 24) & 255) * W;
+
+            for (w = 0; w < W; w++)
+                c[w] ^= t0[w] ^ t1[w] ^ t2[w] ^ t3[w];
+        }
+#endif
+    }
+
+    flint_free(T);
+}
+
+static void
+_gf2_mat_mul_m4rm_worker(slong k, mul_m4rm_arg_t * arg)
+{
+    slong rb, cc, r0, r1, w0, w1, r, s;
+
+    rb = k / arg->col_chunks;
+    cc = k % arg->col_chunks;
+
+    r = arg->A->r;
+    r0 = (rb * r) / arg->row_blocks;
+    r1 = ((rb + 1) * r) / arg->row_blocks;
+
+    s = arg->C->stride;
+    w0 = cc * GF2_MAT_M4RM_CHUNK;
+    w1 = FLINT_MIN(s, w0 + GF2_MAT_M4RM_CHUNK);
+
+    _gf2_mat_mul_m4rm_block(arg->C, arg->A, arg->B, r0, r1, w0, w1);
+}
+
+void
+gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    mul_m4rm_arg_t arg;
+    slong nthreads;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->r, B->c);
+        gf2_mat_mul_m4rm(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    gf2_mat_zero(C);
+
+    if (A->r == 0 || C->stride == 0 || A->stride == 0)
+        return;
+
+    arg.C = C;
+    arg.A = A;
+    arg.B = B;
+    arg.col_chunks = (C->stride + GF2_MAT_M4RM_CHUNK - 1) / GF2_MAT_M4RM_CHUNK;
+
+    /* split the rows only as far as needed to occupy the threads */
+    nthreads = flint_get_num_threads();
+    arg.row_blocks = (nthreads + arg.col_chunks - 1) / arg.col_chunks;
+    arg.row_blocks = FLINT_MIN(arg.row_blocks, A->r / GF2_MAT_M4RM_ROWS);
+    arg.row_blocks = FLINT_MAX(arg.row_blocks, 1);
+
+    if (arg.row_blocks * arg.col_chunks == 1)
+        _gf2_mat_mul_m4rm_block(C, A, B, 0, A->r, 0, C->stride);
+    else
+        flint_parallel_do((do_func_t) _gf2_mat_mul_m4rm_worker, &arg,
+                          arg.row_blocks * arg.col_chunks, -1, FLINT_PARALLEL_STRIDED);
+}
@@ -0,0 +1,56 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+slong
+gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A)
+{
+    slong i, j, k, n, rank, nullity;
+    slong * pivots;
+    slong * nonpivots;
+    gf2_mat_t T;
+
+    n = A->c;
+
+    gf2_mat_init(T, A->r, A->c);
+    gf2_mat_set(T, A);
+    rank = gf2_mat_rref(T);
+    nullity = n - rank;
+
+    pivots = flint_malloc(sizeof(slong) * FLINT_MAX(n, 1));
+    nonpivots = pivots + rank;
+
+    for (i = j = k = 0; i < rank; i++)
+    {
+        while (!gf2_mat_get_entry(T, i, j))
+            nonpivots[k++] = j++;
+        pivots[i] = j++;
+    }
+    while (k < nullity)
+        nonpivots[k++] = j++;
+
+    gf2_mat_zero(X);
+
+    for (i = 0; i < nullity; i++)
+    {
+        for (j = 0; j < rank; j++)
+            if (gf2_mat_get_entry(T, j, nonpivots[i]))
+                gf2_mat_set_entry(X, pivots[j], i, 1);
+
+        gf2_mat_set_entry(X, nonpivots[i], i, 1);
+    }
+
+    flint_free(pivots);
+    gf2_mat_clear(T);
+
+    return nullity;
+}
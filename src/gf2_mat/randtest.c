@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_randtest(gf2_mat_t A, flint_rand_t state)
+{
+    slong i, j;
+
+    if (A->stride == 0)
+        return;
+
+    switch (n_randint(state, 4))
+    {
+        case 0:
+            /* sparse */
+            gf2_mat_zero(A);
+            for (i = 0; i < A->r; i++)
+                for (j = 0; j < A->c; j++)
+                    if (n_randint(state, 16) == 0)
+                        gf2_mat_flip_entry(A, i, j);
+            break;
+
+        case 1:
+            /* dense */
+            for (i = 0; i < A->r; i++)
+                for (j = 0; j < A->stride; j++)
+                    A->rows[i][j] = n_randlimb(state) | n_randlimb(state);
+            break;
+
+        default:
+            for (i = 0; i < A->r; i++)
+                for (j = 0; j < A->stride; j++)
+                    A->rows[i][j] = n_randlimb(state);
+    }
+
+    for (i = 0; i < A->r; i++)
+        A->rows[i][A->stride - 1] &= GF2_MAT_LAST_MASK(A->c);
+}
@@ -0,0 +1,187 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "gf2_mat.h"
+
+/* number of pivots eliminated together through a table of 2^k rows */
+#define GF2_MAT_M4RI_K 8
+
+/* minimum number of limbs updated per elimination step to use threads */
+#define GF2_MAT_M4RI_THREAD_CUTOFF 16384
+
+typedef struct
+{
+    gf2_mat_struct * A;
+    mp_srcptr T;
+    const slong * pivcols;
+    slong r;
+    slong k;
+    slong w0;
+    slong start;
+    slong stop;
+    slong num;
+}
+rref_arg_t;
+
+static __inline__ void
+_gf2_mat_row_xor(mp_ptr a, mp_srcptr b, slong n)
+{
+    slong i;
+
+    for (i = 0; i < n; i++)
+        a[i] ^= b[i];
+}
+
+static void
+_gf2_mat_rref_rows(gf2_mat_t A, mp_srcptr T, const slong * pivcols,
+                   slong r, slong k, slong w0, slong start, slong stop)
+{
+    slong i, p, W;
+    mp_limb_t x;
+
+    W = A->stride - w0;
+
+    for (i = start; i < stop; i++)
+    {
+        if (i >= r && i < r + k)
+            continue;
+
+        x = 0;
+        for (p = 0; p < k; p++)
+            x |= ((mp_limb_t) gf2_mat_get_entry(A, i, pivcols[p])) << p;
+
+        if (x != 0)
+            _gf2_mat_row_xor(A->rows[i] + w0, T + x * W, W);
+    }
+}
+
+static void
+_gf2_mat_rref_worker(slong j, rref_arg_t * arg)
+{
+    slong start, stop;
+
+    start = arg->start + (j * (arg->stop - arg->start)) / arg->num;
+    stop = arg->start + ((j + 1) * (arg->stop - arg->start)) / arg->num;
+
+    _gf2_mat_rref_rows(arg->A, arg->T, arg->pivcols, arg->r, arg->k,
+                       arg->w0, start, stop);
+}
+
+/*
+    Method of the Four Russians inversion: up to k pivots are found at a
+    time by elimination restricted to the rows searched, the k pivot rows
+    are reduced to the identity on the pivot columns, and all 2^k sums of
+    them are tabulated. Every other row is then cleared in the pivot
+    columns by a single row addition. If reduced is zero, only the rows
+    below the pivots are cleared, giving a row echelon form.
+*/
+slong
+_gf2_mat_rref(gf2_mat_t A, int reduced)
+{
+    slong m, n, r, k, col, i, p, x, w0, W, nthreads;
+    slong pivcols[GF2_MAT_M4RI_K];
+    mp_ptr T, t;
+    rref_arg_t arg;
+
+    m = A->r;
+    n = A->c;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    T = flint_malloc(sizeof(mp_limb_t) * (WORD(1) << GF2_MAT_M4RI_K) * A->stride);
+    nthreads = flint_get_num_threads();
+
+    r = col = 0;
+
+    while (r < m && col < n)
+    {
+        k = 0;
+        w0 = col / FLINT_BITS;
+
+        while (k < GF2_MAT_M4RI_K && r + k < m && col < n)
+        {
+            for (i = r + k; i < m; i++)
+            {
+                for (p = 0; p < k; p++)
+                    if (gf2_mat_get_entry(A, i, pivcols[p]))
+                        _gf2_mat_row_xor(A->rows[i] + w0, A->rows[r + p] + w0,
+                                         A->stride - w0);
+
+                if (gf2_mat_get_entry(A, i, col))
+                    break;
+            }
+
+            if (i == m)
+            {
+                col++;
+                continue;
+            }
+
+            t = A->rows[i];
+            A->rows[i] = A->rows[r + k];
+            A->rows[r + k] = t;
+
+            for (p = 0; p < k; p++)
+                if (gf2_mat_get_entry(A, r + p, col))
+                    _gf2_mat_row_xor(A->rows[r + p] + w0, t + w0, A->stride - w0);
+
+            pivcols[k] = col;
+            k++;
+            col++;
+        }
+
+        if (k == 0)
+            break;
+
+        W = A->stride - w0;
+
+        flint_mpn_zero(T, W);
+        for (x = 1; x < (WORD(1) << k); x++)
+        {
+            mp_srcptr s = T + (x & (x - 1)) * W;
+            mp_srcptr b = A->rows[r + flint_ctz(x)] + w0;
+
+            for (i = 0; i < W; i++)
+                T[x * W + i] = s[i] ^ b[i];
+        }
+
+        /* the rows above the pivots are left alone unless reduced */
+        arg.A = A;
+        arg.T = T;
+        arg.pivcols = pivcols;
+        arg.r = r;
+        arg.k = k;
+        arg.w0 = w0;
+        arg.start = reduced ? 0 : r + k;
+        arg.stop = m;
+        arg.num = FLINT_MIN(nthreads, (arg.stop - arg.start) / 64);
+
+        if (arg.num > 1 && (arg.stop - arg.start) * W >= GF2_MAT_M4RI_THREAD_CUTOFF)
+            flint_parallel_do((do_func_t) _gf2_mat_rref_worker, &arg,
+                              arg.num, -1, FLINT_PARALLEL_STRIDED);
+        else
+            _gf2_mat_rref_rows(A, T, pivcols, r, k, w0, arg.start, arg.stop);
+
+        r += k;
+    }
+
+    flint_free(T);
+
+    return r;
+}
+
+slong
+gf2_mat_rref(gf2_mat_t A)
+{
+    return _gf2_mat_rref(A, 1);
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_set_nmod_mat(gf2_mat_t A, const nmod_mat_t B)
+{
+    slong i, j;
+
+    gf2_mat_zero(A);
+
+    for (i = 0; i < B->r; i++)
+        for (j = 0; j < B->c; j++)
+            if (B->rows[i][j] & 1)
+                gf2_mat_flip_entry(A, i, j);
+}
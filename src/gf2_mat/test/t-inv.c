@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("inv....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, B, C, I;
+        slong n;
+        int result;
+
+        n = n_randint(state, 200);
+
+        gf2_mat_init(A, n, n);
+        gf2_mat_init(B, n, n);
+        gf2_mat_init(C, n, n);
+        gf2_mat_init(I, n, n);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_one(I);
+
+        result = gf2_mat_inv(B, A);
+
+        if (result != (gf2_mat_rank(A) == n))
+        {
+            flint_printf("FAIL: singularity\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (result)
+        {
+            gf2_mat_mul(C, A, B);
+
+            if (!gf2_mat_equal(C, I))
+            {
+                flint_printf("FAIL: %wd x %wd\n", n, n);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            /* aliasing */
+            gf2_mat_inv(A, A);
+
+            if (!gf2_mat_equal(A, B))
+            {
+                flint_printf("FAIL: aliasing\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        gf2_mat_clear(I);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
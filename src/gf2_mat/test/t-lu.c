@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lu....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, LU;
+        nmod_mat_t b, lu;
+        slong m, n, rank, rank2;
+        slong * P, * P2;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(LU, m, n);
+        nmod_mat_init(b, m, n, 2);
+        nmod_mat_init(lu, m, n, 2);
+
+        P = flint_malloc(sizeof(slong) * FLINT_MAX(m, 1));
+        P2 = flint_malloc(sizeof(slong) * FLINT_MAX(m, 1));
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_get_nmod_mat(b, A);
+
+        gf2_mat_set(LU, A);
+        rank = gf2_mat_lu(P, LU, 0);
+        rank2 = nmod_mat_lu_classical(P2, b, 0);
+
+        /* both use the first nonzero entry as pivot */
+        gf2_mat_get_nmod_mat(lu, LU);
+
+        if (rank != rank2 || !nmod_mat_equal(lu, b))
+        {
+            flint_printf("FAIL: %wd x %wd, rank %wd, %wd\n", m, n, rank, rank2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_set(LU, A);
+        gf2_mat_get_nmod_mat(b, A);
+        rank = gf2_mat_lu(P, LU, 1);
+        rank2 = nmod_mat_lu_classical(P2, b, 1);
+
+        if (rank != rank2)
+        {
+            flint_printf("FAIL: rank check\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        flint_free(P);
+        flint_free(P2);
+        gf2_mat_clear(A);
+        gf2_mat_clear(LU);
+        nmod_mat_clear(b);
+        nmod_mat_clear(lu);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, X, Y, Z;
+        slong m, n, nullity;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(X, n, n);
+        gf2_mat_init(Z, m, n);
+
+        gf2_mat_randtest(A, state);
+
+        nullity = gf2_mat_nullspace(X, A);
+        gf2_mat_mul(Z, A, X);
+
+        gf2_mat_init(Y, n, n);
+        gf2_mat_set(Y, X);
+
+        if (nullity + gf2_mat_rank(A) != n || !gf2_mat_is_zero(Z) ||
+            gf2_mat_rank(Y) != nullity)
+        {
+            flint_printf("FAIL: %wd x %wd\n", m, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(X);
+        gf2_mat_clear(Y);
+        gf2_mat_clear(Z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
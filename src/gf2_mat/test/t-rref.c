@@ -0,0 +1,99 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rref....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, R;
+        nmod_mat_t a, r;
+        slong m, n, rank, rank2;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 8) == 0)
+        {
+            m = n_randint(state, 1000);
+            n = n_randint(state, 400);
+        }
+        else
+        {
+            m = n_randint(state, 150);
+            n = n_randint(state, 150);
+        }
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(R, m, n);
+        nmod_mat_init(a, m, n, 2);
+        nmod_mat_init(r, m, n, 2);
+
+        gf2_mat_randtest(A, state);
+
+        /* low rank matrices */
+        if (n_randint(state, 2) && m > 1)
+        {
+            gf2_mat_t X, Y;
+            slong k = n_randint(state, FLINT_MIN(m, n) + 1);
+
+            gf2_mat_init(X, m, k);
+            gf2_mat_init(Y, k, n);
+            gf2_mat_randtest(X, state);
+            gf2_mat_randtest(Y, state);
+            gf2_mat_mul(A, X, Y);
+            gf2_mat_clear(X);
+            gf2_mat_clear(Y);
+        }
+
+        gf2_mat_get_nmod_mat(a, A);
+        gf2_mat_set(R, A);
+
+        rank = gf2_mat_rref(R);
+        rank2 = nmod_mat_rref(a);
+        gf2_mat_get_nmod_mat(r, R);
+
+        if (rank != rank2 || !nmod_mat_equal(a, r))
+        {
+            flint_printf("FAIL: %wd x %wd, rank %wd, %wd\n", m, n, rank, rank2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (gf2_mat_rank(A) != rank)
+        {
+            flint_printf("FAIL: rank\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(R);
+        nmod_mat_clear(a);
+        nmod_mat_clear(r);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
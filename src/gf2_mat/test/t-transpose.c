@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t a, b, c;
+        slong m, n;
+
+        m = n_randint(state, 200);
+        n = n_randint(state, 200);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, n, m);
+        gf2_mat_init(C, m, n);
+        nmod_mat_init(a, m, n, 2);
+        nmod_mat_init(b, n, m, 2);
+        nmod_mat_init(c, n, m, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_transpose(B, A);
+
+        gf2_mat_get_nmod_mat(a, A);
+        gf2_mat_get_nmod_mat(b, B);
+        nmod_mat_transpose(c, a);
+
+        if (!nmod_mat_equal(b, c))
+        {
+            flint_printf("FAIL: %wd x %wd\n", m, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* the padding bits must stay zero */
+        gf2_mat_transpose(C, B);
+        gf2_mat_transpose(B, B);
+
+        if (!gf2_mat_equal(A, C) || B->r != m || !gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL: involution\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(a);
+        nmod_mat_clear(b);
+        nmod_mat_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+/* In-place transpose of the FLINT_BITS x FLINT_BITS bit matrix whose row k
+   is t[k], by recursively swapping the off-diagonal blocks. */
+static void
+_gf2_mat_transpose_block(mp_ptr t)
+{
+    mp_limb_t m, s;
+    slong j, k;
+
+    m = (UWORD(1) << (FLINT_BITS / 2)) - 1;
+
+    for (j = FLINT_BITS / 2; j != 0; j >>= 1, m ^= (m << j))
+    {
+        for (k = 0; k < FLINT_BITS; k = (k + j + 1) & ~j)
+        {
+            s = ((t[k] >> j) ^ t[k + j]) & m;
+            t[k] ^= s << j;
+            t[k + j] ^= s;
+        }
+    }
+}
+
+void
+gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A)
+{
+    mp_limb_t t[FLINT_BITS];
+    slong i, j, k, rows, cols;
+
+    if (B == A)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->c, A->r);
+        gf2_mat_transpose(T, A);
+        gf2_mat_swap(B, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    for (i = 0; i < B->stride; i++)
+    {
+        rows = FLINT_MIN(FLINT_BITS, A->r - i * FLINT_BITS);
+
+        for (j = 0; j < A->stride; j++)
+        {
+            cols = FLINT_MIN(FLINT_BITS, A->c - j * FLINT_BITS);
+
+            for (k = 0; k < rows; k++)
+                t[k] = A->rows[i * FLINT_BITS + k][j];
+            for ( ; k < FLINT_BITS; k++)
+                t[k] = 0;
+
+            _gf2_mat_transpose_block(t);
+
+            for (k = 0; k < cols; k++)
+                B->rows[j * FLINT_BITS + k][i] = t[k];
+        }
+    }
+}
@@ -16,6 +16,7 @@
 #include "fmpz_poly.h"
 #include "fmpz_poly_factor.h"
 #include "fmpz_mat.h"
+#include "fmpz_vec.h"
 #include "fmpq.h"
 #include "gr.h"
 #include "gr_generic.h"
@@ -849,6 +850,79 @@ _gr_fmpz_vec_sub(fmpz * res, const fmpz * vec1, const fmpz * vec2, slong len, gr
     return GR_SUCCESS;
 }
 
+int
+_gr_fmpz_vec_set(fmpz * res, const fmpz * vec, slong len, gr_ctx_t ctx)
+{
+    _fmpz_vec_set(res, vec, len);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_neg(fmpz * res, const fmpz * vec, slong len, gr_ctx_t ctx)
+{
+    _fmpz_vec_neg(res, vec, len);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_mul_scalar(fmpz * res, const fmpz * vec, slong len, const fmpz_t c, gr_ctx_t ctx)
+{
+    _fmpz_vec_scalar_mul_fmpz(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_mul_scalar_si(fmpz * res, const fmpz * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    _fmpz_vec_scalar_mul_si(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_mul_scalar_ui(fmpz * res, const fmpz * vec, slong len, ulong c, gr_ctx_t ctx)
+{
+    _fmpz_vec_scalar_mul_ui(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_divexact_scalar(fmpz * res, const fmpz * vec, slong len, const fmpz_t c, gr_ctx_t ctx)
+{
+    if (fmpz_is_zero(c))
+        return (len == 0) ? GR_SUCCESS : GR_DOMAIN;
+
+    _fmpz_vec_scalar_divexact_fmpz(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_addmul_scalar(fmpz * res, const fmpz * vec, slong len, const fmpz_t c, gr_ctx_t ctx)
+{
+    _fmpz_vec_scalar_addmul_fmpz(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_submul_scalar(fmpz * res, const fmpz * vec, slong len, const fmpz_t c, gr_ctx_t ctx)
+{
+    _fmpz_vec_scalar_submul_fmpz(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_addmul_scalar_si(fmpz * res, const fmpz * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    _fmpz_vec_scalar_addmul_si(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
+int
+_gr_fmpz_vec_submul_scalar_si(fmpz * res, const fmpz * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    _fmpz_vec_scalar_submul_si(res, vec, len, c);
+    return GR_SUCCESS;
+}
+
 int
 _gr_fmpz_vec_sum(fmpz_t res, const fmpz * vec, slong len, gr_ctx_t ctx)
 {
@@ -1208,8 +1282,18 @@ gr_method_tab_input _fmpz_methods_input[] =
     {GR_METHOD_FIB_FMPZ,        (gr_funcptr) _gr_fmpz_fib_fmpz},
     {GR_METHOD_VEC_IS_ZERO,     (gr_funcptr) _gr_fmpz_vec_is_zero},
     {GR_METHOD_VEC_EQUAL,       (gr_funcptr) _gr_fmpz_vec_equal},
+    {GR_METHOD_VEC_SET,         (gr_funcptr) _gr_fmpz_vec_set},
+    {GR_METHOD_VEC_NEG,         (gr_funcptr) _gr_fmpz_vec_neg},
     {GR_METHOD_VEC_ADD,         (gr_funcptr) _gr_fmpz_vec_add},
     {GR_METHOD_VEC_SUB,         (gr_funcptr) _gr_fmpz_vec_sub},
+    {GR_METHOD_VEC_MUL_SCALAR,      (gr_funcptr) _gr_fmpz_vec_mul_scalar},
+    {GR_METHOD_VEC_MUL_SCALAR_SI,   (gr_funcptr) _gr_fmpz_vec_mul_scalar_si},
+    {GR_METHOD_VEC_MUL_SCALAR_UI,   (gr_funcptr) _gr_fmpz_vec_mul_scalar_ui},
+    {GR_METHOD_VEC_DIVEXACT_SCALAR, (gr_funcptr) _gr_fmpz_vec_divexact_scalar},
+    {GR_METHOD_VEC_ADDMUL_SCALAR,       (gr_funcptr) _gr_fmpz_vec_addmul_scalar},
+    {GR_METHOD_VEC_ADDMUL_SCALAR_SI,    (gr_funcptr) _gr_fmpz_vec_addmul_scalar_si},
+    {GR_METHOD_VEC_SUBMUL_SCALAR,       (gr_funcptr) _gr_fmpz_vec_submul_scalar},
+    {GR_METHOD_VEC_SUBMUL_SCALAR_SI,    (gr_funcptr) _gr_fmpz_vec_submul_scalar_si},
     {GR_METHOD_VEC_SUM,         (gr_funcptr) _gr_fmpz_vec_sum},
     {GR_METHOD_VEC_DOT,         (gr_funcptr) _gr_fmpz_vec_dot},
     {GR_METHOD_VEC_DOT_REV,     (gr_funcptr) _gr_fmpz_vec_dot_rev},
@@ -13,8 +13,11 @@
 #include "fmpq.h"
 #include "fexpr.h"
 #include "qqbar.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
 #include "fmpzi.h"
 #include "gr.h"
+#include "gr_poly.h"
 
 int
 _gr_fmpzi_ctx_write(gr_stream_t out, gr_ctx_t ctx)
@@ -884,6 +887,89 @@ _gr_fmpzi_cmpabs(int * res, const fmpzi_t x, const fmpzi_t y, const gr_ctx_t ctx
 */
 
 
+/* Below the cutoff the classical algorithm is faster than splitting
+   into real and imaginary parts. */
+#define FMPZI_POLY_MULLOW_CUTOFF 6
+
+/* Gauss's trick on polynomials: with A = a + bi and B = c + di,
+   AB = (ac - bd) + ((a + b)(c + d) - ac - bd) i, where the three
+   products are fmpz_poly multiplications (Kronecker substitution
+   or Schoenhage-Strassen as appropriate). */
+int
+_gr_fmpzi_poly_mullow(fmpzi_struct * res,
+    const fmpzi_struct * poly1, slong len1,
+    const fmpzi_struct * poly2, slong len2, slong n, gr_ctx_t ctx)
+{
+    fmpz *a, *b, *c, *d, *s1, *s2, *t, *u, *v;
+    slong i;
+    int squaring;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    if (FLINT_MIN(len1, len2) < FMPZI_POLY_MULLOW_CUTOFF)
+        return _gr_poly_mullow_generic(res, poly1, len1, poly2, len2, n, ctx);
+
+    if (len1 < len2)
+        return _gr_fmpzi_poly_mullow(res, poly2, len2, poly1, len1, n, ctx);
+
+    squaring = (poly1 == poly2 && len1 == len2);
+
+    /* shallow copies of the real and imaginary parts */
+    a = flint_malloc(sizeof(fmpz) * 2 * (len1 + len2));
+    b = a + len1;
+    c = b + len1;
+    d = c + len2;
+
+    for (i = 0; i < len1; i++)
+    {
+        a[i] = *fmpzi_realref(poly1 + i);
+        b[i] = *fmpzi_imagref(poly1 + i);
+    }
+
+    for (i = 0; i < len2; i++)
+    {
+        c[i] = *fmpzi_realref(poly2 + i);
+        d[i] = *fmpzi_imagref(poly2 + i);
+    }
+
+    s1 = _fmpz_vec_init(len1 + len2 + 3 * n);
+    s2 = s1 + len1;
+    t = s2 + len2;
+    u = t + n;
+    v = u + n;
+
+    _fmpz_vec_add(s1, a, b, len1);
+    if (!squaring)
+        _fmpz_vec_add(s2, c, d, len2);
+
+    if (squaring)
+    {
+        _fmpz_poly_sqrlow(t, a, len1, n);
+        _fmpz_poly_sqrlow(u, b, len1, n);
+        _fmpz_poly_sqrlow(v, s1, len1, n);
+    }
+    else
+    {
+        _fmpz_poly_mullow(t, a, len1, c, len2, n);
+        _fmpz_poly_mullow(u, b, len1, d, len2, n);
+        _fmpz_poly_mullow(v, s1, len1, s2, len2, n);
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        fmpz_sub(fmpzi_realref(res + i), t + i, u + i);
+        fmpz_sub(fmpzi_imagref(res + i), v + i, t + i);
+        fmpz_sub(fmpzi_imagref(res + i), fmpzi_imagref(res + i), u + i);
+    }
+
+    _fmpz_vec_clear(s1, len1 + len2 + 3 * n);
+    flint_free(a);
+
+    return GR_SUCCESS;
+}
+
+
 int _fmpzi_methods_initialized = 0;
 
 gr_static_method_table _fmpzi_methods;
@@ -993,6 +1079,7 @@ gr_method_tab_input _fmpzi_methods_input[] =
     {GR_METHOD_CONJ,            (gr_funcptr) _gr_fmpzi_conj},
     {GR_METHOD_RE,              (gr_funcptr) _gr_fmpzi_re},
     {GR_METHOD_IM,              (gr_funcptr) _gr_fmpzi_im},
+    {GR_METHOD_POLY_MULLOW,     (gr_funcptr) _gr_fmpzi_poly_mullow},
 /*
     {GR_METHOD_SGN,             (gr_funcptr) _gr_fmpzi_sgn},
     {GR_METHOD_CSGN,            (gr_funcptr) _gr_fmpzi_csgn},
@@ -1000,7 +1087,6 @@ gr_method_tab_input _fmpzi_methods_input[] =
     {GR_METHOD_CMPABS,          (gr_funcptr) _gr_fmpzi_cmpabs},
     {GR_METHOD_VEC_DOT,         (gr_funcptr) _gr_fmpzi_vec_dot},
     {GR_METHOD_VEC_DOT_REV,     (gr_funcptr) _gr_fmpzi_vec_dot_rev},
-    {GR_METHOD_POLY_MULLOW,     (gr_funcptr) _gr_fmpzi_poly_mullow},
     {GR_METHOD_MAT_MUL,         (gr_funcptr) _gr_fmpzi_mat_mul},
     {GR_METHOD_MAT_DET,         (gr_funcptr) _gr_fmpzi_mat_det},
 */
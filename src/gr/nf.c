@@ -13,6 +13,9 @@
 #include <string.h>
 #include "fexpr.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
 #include "nf.h"
 #include "nf_elem.h"
 #include "gr.h"
@@ -509,7 +512,117 @@ _gr_nf_denominator(nf_elem_t res, const nf_elem_t x, const gr_ctx_t ctx)
 }
 
 /* todo: dot products, without intermediate reductions? */
-/* todo: polynomial multiplication, etc. */
+
+/* Below the cutoff (in terms of the length times the degree of the
+   field) classical multiplication is faster. */
+#define NF_POLY_MULLOW_CUTOFF 12
+
+/* Writes the numerators of poly[0], ..., poly[len - 1] to res with
+   the given stride, scaled to a common denominator den. */
+static void
+_nf_poly_pack(fmpz * res, fmpz_t den, const nf_elem_struct * poly, slong len, slong stride, fmpq_poly_t t, const nf_t nf)
+{
+    fmpz_t c;
+    slong i;
+
+    fmpz_init(c);
+    fmpz_one(den);
+
+    for (i = 0; i < len; i++)
+    {
+        nf_elem_get_fmpq_poly(t, poly + i, nf);
+        fmpz_lcm(den, den, fmpq_poly_denref(t));
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        nf_elem_get_fmpq_poly(t, poly + i, nf);
+        fmpz_divexact(c, den, fmpq_poly_denref(t));
+        _fmpz_vec_scalar_mul_fmpz(res + i * stride, fmpq_poly_numref(t), fmpq_poly_length(t), c);
+    }
+
+    fmpz_clear(c);
+}
+
+/* Kronecker substitution: with elements represented as polynomials of
+   degree < d in the generator, the product is computed as a single
+   fmpz_poly product with each coefficient packed into 2d - 1 slots,
+   followed by one reduction per output coefficient instead of one per
+   coefficient product. */
+int
+_gr_nf_poly_mullow(nf_elem_struct * res,
+    const nf_elem_struct * poly1, slong len1,
+    const nf_elem_struct * poly2, slong len2, slong n, gr_ctx_t ctx)
+{
+    const nf_struct * nf = NF_CTX(ctx);
+    slong d, stride, plen1, plen2, rlen, i;
+    fmpz *P1, *P2, *R;
+    fmpz_t den1, den2;
+    fmpq_poly_t t;
+    int squaring;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    d = fmpq_poly_degree(nf->pol);
+
+    if (FLINT_MIN(len1, len2) * d < NF_POLY_MULLOW_CUTOFF)
+        return _gr_poly_mullow_generic(res, poly1, len1, poly2, len2, n, ctx);
+
+    if (len1 < len2)
+        return _gr_nf_poly_mullow(res, poly2, len2, poly1, len1, n, ctx);
+
+    squaring = (poly1 == poly2 && len1 == len2);
+
+    stride = 2 * d - 1;
+    plen1 = (len1 - 1) * stride + d;
+    plen2 = (len2 - 1) * stride + d;
+    rlen = FLINT_MIN(n * stride, plen1 + plen2 - 1);
+
+    P1 = _fmpz_vec_init(plen1 + (squaring ? 0 : plen2) + rlen);
+    P2 = squaring ? P1 : P1 + plen1;
+    R = P2 + (squaring ? plen1 : plen2);
+
+    fmpz_init(den1);
+    fmpz_init(den2);
+    fmpq_poly_init(t);
+
+    _nf_poly_pack(P1, den1, poly1, len1, stride, t, nf);
+
+    if (squaring)
+    {
+        fmpz_set(den2, den1);
+        _fmpz_poly_sqrlow(R, P1, plen1, rlen);
+    }
+    else
+    {
+        _nf_poly_pack(P2, den2, poly2, len2, stride, t, nf);
+        _fmpz_poly_mullow(R, P1, plen1, P2, plen2, rlen);
+    }
+
+    fmpz_mul(den1, den1, den2);
+
+    fmpq_poly_fit_length(t, stride);
+
+    for (i = 0; i < n; i++)
+    {
+        slong m = FLINT_MIN(stride, rlen - i * stride);
+
+        _fmpz_vec_set(t->coeffs, R + i * stride, m);
+        fmpz_set(fmpq_poly_denref(t), den1);
+        _fmpq_poly_set_length(t, m);
+        _fmpq_poly_normalise(t);
+        fmpq_poly_canonicalise(t);
+        nf_elem_set_fmpq_poly(res + i, t, nf);
+    }
+
+    _fmpz_vec_clear(P1, plen1 + (squaring ? 0 : plen2) + rlen);
+    fmpz_clear(den1);
+    fmpz_clear(den2);
+    fmpq_poly_clear(t);
+
+    return GR_SUCCESS;
+}
 
 
 int _nf_methods_initialized = 0;
@@ -591,6 +704,8 @@ gr_method_tab_input _nf_methods_input[] =
 
     {GR_METHOD_POW_UI,          (gr_funcptr) _gr_nf_pow_ui},
 
+    {GR_METHOD_POLY_MULLOW,     (gr_funcptr) _gr_nf_poly_mullow},
+
     {GR_METHOD_NUMERATOR,       (gr_funcptr) _gr_nf_numerator},
     {GR_METHOD_DENOMINATOR,     (gr_funcptr) _gr_nf_denominator},
 
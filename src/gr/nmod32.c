@@ -13,8 +13,10 @@
 #include "fmpq.h"
 #include "nmod.h"
 #include "nmod_vec.h"
+#include "nmod_poly.h"
 #include "gr.h"
 #include "gr_mat.h"
+#include "gr_poly.h"
 
 #define NMOD32_CTX_REF(ring_ctx) (((nmod_t *)((ring_ctx))))
 #define NMOD32_CTX(ring_ctx) (*NMOD32_CTX_REF(ring_ctx))
@@ -342,6 +344,114 @@ _nmod32_vec_sub(nmod32_struct * res, const nmod32_struct * vec1, const nmod32_st
     return GR_SUCCESS;
 }
 
+/* Multiplication by a fixed scalar c < n < 2^32 using a Shoup-style
+   precomputed quotient cinv = floor(c * 2^32 / n). Only 32 x 32 -> 64-bit
+   multiplications are needed, so the loops are easy to vectorize. */
+static void
+__nmod32_vec_scalar_mul(nmod32_struct * res, const nmod32_struct * vec, slong len, ulong c, nmod_t mod)
+{
+    slong i;
+#if FLINT_BITS == 64
+    ulong n, cinv, q, r;
+
+    n = mod.n;
+    cinv = (c << 32) / n;
+
+    for (i = 0; i < len; i++)
+    {
+        q = ((ulong) vec[i] * cinv) >> 32;
+        r = (ulong) vec[i] * c - q * n;
+        res[i] = (r >= n) ? r - n : r;
+    }
+#else
+    for (i = 0; i < len; i++)
+        res[i] = nmod_mul(vec[i], c, mod);
+#endif
+}
+
+static void
+__nmod32_vec_scalar_addmul(nmod32_struct * res, const nmod32_struct * vec, slong len, ulong c, nmod_t mod)
+{
+    slong i;
+#if FLINT_BITS == 64
+    ulong n, cinv, q, r;
+
+    n = mod.n;
+    cinv = (c << 32) / n;
+
+    for (i = 0; i < len; i++)
+    {
+        q = ((ulong) vec[i] * cinv) >> 32;
+        r = (ulong) vec[i] * c - q * n;
+        r = (r >= n) ? r - n : r;
+        r += res[i];
+        res[i] = (r >= n) ? r - n : r;
+    }
+#else
+    for (i = 0; i < len; i++)
+        res[i] = nmod_add(res[i], nmod_mul(vec[i], c, mod), mod);
+#endif
+}
+
+int
+_nmod32_vec_mul_scalar(nmod32_struct * res, const nmod32_struct * vec, slong len, const nmod32_t c, gr_ctx_t ctx)
+{
+    __nmod32_vec_scalar_mul(res, vec, len, c[0], NMOD32_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod32_vec_mul_scalar_si(nmod32_struct * res, const nmod32_struct * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    nmod32_t t;
+    nmod32_set_si(t, c, ctx);
+    __nmod32_vec_scalar_mul(res, vec, len, t[0], NMOD32_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod32_vec_mul_scalar_ui(nmod32_struct * res, const nmod32_struct * vec, slong len, ulong c, gr_ctx_t ctx)
+{
+    nmod32_t t;
+    nmod32_set_ui(t, c, ctx);
+    __nmod32_vec_scalar_mul(res, vec, len, t[0], NMOD32_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod32_vec_addmul_scalar(nmod32_struct * res, const nmod32_struct * vec, slong len, const nmod32_t c, gr_ctx_t ctx)
+{
+    __nmod32_vec_scalar_addmul(res, vec, len, c[0], NMOD32_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod32_vec_submul_scalar(nmod32_struct * res, const nmod32_struct * vec, slong len, const nmod32_t c, gr_ctx_t ctx)
+{
+    nmod_t mod = NMOD32_CTX(ctx);
+    __nmod32_vec_scalar_addmul(res, vec, len, nmod_neg(c[0], mod), mod);
+    return GR_SUCCESS;
+}
+
+int
+_nmod32_vec_addmul_scalar_si(nmod32_struct * res, const nmod32_struct * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    nmod32_t t;
+    nmod32_set_si(t, c, ctx);
+    __nmod32_vec_scalar_addmul(res, vec, len, t[0], NMOD32_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod32_vec_submul_scalar_si(nmod32_struct * res, const nmod32_struct * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    nmod32_t t;
+    nmod_t mod = NMOD32_CTX(ctx);
+    nmod32_set_si(t, c, ctx);
+    __nmod32_vec_scalar_addmul(res, vec, len, nmod_neg(t[0], mod), mod);
+    return GR_SUCCESS;
+}
+
 /* todo: overflow checks */
 int
 _nmod32_vec_dot(nmod32_t res, const nmod32_t initial, int subtract, const nmod32_struct * vec1, const nmod32_struct * vec2, slong len, gr_ctx_t ctx)
@@ -436,6 +546,50 @@ _nmod32_vec_dot_rev(nmod32_t res, const nmod32_t initial, int subtract, const nm
     return GR_SUCCESS;
 }
 
+/* Below the cutoff the classical algorithm with the vectorised dot
+   product is faster than converting to and from word-size coefficients. */
+#define NMOD32_POLY_MULLOW_CUTOFF 12
+
+int
+_nmod32_poly_mullow(nmod32_struct * res,
+    const nmod32_struct * poly1, slong len1,
+    const nmod32_struct * poly2, slong len2, slong n, gr_ctx_t ctx)
+{
+    mp_ptr t, a, b;
+    slong i;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    if (FLINT_MIN(len1, len2) < NMOD32_POLY_MULLOW_CUTOFF)
+        return _gr_poly_mullow_generic(res, poly1, len1, poly2, len2, n, ctx);
+
+    if (len1 < len2)
+        return _nmod32_poly_mullow(res, poly2, len2, poly1, len1, n, ctx);
+
+    t = flint_malloc(sizeof(mp_limb_t) * (n + len1 + len2));
+    a = t + n;
+    b = a + len1;
+
+    for (i = 0; i < len1; i++)
+        a[i] = poly1[i];
+
+    if (poly1 == poly2 && len1 == len2)
+        b = a;
+    else
+        for (i = 0; i < len2; i++)
+            b[i] = poly2[i];
+
+    _nmod_poly_mullow(t, a, len1, b, len2, n, NMOD32_CTX(ctx));
+
+    for (i = 0; i < n; i++)
+        res[i] = t[i];
+
+    flint_free(t);
+
+    return GR_SUCCESS;
+}
+
 /* todo: tuning for rectangular matrices */
 int
 _nmod32_mat_mul(gr_mat_t C, const gr_mat_t A, const gr_mat_t B, gr_ctx_t ctx)
@@ -501,8 +655,16 @@ gr_method_tab_input _nmod32_methods_input[] =
     {GR_METHOD_VEC_NEG,         (gr_funcptr) _nmod32_vec_neg},
     {GR_METHOD_VEC_ADD,         (gr_funcptr) _nmod32_vec_add},
     {GR_METHOD_VEC_SUB,         (gr_funcptr) _nmod32_vec_sub},
+    {GR_METHOD_VEC_MUL_SCALAR,      (gr_funcptr) _nmod32_vec_mul_scalar},
+    {GR_METHOD_VEC_MUL_SCALAR_SI,   (gr_funcptr) _nmod32_vec_mul_scalar_si},
+    {GR_METHOD_VEC_MUL_SCALAR_UI,   (gr_funcptr) _nmod32_vec_mul_scalar_ui},
+    {GR_METHOD_VEC_ADDMUL_SCALAR,       (gr_funcptr) _nmod32_vec_addmul_scalar},
+    {GR_METHOD_VEC_ADDMUL_SCALAR_SI,    (gr_funcptr) _nmod32_vec_addmul_scalar_si},
+    {GR_METHOD_VEC_SUBMUL_SCALAR,       (gr_funcptr) _nmod32_vec_submul_scalar},
+    {GR_METHOD_VEC_SUBMUL_SCALAR_SI,    (gr_funcptr) _nmod32_vec_submul_scalar_si},
     {GR_METHOD_VEC_DOT,         (gr_funcptr) _nmod32_vec_dot},
     {GR_METHOD_VEC_DOT_REV,     (gr_funcptr) _nmod32_vec_dot_rev},
+    {GR_METHOD_POLY_MULLOW,     (gr_funcptr) _nmod32_poly_mullow},
     {GR_METHOD_MAT_MUL,         (gr_funcptr) _nmod32_mat_mul},
     {0,                         (gr_funcptr) NULL},
 };
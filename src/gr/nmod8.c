@@ -13,8 +13,10 @@
 #include "fmpq.h"
 #include "nmod.h"
 #include "nmod_vec.h"
+#include "nmod_poly.h"
 #include "gr.h"
 #include "gr_mat.h"
+#include "gr_poly.h"
 
 #define NMOD8_CTX_REF(ring_ctx) (((nmod_t *)((ring_ctx))))
 #define NMOD8_CTX(ring_ctx) (*NMOD8_CTX_REF(ring_ctx))
@@ -343,6 +345,110 @@ _nmod8_vec_sub(nmod8_struct * res, const nmod8_struct * vec1, const nmod8_struct
     return GR_SUCCESS;
 }
 
+/* Reduction of t < 2^16 using a precomputed m = floor((2^32 - 1) / n).
+   The quotient estimate is off by at most one, and the loops using this
+   are simple enough for the compiler to vectorize. */
+#define NMOD8_RED16(r, t, m, n) \
+    do { \
+        ulong __q, __r; \
+        __q = ((t) * (m)) >> 32; \
+        __r = (t) - __q * (n); \
+        (r) = (__r >= (n)) ? __r - (n) : __r; \
+    } while (0)
+
+static void
+__nmod8_vec_scalar_mul(nmod8_struct * res, const nmod8_struct * vec, slong len, ulong c, nmod_t mod)
+{
+    slong i;
+    ulong t, n, m;
+
+    n = mod.n;
+    m = UWORD(0xffffffff) / n;
+
+    for (i = 0; i < len; i++)
+    {
+        t = (ulong) vec[i] * c;
+        NMOD8_RED16(t, t, m, n);
+        res[i] = t;
+    }
+}
+
+static void
+__nmod8_vec_scalar_addmul(nmod8_struct * res, const nmod8_struct * vec, slong len, ulong c, nmod_t mod)
+{
+    slong i;
+    ulong t, n, m;
+
+    n = mod.n;
+    m = UWORD(0xffffffff) / n;
+
+    for (i = 0; i < len; i++)
+    {
+        t = (ulong) res[i] + (ulong) vec[i] * c;
+        NMOD8_RED16(t, t, m, n);
+        res[i] = t;
+    }
+}
+
+int
+_nmod8_vec_mul_scalar(nmod8_struct * res, const nmod8_struct * vec, slong len, const nmod8_t c, gr_ctx_t ctx)
+{
+    __nmod8_vec_scalar_mul(res, vec, len, c[0], NMOD8_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod8_vec_mul_scalar_si(nmod8_struct * res, const nmod8_struct * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    nmod8_t t;
+    nmod8_set_si(t, c, ctx);
+    __nmod8_vec_scalar_mul(res, vec, len, t[0], NMOD8_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod8_vec_mul_scalar_ui(nmod8_struct * res, const nmod8_struct * vec, slong len, ulong c, gr_ctx_t ctx)
+{
+    nmod8_t t;
+    nmod8_set_ui(t, c, ctx);
+    __nmod8_vec_scalar_mul(res, vec, len, t[0], NMOD8_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod8_vec_addmul_scalar(nmod8_struct * res, const nmod8_struct * vec, slong len, const nmod8_t c, gr_ctx_t ctx)
+{
+    __nmod8_vec_scalar_addmul(res, vec, len, c[0], NMOD8_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod8_vec_submul_scalar(nmod8_struct * res, const nmod8_struct * vec, slong len, const nmod8_t c, gr_ctx_t ctx)
+{
+    nmod_t mod = NMOD8_CTX(ctx);
+    __nmod8_vec_scalar_addmul(res, vec, len, nmod_neg(c[0], mod), mod);
+    return GR_SUCCESS;
+}
+
+int
+_nmod8_vec_addmul_scalar_si(nmod8_struct * res, const nmod8_struct * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    nmod8_t t;
+    nmod8_set_si(t, c, ctx);
+    __nmod8_vec_scalar_addmul(res, vec, len, t[0], NMOD8_CTX(ctx));
+    return GR_SUCCESS;
+}
+
+int
+_nmod8_vec_submul_scalar_si(nmod8_struct * res, const nmod8_struct * vec, slong len, slong c, gr_ctx_t ctx)
+{
+    nmod8_t t;
+    nmod_t mod = NMOD8_CTX(ctx);
+    nmod8_set_si(t, c, ctx);
+    __nmod8_vec_scalar_addmul(res, vec, len, nmod_neg(t[0], mod), mod);
+    return GR_SUCCESS;
+}
+
 int
 _nmod8_vec_dot(nmod8_t res, const nmod8_t initial, int subtract, const nmod8_struct * vec1, const nmod8_struct * vec2, slong len, gr_ctx_t ctx)
 {
@@ -471,6 +577,50 @@ _nmod8_vec_dot_rev(nmod8_t res, const nmod8_t initial, int subtract, const nmod8
     return GR_SUCCESS;
 }
 
+/* Below the cutoff the classical algorithm with the vectorised dot
+   product is faster than converting to and from word-size coefficients. */
+#define NMOD8_POLY_MULLOW_CUTOFF 16
+
+int
+_nmod8_poly_mullow(nmod8_struct * res,
+    const nmod8_struct * poly1, slong len1,
+    const nmod8_struct * poly2, slong len2, slong n, gr_ctx_t ctx)
+{
+    mp_ptr t, a, b;
+    slong i;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    if (FLINT_MIN(len1, len2) < NMOD8_POLY_MULLOW_CUTOFF)
+        return _gr_poly_mullow_generic(res, poly1, len1, poly2, len2, n, ctx);
+
+    if (len1 < len2)
+        return _nmod8_poly_mullow(res, poly2, len2, poly1, len1, n, ctx);
+
+    t = flint_malloc(sizeof(mp_limb_t) * (n + len1 + len2));
+    a = t + n;
+    b = a + len1;
+
+    for (i = 0; i < len1; i++)
+        a[i] = poly1[i];
+
+    if (poly1 == poly2 && len1 == len2)
+        b = a;
+    else
+        for (i = 0; i < len2; i++)
+            b[i] = poly2[i];
+
+    _nmod_poly_mullow(t, a, len1, b, len2, n, NMOD8_CTX(ctx));
+
+    for (i = 0; i < n; i++)
+        res[i] = t[i];
+
+    flint_free(t);
+
+    return GR_SUCCESS;
+}
+
 /* todo: tuning for rectangular matrices */
 int
 _nmod8_mat_mul(gr_mat_t C, const gr_mat_t A, const gr_mat_t B, gr_ctx_t ctx)
@@ -536,8 +686,16 @@ gr_method_tab_input _nmod8_methods_input[] =
     {GR_METHOD_VEC_NEG,         (gr_funcptr) _nmod8_vec_neg},
     {GR_METHOD_VEC_ADD,         (gr_funcptr) _nmod8_vec_add},
     {GR_METHOD_VEC_SUB,         (gr_funcptr) _nmod8_vec_sub},
+    {GR_METHOD_VEC_MUL_SCALAR,      (gr_funcptr) _nmod8_vec_mul_scalar},
+    {GR_METHOD_VEC_MUL_SCALAR_SI,   (gr_funcptr) _nmod8_vec_mul_scalar_si},
+    {GR_METHOD_VEC_MUL_SCALAR_UI,   (gr_funcptr) _nmod8_vec_mul_scalar_ui},
+    {GR_METHOD_VEC_ADDMUL_SCALAR,       (gr_funcptr) _nmod8_vec_addmul_scalar},
+    {GR_METHOD_VEC_ADDMUL_SCALAR_SI,    (gr_funcptr) _nmod8_vec_addmul_scalar_si},
+    {GR_METHOD_VEC_SUBMUL_SCALAR,       (gr_funcptr) _nmod8_vec_submul_scalar},
+    {GR_METHOD_VEC_SUBMUL_SCALAR_SI,    (gr_funcptr) _nmod8_vec_submul_scalar_si},
     {GR_METHOD_VEC_DOT,         (gr_funcptr) _nmod8_vec_dot},
     {GR_METHOD_VEC_DOT_REV,     (gr_funcptr) _nmod8_vec_dot_rev},
+    {GR_METHOD_POLY_MULLOW,     (gr_funcptr) _nmod8_poly_mullow},
     {GR_METHOD_MAT_MUL,         (gr_funcptr) _nmod8_mat_mul},
     {0,                         (gr_funcptr) NULL},
 };
@@ -2862,6 +2862,103 @@ int gr_test_vec_div(gr_ctx_t R, flint_rand_t state, int test_flags) { return gr_
 int gr_test_vec_divexact(gr_ctx_t R, flint_rand_t state, int test_flags) { return gr_test_vec_binary_op(R, "vec_divexact", gr_divexact, _gr_vec_divexact, state, test_flags); }
 int gr_test_vec_pow(gr_ctx_t R, flint_rand_t state, int test_flags) { return gr_test_vec_binary_op(R, "vec_pow", gr_pow, _gr_vec_pow, state, test_flags); }
 
+int
+gr_test_vec_scalar(gr_ctx_t R, flint_rand_t state, int test_flags)
+{
+    int status, which, aliasing;
+    slong i, len, c_si;
+    gr_ptr x, y1, y2, c;
+    slong sz = R->sizeof_elem;
+
+    len = n_randint(state, 10);
+    which = n_randint(state, 6);
+    aliasing = n_randint(state, 2);
+    c_si = (slong) n_randtest(state);
+
+    GR_TMP_INIT_VEC(x, len, R);
+    GR_TMP_INIT_VEC(y1, len, R);
+    GR_TMP_INIT_VEC(y2, len, R);
+    GR_TMP_INIT(c, R);
+
+    GR_MUST_SUCCEED(_gr_vec_randtest(x, state, len, R));
+    GR_MUST_SUCCEED(_gr_vec_randtest(y1, state, len, R));
+    GR_MUST_SUCCEED(gr_randtest(c, state, R));
+
+    status = GR_SUCCESS;
+    status |= _gr_vec_set(y2, y1, len, R);
+
+    /* reference: entrywise scalar operations */
+    for (i = 0; i < len; i++)
+    {
+        switch (which)
+        {
+            case 0: status |= gr_mul(GR_ENTRY(y2, i, sz), GR_ENTRY(x, i, sz), c, R); break;
+            case 1: status |= gr_addmul(GR_ENTRY(y2, i, sz), GR_ENTRY(x, i, sz), c, R); break;
+            case 2: status |= gr_submul(GR_ENTRY(y2, i, sz), GR_ENTRY(x, i, sz), c, R); break;
+            case 3: status |= gr_mul_si(GR_ENTRY(y2, i, sz), GR_ENTRY(x, i, sz), c_si, R); break;
+            case 4: status |= gr_addmul_si(GR_ENTRY(y2, i, sz), GR_ENTRY(x, i, sz), c_si, R); break;
+            default: status |= gr_submul_si(GR_ENTRY(y2, i, sz), GR_ENTRY(x, i, sz), c_si, R); break;
+        }
+    }
+
+    switch (which)
+    {
+        case 0:
+            if (aliasing)
+            {
+                status |= _gr_vec_set(y1, x, len, R);
+                status |= _gr_vec_mul_scalar(y1, y1, len, c, R);
+            }
+            else
+            {
+                status |= _gr_vec_mul_scalar(y1, x, len, c, R);
+            }
+            break;
+        case 1: status |= _gr_vec_addmul_scalar(y1, x, len, c, R); break;
+        case 2: status |= _gr_vec_submul_scalar(y1, x, len, c, R); break;
+        case 3:
+            if (aliasing)
+            {
+                status |= _gr_vec_set(y1, x, len, R);
+                status |= _gr_vec_mul_scalar_si(y1, y1, len, c_si, R);
+            }
+            else
+            {
+                status |= _gr_vec_mul_scalar_si(y1, x, len, c_si, R);
+            }
+            break;
+        case 4: status |= _gr_vec_addmul_scalar_si(y1, x, len, c_si, R); break;
+        default: status |= _gr_vec_submul_scalar_si(y1, x, len, c_si, R); break;
+    }
+
+    if (status == GR_SUCCESS && _gr_vec_equal(y1, y2, len, R) == T_FALSE)
+    {
+        status = GR_TEST_FAIL;
+    }
+
+    if ((test_flags & GR_TEST_ALWAYS_ABLE) && (status & GR_UNABLE))
+        status = GR_TEST_FAIL;
+
+    if ((test_flags & GR_TEST_VERBOSE) || status == GR_TEST_FAIL)
+    {
+        flint_printf("vec_scalar\n");
+        gr_ctx_println(R);
+        flint_printf("which: %d, aliasing: %d\n", which, aliasing);
+        flint_printf("c = "); gr_println(c, R);
+        flint_printf("c_si = %wd\n", c_si);
+        _gr_vec_print(x, len, R); flint_printf("\n");
+        _gr_vec_print(y1, len, R); flint_printf("\n");
+        _gr_vec_print(y2, len, R); flint_printf("\n");
+    }
+
+    GR_TMP_CLEAR_VEC(x, len, R);
+    GR_TMP_CLEAR_VEC(y1, len, R);
+    GR_TMP_CLEAR_VEC(y2, len, R);
+    GR_TMP_CLEAR(c, R);
+
+    return status;
+}
+
 int gr_generic_vec_dot(gr_ptr res, gr_srcptr initial, int subtract, gr_srcptr vec1, gr_srcptr vec2, slong len, gr_ctx_t ctx);
 
 int
@@ -3285,6 +3382,7 @@ gr_test_ring(gr_ctx_t R, slong iters, int test_flags)
     gr_test_iter(R, state, "vec_div", gr_test_vec_div, vec_iters, test_flags);
     gr_test_iter(R, state, "vec_divexact", gr_test_vec_divexact, vec_iters, test_flags);
     /* gr_test_iter(R, state, "vec_pow", gr_test_vec_pow, vec_iters, test_flags & (~GR_TEST_ALWAYS_ABLE)); large elements */
+    gr_test_iter(R, state, "vec_scalar", gr_test_vec_scalar, vec_iters, test_flags);
 
     gr_test_iter(R, state, "vec_dot", gr_test_vec_dot, iters, test_flags);
 
@@ -11,10 +11,19 @@
 
 #include "gr_mat.h"
 
-/* todo: algorithm selection */
+/* todo: algorithm selection for other rings */
 int
 _gr_mat_charpoly(gr_ptr cp, const gr_mat_t mat, gr_ctx_t ctx)
 {
+    /* Over finite fields there is no coefficient growth, so the O(n^3)
+       Hessenberg reduction beats the O(n^4) Berkowitz algorithm for
+       all but tiny matrices; both parallelize over rows. */
+    if (mat->r >= 12 && gr_ctx_is_finite(ctx) == T_TRUE && gr_ctx_is_field(ctx) == T_TRUE)
+    {
+        if (_gr_mat_charpoly_gauss(cp, mat, ctx) == GR_SUCCESS)
+            return GR_SUCCESS;
+    }
+
     return _gr_mat_charpoly_berkowitz(cp, mat, ctx);
 }
 
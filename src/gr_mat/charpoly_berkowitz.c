@@ -9,9 +9,32 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "gr_vec.h"
 #include "gr_mat.h"
 
+typedef struct
+{
+    const gr_mat_struct * mat;
+    gr_ptr a;
+    slong k;
+    slong t;
+    int * status;
+    gr_ctx_struct * ctx;
+}
+berkowitz_work_t;
+
+static void
+berkowitz_dot_worker(slong i, berkowitz_work_t * work)
+{
+    gr_ctx_struct * ctx = work->ctx;
+    slong sz = ctx->sizeof_elem;
+    slong n = work->mat->r, k = work->k;
+
+    work->status[i] = _gr_vec_dot(GR_ENTRY(work->a, k * n + i, sz), NULL, 0,
+        work->mat->rows[i], GR_ENTRY(work->a, (k - 1) * n, sz), work->t + 1, ctx);
+}
+
 int
 _gr_mat_charpoly_berkowitz(gr_ptr cp, const gr_mat_t mat, gr_ctx_t ctx)
 {
@@ -41,10 +64,20 @@ _gr_mat_charpoly_berkowitz(gr_ptr cp, const gr_mat_t mat, gr_ctx_t ctx)
     {
         slong i, k, t;
         gr_ptr a, A, s;
+        int thread_limit;
+        int * thread_status;
+        berkowitz_work_t work;
 
         GR_TMP_INIT_VEC(a, n * n, ctx);
         A = GR_ENTRY(a, (n - 1) * n, sz);
 
+        thread_limit = (gr_ctx_is_threadsafe(ctx) == T_TRUE) ? -1 : 1;
+        thread_status = flint_malloc(sizeof(int) * n);
+        work.mat = mat;
+        work.a = a;
+        work.status = thread_status;
+        work.ctx = ctx;
+
         status |= _gr_vec_zero(cp, n + 1, ctx);
         status |= gr_neg(cp, GR_MAT_ENTRY(mat, 0, 0, sz), ctx);
 
@@ -59,10 +92,23 @@ _gr_mat_charpoly_berkowitz(gr_ptr cp, const gr_mat_t mat, gr_ctx_t ctx)
 
             for (k = 1; k < t; k++)
             {
-                for (i = 0; i <= t; i++)
+                /* the matrix-vector product is the bulk of the work */
+                if (thread_limit != 1 && (t + 1) * (t + 1) >= 4096)
+                {
+                    work.k = k;
+                    work.t = t;
+                    flint_parallel_do((do_func_t) berkowitz_dot_worker, &work, t + 1, thread_limit, FLINT_PARALLEL_UNIFORM);
+
+                    for (i = 0; i <= t; i++)
+                        status |= thread_status[i];
+                }
+                else
                 {
-                    s = GR_ENTRY(a, k * n + i, sz);
-                    status |= _gr_vec_dot(s, NULL, 0, mat->rows[i], GR_ENTRY(a, (k - 1) * n, sz), t + 1, ctx);
+                    for (i = 0; i <= t; i++)
+                    {
+                        s = GR_ENTRY(a, k * n + i, sz);
+                        status |= _gr_vec_dot(s, NULL, 0, mat->rows[i], GR_ENTRY(a, (k - 1) * n, sz), t + 1, ctx);
+                    }
                 }
 
                 status |= gr_set(GR_ENTRY(A, k, sz), GR_ENTRY(a, k * n + t, sz), ctx);
@@ -85,6 +131,7 @@ _gr_mat_charpoly_berkowitz(gr_ptr cp, const gr_mat_t mat, gr_ctx_t ctx)
         status |= _gr_poly_reverse(cp, cp, n + 1, n + 1, ctx);
 
         GR_TMP_CLEAR_VEC(a, n * n, ctx);
+        flint_free(thread_status);
     }
 
     return status;
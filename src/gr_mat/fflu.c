@@ -9,9 +9,46 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "gr_vec.h"
 #include "gr_mat.h"
 
+typedef struct
+{
+    gr_ptr * a;
+    gr_srcptr den;
+    slong row;
+    slong col;
+    slong n;
+    int * status;
+    gr_ctx_struct * ctx;
+}
+fflu_work_t;
+
+/* fraction-free update of row row + 1 + k */
+static void
+fflu_row_worker(slong k, fflu_work_t * work)
+{
+    gr_ctx_struct * ctx = work->ctx;
+    gr_ptr * a = work->a;
+    slong j, row, col, len, sz;
+    int status = GR_SUCCESS;
+
+    sz = ctx->sizeof_elem;
+    row = work->row;
+    col = work->col;
+    j = row + 1 + k;
+    len = work->n - col - 1;
+
+    status |= _gr_vec_mul_scalar(GR_ENTRY(a[j], col + 1, sz), GR_ENTRY(a[j], col + 1, sz), len, GR_ENTRY(a[row], col, sz), ctx);
+    status |= _gr_vec_submul_scalar(GR_ENTRY(a[j], col + 1, sz), GR_ENTRY(a[row], col + 1, sz), len, GR_ENTRY(a[j], col, sz), ctx);
+
+    if (row > 0)
+        status |= _gr_vec_divexact_scalar(GR_ENTRY(a[j], col + 1, sz), GR_ENTRY(a[j], col + 1, sz), len, work->den, ctx);
+
+    work->status[k] = status;
+}
+
 static void
 _gr_mat_swap_rows(gr_mat_t mat, slong * perm, slong r, slong s, gr_ctx_t ctx)
 {
@@ -38,9 +75,9 @@ gr_mat_fflu(slong * res_rank, slong * P, gr_mat_t LU, gr_ptr den, const gr_mat_t
 {
     gr_ptr d, e;
     gr_ptr * a;
-    slong i, j, k, m, n, r, rank, row, col, sz;
+    slong i, j, m, n, r, rank, row, col, sz;
     int status = GR_SUCCESS;
-    int pivot_status;
+    int pivot_status, threadsafe;
 
     if (gr_mat_is_empty(A, ctx) == T_TRUE)
     {
@@ -61,6 +98,10 @@ gr_mat_fflu(slong * res_rank, slong * P, gr_mat_t LU, gr_ptr den, const gr_mat_t
 
     a = LU->rows;
 
+    /* rows below the pivot can be updated in parallel; the entries
+       grow, so this pays off already for fairly small matrices */
+    threadsafe = (flint_get_num_threads() > 1 && gr_ctx_is_threadsafe(ctx) == T_TRUE);
+
 #define ENTRY(i, j) GR_ENTRY(a[i], j, sz)
 
     rank = row = col = 0;
@@ -110,32 +151,55 @@ gr_mat_fflu(slong * res_rank, slong * P, gr_mat_t LU, gr_ptr den, const gr_mat_t
             break;
         */
 
-        for (j = row + 1; j < m; j++)
+        if (threadsafe && m - row - 1 >= 2 && (double) (m - row - 1) * (n - col) >= 1024)
         {
+            fflu_work_t work;
+
+            work.a = a;
+            work.den = den;
+            work.row = row;
+            work.col = col;
+            work.n = n;
+            work.status = flint_malloc(sizeof(int) * (m - row - 1));
+            work.ctx = ctx;
+
+            flint_parallel_do((do_func_t) fflu_row_worker, &work, m - row - 1, -1, FLINT_PARALLEL_UNIFORM);
+
+            for (j = 0; j < m - row - 1; j++)
+                status |= work.status[j];
+
+            flint_free(work.status);
+
+            if (row > 0 && status != GR_SUCCESS)
+                goto cleanup;
+        }
+        else
+        {
+            for (j = row + 1; j < m; j++)
+            {
 /*
-            status |= gr_mul(e, ENTRY(j, col), d, ctx);
-            status |= gr_neg(e, e, ctx);
-            status |= _gr_vec_addmul_scalar(ENTRY(j, col + 1), ENTRY(row, col + 1), n - col - 1, e, ctx);
-            status |= gr_zero(ENTRY(j, col), ctx);
-            status |= gr_neg(ENTRY(j, rank - 1), e, ctx);
+                status |= gr_mul(e, ENTRY(j, col), d, ctx);
+                status |= gr_neg(e, e, ctx);
+                status |= _gr_vec_addmul_scalar(ENTRY(j, col + 1), ENTRY(row, col + 1), n - col - 1, e, ctx);
+                status |= gr_zero(ENTRY(j, col), ctx);
+                status |= gr_neg(ENTRY(j, rank - 1), e, ctx);
 */
 
 
-            for (k = col + 1; k < n; k++)
-            {
-                status |= gr_mul(ENTRY(j, k), ENTRY(j, k), ENTRY(row, col), ctx);
-                status |= gr_mul(e, ENTRY(j, col), ENTRY(row, k), ctx);
-                status |= gr_sub(ENTRY(j, k), ENTRY(j, k), e, ctx);
+                /* Row update as vector operations, so that rings with
+                   specialized vector methods avoid per-entry dispatch. */
+                status |= _gr_vec_mul_scalar(ENTRY(j, col + 1), ENTRY(j, col + 1), n - col - 1, ENTRY(row, col), ctx);
+                status |= _gr_vec_submul_scalar(ENTRY(j, col + 1), ENTRY(row, col + 1), n - col - 1, ENTRY(j, col), ctx);
 
                 if (row > 0)
                 {
-                    status |= gr_divexact(ENTRY(j, k), ENTRY(j, k), den, ctx);
+                    status |= _gr_vec_divexact_scalar(ENTRY(j, col + 1), ENTRY(j, col + 1), n - col - 1, den, ctx);
 
                     if (status != GR_SUCCESS)
                         goto cleanup;
                 }
-            }
 
+            }
         }
 
         status |= gr_set(den, ENTRY(row, col), ctx);
@@ -9,10 +9,10 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
+#include "gr_vec.h"
 #include "gr_mat.h"
 
-int gr_generic_addmul(gr_ptr res, gr_srcptr x, gr_srcptr y, gr_ctx_t ctx);
-
 /* swap (a, b) and (c, d) using (t, u) as tmp space */
 static void
 gr_swap2(gr_ptr a, gr_ptr b, gr_ptr c, gr_ptr d, gr_ptr t, gr_ptr u, gr_ctx_t ctx)
@@ -25,17 +25,59 @@ gr_swap2(gr_ptr a, gr_ptr b, gr_ptr c, gr_ptr d, gr_ptr t, gr_ptr u, gr_ctx_t ct
     gr_swap(d, u, ctx);
 }
 
+typedef struct
+{
+    gr_mat_struct * res;
+    gr_srcptr U;
+    const char * nonzero;
+    slong m;
+    int * status;
+    gr_ctx_struct * ctx;
+}
+hessenberg_work_t;
+
+/* row i = m + 1 + k: add U[k] times row m and clear the subdiagonal entry */
+static void
+hessenberg_row_worker(slong k, hessenberg_work_t * work)
+{
+    gr_ctx_struct * ctx = work->ctx;
+    slong sz = ctx->sizeof_elem;
+    slong m = work->m, n = work->res->r, i = m + 1 + k;
+    int status = GR_SUCCESS;
+
+    if (work->nonzero[k])
+    {
+        status |= _gr_vec_addmul_scalar(GR_MAT_ENTRY(work->res, i - 1, m - 1, sz),
+            GR_MAT_ENTRY(work->res, m - 1, m - 1, sz), n - m + 1, GR_ENTRY(work->U, k, sz), ctx);
+        status |= gr_zero(GR_MAT_ENTRY(work->res, i - 1, m - 1 - 1, sz), ctx);
+    }
+
+    work->status[k] = status;
+}
+
+/* entry (j, m - 1): subtract U[k] times column m + k for all k */
+static void
+hessenberg_col_worker(slong j, hessenberg_work_t * work)
+{
+    gr_ctx_struct * ctx = work->ctx;
+    slong sz = ctx->sizeof_elem;
+    slong m = work->m, n = work->res->r;
+    gr_ptr s = GR_MAT_ENTRY(work->res, j, m - 1, sz);
+
+    work->status[j] = _gr_vec_dot(s, s, 1, GR_MAT_ENTRY(work->res, j, m, sz), work->U, n - m, ctx);
+}
+
 int
 gr_mat_hessenberg_gauss(gr_mat_t res, const gr_mat_t mat, gr_ctx_t ctx)
 {
-    gr_method_binary_op mul = GR_BINARY_OP(ctx, MUL);
-    gr_method_binary_op add = GR_BINARY_OP(ctx, ADD);
-    gr_method_binary_op addmul = GR_BINARY_OP(ctx, ADDMUL);
-    slong n, m, i, j;
-    gr_ptr h, u, t;
+    slong n, m, i, j, k;
+    gr_ptr h, u, t, U;
+    char * nonzero;
+    int * thread_status;
     truth_t is_zero;
-    int have_addmul;
     int status = GR_SUCCESS;
+    int have_nonzero, thread_limit;
+    hessenberg_work_t work;
     slong sz = ctx->sizeof_elem;
 
     n = mat->r;
@@ -46,23 +88,24 @@ gr_mat_hessenberg_gauss(gr_mat_t res, const gr_mat_t mat, gr_ctx_t ctx)
 
 #define MAT_ENTRY(i, j) GR_MAT_ENTRY(res, i, j, sz)
 
-    have_addmul = (addmul != (gr_method_binary_op) gr_generic_addmul);
-
-#define ADDMUL(z, x, y) \
-    if (have_addmul) \
-    { \
-        status |= addmul(z, x, y, ctx); \
-    } \
-    else \
-    { \
-        status |= mul(t, x, y, ctx); \
-        status |= add(z, z, t, ctx); \
-    } \
-
     if (n <= 2)
         return GR_SUCCESS;
 
     GR_TMP_INIT3(h, u, t, ctx);
+    GR_TMP_INIT_VEC(U, n, ctx);
+    nonzero = flint_malloc(n);
+    thread_status = flint_malloc(sizeof(int) * n);
+
+    work.res = res;
+    work.U = U;
+    work.nonzero = nonzero;
+    work.status = thread_status;
+    work.ctx = ctx;
+
+    if (gr_ctx_is_threadsafe(ctx) == T_TRUE)
+        thread_limit = -1;
+    else
+        thread_limit = 1;
 
     for (m = 2; m < n; m++)
     {
@@ -113,8 +156,17 @@ gr_mat_hessenberg_gauss(gr_mat_t res, const gr_mat_t mat, gr_ctx_t ctx)
                         MAT_ENTRY(j - 1, m - 1), MAT_ENTRY(j - 1, i - 1), t, u, ctx);
             }
 
+            /* The elementary row operations (adding multiples of row m to
+               the rows below) commute with each other and with the inverse
+               column operations (adding multiples of the columns to the
+               right to column m), so we compute all multipliers first and
+               then apply the row and column updates independently. */
+            have_nonzero = 0;
+
             for (i = m + 1; i < n + 1; i++)
             {
+                k = i - m - 1;
+
                 is_zero = gr_is_zero(MAT_ENTRY(i - 1, m - 1 - 1), ctx);
 
                 if (is_zero == T_UNKNOWN)
@@ -123,26 +175,43 @@ gr_mat_hessenberg_gauss(gr_mat_t res, const gr_mat_t mat, gr_ctx_t ctx)
                     goto cleanup;
                 }
 
-                if (is_zero == T_FALSE)
+                nonzero[k] = (is_zero == T_FALSE);
+
+                if (nonzero[k])
                 {
-                    status |= gr_mul(u, MAT_ENTRY(i - 1, m - 1 - 1), h, ctx);
+                    status |= gr_mul(GR_ENTRY(U, k, sz), MAT_ENTRY(i - 1, m - 1 - 1), h, ctx);
+                    have_nonzero = 1;
+                }
+                else
+                {
+                    status |= gr_zero(GR_ENTRY(U, k, sz), ctx);
+                }
+            }
 
-                    for (j = m; j < n + 1; j++)
-                        ADDMUL(MAT_ENTRY(i - 1, j - 1), u, MAT_ENTRY(m - 1, j - 1));
+            if (!have_nonzero)
+                continue;
 
-                    status |= gr_neg(u, u, ctx);
+            work.m = m;
 
-                    for (j = 1; j < n + 1; j++)
-                        ADDMUL(MAT_ENTRY(j - 1, m - 1), u, MAT_ENTRY(j - 1, i - 1));
+            flint_parallel_do((do_func_t) hessenberg_row_worker, &work, n - m,
+                ((n - m) * (n - m + 1) >= 4096) ? thread_limit : 1, FLINT_PARALLEL_UNIFORM);
 
-                    status |= gr_zero(MAT_ENTRY(i - 1, m - 1 - 1), ctx);
-                }
-            }
+            for (k = 0; k < n - m; k++)
+                status |= thread_status[k];
+
+            flint_parallel_do((do_func_t) hessenberg_col_worker, &work, n,
+                (n * (n - m) >= 4096) ? thread_limit : 1, FLINT_PARALLEL_UNIFORM);
+
+            for (j = 0; j < n; j++)
+                status |= thread_status[j];
         }
     }
 
 cleanup:
     GR_TMP_CLEAR3(h, u, t, ctx);
+    GR_TMP_CLEAR_VEC(U, n, ctx);
+    flint_free(nonzero);
+    flint_free(thread_status);
 
     return status;
 }
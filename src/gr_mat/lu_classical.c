@@ -9,9 +9,54 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "gr_vec.h"
 #include "gr_mat.h"
 
+typedef struct
+{
+    gr_ptr * a;
+    gr_srcptr d;
+    slong row;
+    slong col;
+    slong rank;
+    slong n;
+    int * status;
+    gr_ctx_struct * ctx;
+}
+lu_work_t;
+
+/* eliminates entry (row + 1 + k, col) using the pivot row */
+static void
+lu_row_worker(slong k, lu_work_t * work)
+{
+    gr_ctx_struct * ctx = work->ctx;
+    gr_ptr * a = work->a;
+    slong j, col, n, sz;
+    gr_ptr e;
+    int status = GR_SUCCESS;
+
+    sz = ctx->sizeof_elem;
+    j = work->row + 1 + k;
+    col = work->col;
+    n = work->n;
+
+    GR_TMP_INIT(e, ctx);
+
+    status |= gr_mul(e, GR_ENTRY(a[j], col, sz), work->d, ctx);
+    status |= gr_neg(e, e, ctx);
+
+    if (n - col - 1 > 0)
+        status |= _gr_vec_addmul_scalar(GR_ENTRY(a[j], col + 1, sz), GR_ENTRY(a[work->row], col + 1, sz), n - col - 1, e, ctx);
+
+    status |= gr_zero(GR_ENTRY(a[j], col, sz), ctx);
+    status |= gr_neg(GR_ENTRY(a[j], work->rank - 1, sz), e, ctx);
+
+    GR_TMP_CLEAR(e, ctx);
+
+    work->status[k] = status;
+}
+
 static void
 _gr_mat_swap_rows(gr_mat_t mat, slong * perm, slong r, slong s, gr_ctx_t ctx)
 {
@@ -40,7 +85,7 @@ gr_mat_lu_classical(slong * res_rank, slong * P, gr_mat_t LU, const gr_mat_t A,
     gr_ptr * a;
     slong i, j, m, n, r, rank, row, col, sz;
     int status = GR_SUCCESS;
-    int pivot_status;
+    int pivot_status, threadsafe;
 
     if (gr_mat_is_empty(A, ctx) == T_TRUE)
     {
@@ -58,6 +103,9 @@ gr_mat_lu_classical(slong * res_rank, slong * P, gr_mat_t LU, const gr_mat_t A,
 
     a = LU->rows;
 
+    /* rows below the pivot can be eliminated in parallel */
+    threadsafe = (flint_get_num_threads() > 1 && gr_ctx_is_threadsafe(ctx) == T_TRUE);
+
     rank = row = col = 0;
     for (i = 0; i < m; i++)
         P[i] = i;
@@ -101,16 +149,39 @@ gr_mat_lu_classical(slong * res_rank, slong * P, gr_mat_t LU, const gr_mat_t A,
         if (status != GR_SUCCESS)
             break;
 
-        for (j = row + 1; j < m; j++)
+        if (threadsafe && m - row - 1 >= 2 && (double) (m - row - 1) * (n - col) >= 4096)
         {
-            status |= gr_mul(e, GR_ENTRY(a[j], col, sz), d, ctx);
-            status |= gr_neg(e, e, ctx);
+            lu_work_t work;
+
+            work.a = a;
+            work.d = d;
+            work.row = row;
+            work.col = col;
+            work.rank = rank;
+            work.n = n;
+            work.status = flint_malloc(sizeof(int) * (m - row - 1));
+            work.ctx = ctx;
+
+            flint_parallel_do((do_func_t) lu_row_worker, &work, m - row - 1, -1, FLINT_PARALLEL_UNIFORM);
 
-            if (n - col - 1 > 0)
-                status |= _gr_vec_addmul_scalar(GR_ENTRY(a[j], col + 1, sz), GR_ENTRY(a[row], col + 1, sz), n - col - 1, e, ctx);
+            for (j = 0; j < m - row - 1; j++)
+                status |= work.status[j];
 
-            status |= gr_zero(GR_ENTRY(a[j], col, sz), ctx);
-            status |= gr_neg(GR_ENTRY(a[j], rank - 1, sz), e, ctx);
+            flint_free(work.status);
+        }
+        else
+        {
+            for (j = row + 1; j < m; j++)
+            {
+                status |= gr_mul(e, GR_ENTRY(a[j], col, sz), d, ctx);
+                status |= gr_neg(e, e, ctx);
+
+                if (n - col - 1 > 0)
+                    status |= _gr_vec_addmul_scalar(GR_ENTRY(a[j], col + 1, sz), GR_ENTRY(a[row], col + 1, sz), n - col - 1, e, ctx);
+
+                status |= gr_zero(GR_ENTRY(a[j], col, sz), ctx);
+                status |= gr_neg(GR_ENTRY(a[j], rank - 1, sz), e, ctx);
+            }
         }
 
         row++;
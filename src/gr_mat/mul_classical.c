@@ -10,9 +10,54 @@
 */
 
 #include <stdint.h>
+#include "thread_support.h"
 #include "gr_vec.h"
 #include "gr_mat.h"
 
+typedef struct
+{
+    gr_mat_struct * C;
+    const gr_mat_struct * A;
+    gr_srcptr BT;
+    int * status;
+    gr_ctx_struct * ctx;
+}
+mul_work_t;
+
+static void
+mul_row_worker(slong i, mul_work_t * work)
+{
+    slong j, br, bc, sz;
+    int status = GR_SUCCESS;
+    gr_ctx_struct * ctx = work->ctx;
+
+    sz = ctx->sizeof_elem;
+    br = work->A->c;
+    bc = work->C->c;
+
+    for (j = 0; j < bc; j++)
+    {
+        status |= _gr_vec_dot(GR_MAT_ENTRY(work->C, i, j, sz), NULL, 0,
+            GR_MAT_ENTRY(work->A, i, 0, sz), GR_ENTRY(work->BT, j * br, sz), br, ctx);
+    }
+
+    work->status[i] = status;
+}
+
+/* the rows of the output are independent, so we can distribute them
+   over threads provided that the ring supports concurrent use */
+static int
+mul_thread_limit(slong ar, slong br, slong bc, gr_ctx_t ctx)
+{
+    if (ar < 2 || (double) ar * br * bc < 8192)
+        return 1;
+
+    if (gr_ctx_is_threadsafe(ctx) != T_TRUE)
+        return 1;
+
+    return -1;
+}
+
 int
 gr_mat_mul_classical(gr_mat_t C, const gr_mat_t A, const gr_mat_t B, gr_ctx_t ctx)
 {
@@ -62,6 +107,7 @@ gr_mat_mul_classical(gr_mat_t C, const gr_mat_t A, const gr_mat_t B, gr_ctx_t ct
     {
         gr_ptr tmp;
         gr_method_void_unary_op set_shallow = GR_VOID_UNARY_OP(ctx, SET_SHALLOW);
+        int thread_limit;
         TMP_INIT;
 
         TMP_START;
@@ -99,14 +145,36 @@ gr_mat_mul_classical(gr_mat_t C, const gr_mat_t A, const gr_mat_t B, gr_ctx_t ct
             }
         }
 
-        for (i = 0; i < ar; i++)
+        thread_limit = mul_thread_limit(ar, br, bc, ctx);
+
+        if (thread_limit == 1)
         {
-            for (j = 0; j < bc; j++)
+            for (i = 0; i < ar; i++)
             {
-                status |= _gr_vec_dot(GR_MAT_ENTRY(C, i, j, sz), NULL, 0,
-                    GR_MAT_ENTRY(A, i, 0, sz), GR_ENTRY(tmp, j * br, sz), br, ctx);
+                for (j = 0; j < bc; j++)
+                {
+                    status |= _gr_vec_dot(GR_MAT_ENTRY(C, i, j, sz), NULL, 0,
+                        GR_MAT_ENTRY(A, i, 0, sz), GR_ENTRY(tmp, j * br, sz), br, ctx);
+                }
             }
         }
+        else
+        {
+            mul_work_t work;
+
+            work.C = C;
+            work.A = A;
+            work.BT = tmp;
+            work.status = flint_malloc(sizeof(int) * ar);
+            work.ctx = ctx;
+
+            flint_parallel_do((do_func_t) mul_row_worker, &work, ar, thread_limit, FLINT_PARALLEL_UNIFORM);
+
+            for (i = 0; i < ar; i++)
+                status |= work.status[i];
+
+            flint_free(work.status);
+        }
 
         TMP_END;
     }
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "fmpz.h"
 #include "gr_mat.h"
 #include "gr_poly.h"
 
@@ -77,8 +78,64 @@ int main(void)
         gr_ctx_clear(ctx);
     }
 
+    /* large matrices over finite fields, exercising the threaded code
+       and the algorithm selection in gr_mat_charpoly */
+    for (iter = 0; iter < 10 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        int status = GR_SUCCESS;
+        slong n;
+        gr_ctx_t ctx;
+        gr_mat_t A;
+        gr_poly_t f, g, h;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 2))
+        {
+            gr_ctx_init_nmod8(ctx, 251);
+        }
+        else
+        {
+            fmpz_t p;
+            fmpz_init_set_ui(p, 3);
+            gr_ctx_init_fq_zech(ctx, p, 2, "a");
+            fmpz_clear(p);
+        }
+
+        n = 40 + n_randint(state, 40);
+
+        gr_mat_init(A, n, n, ctx);
+        gr_poly_init(f, ctx);
+        gr_poly_init(g, ctx);
+        gr_poly_init(h, ctx);
+
+        status |= gr_mat_randtest(A, state, ctx);
+
+        status |= gr_mat_charpoly_berkowitz(f, A, ctx);
+        status |= gr_mat_charpoly_gauss(g, A, ctx);
+        status |= gr_mat_charpoly(h, A, ctx);
+
+        if (status != GR_SUCCESS || gr_poly_equal(f, g, ctx) != T_TRUE || gr_poly_equal(f, h, ctx) != T_TRUE)
+        {
+            flint_printf("FAIL (large)\n\n");
+            gr_ctx_println(ctx);
+            flint_printf("n = %wd, status = %d\n", n, status);
+            flint_printf("f = "); gr_poly_print(f, ctx); flint_printf("\n");
+            flint_printf("g = "); gr_poly_print(g, ctx); flint_printf("\n");
+            flint_printf("h = "); gr_poly_print(h, ctx); flint_printf("\n");
+            flint_abort();
+        }
+
+        gr_mat_clear(A, ctx);
+        gr_poly_clear(f, ctx);
+        gr_poly_clear(g, ctx);
+        gr_poly_clear(h, ctx);
+
+        gr_ctx_clear(ctx);
+    }
+
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf(" [%wd success, %wd domain, %wd unable] PASS\n", count_success, count_domain, count_unable);
     return 0;
 }
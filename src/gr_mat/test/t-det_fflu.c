@@ -9,6 +9,9 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
 #include "gr_mat.h"
 #include "gr_poly.h"
 
@@ -91,8 +94,51 @@ int main(void)
         gr_ctx_clear(ctx);
     }
 
+    /* large integer matrices, exercising the threaded code */
+    for (iter = 0; iter < 10 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        slong n;
+        gr_ctx_t ctx;
+        gr_mat_t A;
+        fmpz_mat_t Z;
+        fmpz_t d1, d2;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        gr_ctx_init_fmpz(ctx);
+
+        n = 30 + n_randint(state, 30);
+
+        gr_mat_init(A, n, n, ctx);
+        fmpz_mat_init(Z, n, n);
+        fmpz_init(d1);
+        fmpz_init(d2);
+
+        fmpz_mat_randtest(Z, state, 1 + n_randint(state, 20));
+        GR_MUST_SUCCEED(gr_mat_set_fmpz_mat(A, Z, ctx));
+
+        GR_MUST_SUCCEED(gr_mat_det_fflu(d1, A, ctx));
+        fmpz_mat_det(d2, Z);
+
+        if (!fmpz_equal(d1, d2))
+        {
+            flint_printf("FAIL (large)\n\n");
+            flint_printf("n = %wd\n", n);
+            flint_printf("d1 = "); fmpz_print(d1); flint_printf("\n");
+            flint_printf("d2 = "); fmpz_print(d2); flint_printf("\n");
+            flint_abort();
+        }
+
+        gr_mat_clear(A, ctx);
+        fmpz_mat_clear(Z);
+        fmpz_clear(d1);
+        fmpz_clear(d2);
+
+        gr_ctx_clear(ctx);
+    }
+
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf(" [%wd success, %wd domain, %wd unable] PASS\n", count_success, count_domain, count_unable);
     return 0;
 }
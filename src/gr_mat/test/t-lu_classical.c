@@ -1,4 +1,6 @@
 
+#include "ulong_extras.h"
+#include "fmpz.h"
 #include "fmpz_mat.h"
 #include "gr_mat.h"
 
@@ -267,8 +269,52 @@ int main(void)
         gr_ctx_clear(ctx);
     }
 
+    /* large matrices over a prime field, exercising the threaded code */
+    for (iter = 0; iter < 10 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        gr_ctx_t ctx;
+        gr_mat_t A, LU;
+        slong m, n, r, rank;
+        slong * P;
+        int status;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        gr_ctx_init_nmod(ctx, n_randprime(state, 2 + n_randint(state, FLINT_BITS - 1), 1));
+
+        m = 60 + n_randint(state, 40);
+        n = 60 + n_randint(state, 40);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gr_mat_init(A, m, n, ctx);
+        gr_mat_init(LU, m, n, ctx);
+
+        _gr_mat_randrank(A, state, r, 5, ctx);
+        GR_MUST_SUCCEED(gr_mat_randops(A, state, 2 * m * n, ctx));
+
+        P = flint_malloc(sizeof(slong) * m);
+
+        status = gr_mat_lu_classical(&rank, P, LU, A, 0, ctx);
+
+        if (status != GR_SUCCESS || rank > r)
+        {
+            flint_printf("FAIL (large):\n");
+            gr_ctx_println(ctx);
+            flint_printf("m = %wd, n = %wd, r = %wd, rank = %wd\n", m, n, r, rank);
+            flint_abort();
+        }
+
+        check(P, LU, A, rank, ctx);
+
+        gr_mat_clear(A, ctx);
+        gr_mat_clear(LU, ctx);
+        flint_free(P);
+
+        gr_ctx_clear(ctx);
+    }
+
     flint_randclear(state);
-    flint_cleanup();
+    flint_cleanup_master();
     flint_printf("PASS\n");
     return 0;
 }
@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "fmpz_mat.h"
+#include "gr_mat.h"
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mul_classical...");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        gr_ctx_t ctx;
+        gr_mat_t A, B, C, D;
+        fmpz_mat_t ZA, ZB, ZD;
+        slong a, b, c;
+        int status = GR_SUCCESS;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        gr_ctx_init_fmpz(ctx);
+
+        if (n_randint(state, 4) == 0)
+        {
+            a = n_randint(state, 50);
+            b = n_randint(state, 50);
+            c = n_randint(state, 50);
+        }
+        else
+        {
+            a = n_randint(state, 8);
+            b = n_randint(state, 8);
+            c = n_randint(state, 8);
+        }
+
+        gr_mat_init(A, a, b, ctx);
+        gr_mat_init(B, b, c, ctx);
+        gr_mat_init(C, a, c, ctx);
+        gr_mat_init(D, a, c, ctx);
+        fmpz_mat_init(ZA, a, b);
+        fmpz_mat_init(ZB, b, c);
+        fmpz_mat_init(ZD, a, c);
+
+        fmpz_mat_randtest(ZA, state, 1 + n_randint(state, 100));
+        fmpz_mat_randtest(ZB, state, 1 + n_randint(state, 100));
+        fmpz_mat_mul(ZD, ZA, ZB);
+
+        status |= gr_mat_set_fmpz_mat(A, ZA, ctx);
+        status |= gr_mat_set_fmpz_mat(B, ZB, ctx);
+        status |= gr_mat_set_fmpz_mat(D, ZD, ctx);
+        status |= gr_mat_randtest(C, state, ctx);
+
+        if (b == c && n_randint(state, 2))
+        {
+            status |= gr_mat_set(C, A, ctx);
+            status |= gr_mat_mul_classical(C, C, B, ctx);
+        }
+        else if (a == b && n_randint(state, 2))
+        {
+            status |= gr_mat_set(C, B, ctx);
+            status |= gr_mat_mul_classical(C, A, C, ctx);
+        }
+        else
+        {
+            status |= gr_mat_mul_classical(C, A, B, ctx);
+        }
+
+        if (status != GR_SUCCESS || gr_mat_equal(C, D, ctx) != T_TRUE)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = %wd, b = %wd, c = %wd, status = %d\n", a, b, c, status);
+            flint_printf("C:\n"); gr_mat_print(C, ctx); flint_printf("\n\n");
+            flint_printf("D:\n"); gr_mat_print(D, ctx); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        gr_mat_clear(A, ctx);
+        gr_mat_clear(B, ctx);
+        gr_mat_clear(C, ctx);
+        gr_mat_clear(D, ctx);
+        fmpz_mat_clear(ZA);
+        fmpz_mat_clear(ZB);
+        fmpz_mat_clear(ZD);
+
+        gr_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gr_vec.h"
+#include "gr_poly.h"
+
+/* Assumes len1 >= len2 >= 1 and that res is not aliased with the input.
+   Subproducts go through _gr_poly_mul so that the ring's own
+   algorithm selection applies recursively. */
+static int
+_gr_poly_mul_karatsuba_main(gr_ptr res, gr_srcptr poly1, slong len1,
+    gr_srcptr poly2, slong len2, gr_ctx_t ctx)
+{
+    slong m, sz = ctx->sizeof_elem;
+    gr_ptr t, u, v;
+    int status = GR_SUCCESS;
+
+    if (len2 == 1)
+        return _gr_vec_mul_scalar(res, poly1, len1, poly2, ctx);
+
+    m = (len1 + 1) / 2;
+
+    if (len2 <= m)
+    {
+        /* unbalanced: (A0 + x^m A1) B = A0 B + x^m A1 B */
+        GR_TMP_INIT_VEC(t, len1 - m + len2 - 1, ctx);
+
+        status |= _gr_poly_mul(res, poly1, m, poly2, len2, ctx);
+        status |= _gr_vec_zero(GR_ENTRY(res, m + len2 - 1, sz), len1 - m, ctx);
+        status |= _gr_poly_mul(t, GR_ENTRY(poly1, m, sz), len1 - m, poly2, len2, ctx);
+        status |= _gr_vec_add(GR_ENTRY(res, m, sz), GR_ENTRY(res, m, sz), t, len1 - m + len2 - 1, ctx);
+
+        GR_TMP_CLEAR_VEC(t, len1 - m + len2 - 1, ctx);
+    }
+    else
+    {
+        /* (A0 + x^m A1) (B0 + x^m B1) with
+           A0 B1 + A1 B0 = (A0 + A1) (B0 + B1) - A0 B0 - A1 B1 */
+        slong len1h = len1 - m, len2h = len2 - m;
+
+        GR_TMP_INIT_VEC(t, 2 * m + 2 * m - 1, ctx);
+        u = GR_ENTRY(t, m, sz);
+        v = GR_ENTRY(u, m, sz);
+
+        status |= _gr_poly_mul(res, poly1, m, poly2, m, ctx);
+        status |= gr_zero(GR_ENTRY(res, 2 * m - 1, sz), ctx);
+        status |= _gr_poly_mul(GR_ENTRY(res, 2 * m, sz), GR_ENTRY(poly1, m, sz), len1h, GR_ENTRY(poly2, m, sz), len2h, ctx);
+
+        status |= _gr_poly_add(t, poly1, m, GR_ENTRY(poly1, m, sz), len1h, ctx);
+        status |= _gr_poly_add(u, poly2, m, GR_ENTRY(poly2, m, sz), len2h, ctx);
+        status |= _gr_poly_mul(v, t, m, u, m, ctx);
+
+        status |= _gr_vec_sub(v, v, res, 2 * m - 1, ctx);
+        status |= _gr_poly_sub(v, v, 2 * m - 1, GR_ENTRY(res, 2 * m, sz), len1h + len2h - 1, ctx);
+        status |= _gr_vec_add(GR_ENTRY(res, m, sz), GR_ENTRY(res, m, sz), v, FLINT_MIN(2 * m - 1, len1 + len2 - 1 - m), ctx);
+
+        GR_TMP_CLEAR_VEC(t, 2 * m + 2 * m - 1, ctx);
+    }
+
+    return status;
+}
+
+int
+_gr_poly_mul_karatsuba(gr_ptr res, gr_srcptr poly1, slong len1,
+    gr_srcptr poly2, slong len2, gr_ctx_t ctx)
+{
+    if (len1 < len2)
+        return _gr_poly_mul_karatsuba_main(res, poly2, len2, poly1, len1, ctx);
+    else
+        return _gr_poly_mul_karatsuba_main(res, poly1, len1, poly2, len2, ctx);
+}
+
+int
+gr_poly_mul_karatsuba(gr_poly_t res, const gr_poly_t poly1,
+                                            const gr_poly_t poly2, gr_ctx_t ctx)
+{
+    slong len_out;
+    int status;
+
+    if (poly1->length == 0 || poly2->length == 0)
+        return gr_poly_zero(res, ctx);
+
+    len_out = poly1->length + poly2->length - 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        gr_poly_t t;
+        gr_poly_init2(t, len_out, ctx);
+        status = _gr_poly_mul_karatsuba(t->coeffs, poly1->coeffs, poly1->length, poly2->coeffs, poly2->length, ctx);
+        gr_poly_swap(res, t, ctx);
+        gr_poly_clear(t, ctx);
+    }
+    else
+    {
+        gr_poly_fit_length(res, len_out, ctx);
+        status = _gr_poly_mul_karatsuba(res->coeffs, poly1->coeffs, poly1->length, poly2->coeffs, poly2->length, ctx);
+    }
+
+    _gr_poly_set_length(res, len_out, ctx);
+    _gr_poly_normalise(res, ctx);
+    return status;
+}
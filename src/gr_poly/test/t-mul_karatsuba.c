@@ -0,0 +1,165 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "fmpq_poly.h"
+#include "gr_poly.h"
+
+static int
+mullow_classical(gr_poly_t res, const gr_poly_t A, const gr_poly_t B, slong n, gr_ctx_t ctx)
+{
+    int status;
+
+    n = FLINT_MIN(n, A->length + B->length - 1);
+
+    if (A->length == 0 || B->length == 0 || n <= 0)
+        return gr_poly_zero(res, ctx);
+
+    gr_poly_fit_length(res, n, ctx);
+    status = _gr_poly_mullow_generic(res->coeffs, A->coeffs, A->length, B->coeffs, B->length, n, ctx);
+    _gr_poly_set_length(res, n, ctx);
+    _gr_poly_normalise(res, ctx);
+    return status;
+}
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mul_karatsuba....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        int status;
+        gr_ctx_t ctx;
+        gr_poly_t A, B, C, D;
+        slong len1, len2, n;
+
+        /* rings with their own mullow methods which switch between
+           classical and fast multiplication */
+        switch (n_randint(state, 5))
+        {
+            case 0:
+                gr_ctx_init_fmpzi(ctx);
+                break;
+            case 1:
+                gr_ctx_init_nmod8(ctx, 1 + n_randint(state, 255));
+                break;
+            case 2:
+                gr_ctx_init_nmod32(ctx, 1 + n_randint(state, UWORD(4294967295)));
+                break;
+            case 3:
+                {
+                    fmpq_poly_t f;
+                    fmpq_poly_init(f);
+                    do {
+                        fmpq_poly_randtest_not_zero(f, state, 2 + n_randint(state, 5), 1 + n_randint(state, 20));
+                    } while (fmpq_poly_degree(f) < 1);
+                    gr_ctx_init_nf(ctx, f);
+                    fmpq_poly_clear(f);
+                }
+                break;
+            default:
+                gr_ctx_init_random(ctx, state);
+        }
+
+        gr_poly_init(A, ctx);
+        gr_poly_init(B, ctx);
+        gr_poly_init(C, ctx);
+        gr_poly_init(D, ctx);
+
+        if (gr_ctx_is_exact(ctx) != T_TRUE || n_randint(state, 2))
+        {
+            len1 = n_randint(state, 8);
+            len2 = n_randint(state, 8);
+        }
+        else
+        {
+            len1 = n_randint(state, 40);
+            len2 = n_randint(state, 40);
+        }
+
+        status = GR_SUCCESS;
+        status |= gr_poly_randtest(A, state, len1, ctx);
+        status |= gr_poly_randtest(B, state, len2, ctx);
+        status |= gr_poly_randtest(C, state, 1 + n_randint(state, 8), ctx);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                status |= gr_poly_set(C, A, ctx);
+                status |= gr_poly_mul_karatsuba(C, C, B, ctx);
+                break;
+            case 1:
+                status |= gr_poly_set(C, B, ctx);
+                status |= gr_poly_mul_karatsuba(C, A, C, ctx);
+                break;
+            default:
+                status |= gr_poly_mul_karatsuba(C, A, B, ctx);
+        }
+
+        status |= mullow_classical(D, A, B, len1 + len2, ctx);
+
+        if (status == GR_SUCCESS && gr_ctx_is_exact(ctx) == T_TRUE && gr_poly_equal(C, D, ctx) == T_FALSE)
+        {
+            flint_printf("FAIL (karatsuba)\n\n");
+            gr_ctx_println(ctx);
+            flint_printf("A = "); gr_poly_print(A, ctx); flint_printf("\n");
+            flint_printf("B = "); gr_poly_print(B, ctx); flint_printf("\n");
+            flint_printf("C = "); gr_poly_print(C, ctx); flint_printf("\n");
+            flint_printf("D = "); gr_poly_print(D, ctx); flint_printf("\n");
+            flint_abort();
+        }
+
+        /* algorithm selection in mullow, including squaring */
+        n = n_randint(state, len1 + len2 + 2);
+
+        if (n_randint(state, 4) == 0)
+        {
+            status |= gr_poly_set(B, A, ctx);
+            status |= gr_poly_mullow(C, A, A, n, ctx);
+        }
+        else
+        {
+            status |= gr_poly_mullow(C, A, B, n, ctx);
+        }
+
+        status |= mullow_classical(D, A, B, n, ctx);
+
+        if (status == GR_SUCCESS && gr_ctx_is_exact(ctx) == T_TRUE && gr_poly_equal(C, D, ctx) == T_FALSE)
+        {
+            flint_printf("FAIL (mullow)\n\n");
+            gr_ctx_println(ctx);
+            flint_printf("n = %wd\n", n);
+            flint_printf("A = "); gr_poly_print(A, ctx); flint_printf("\n");
+            flint_printf("B = "); gr_poly_print(B, ctx); flint_printf("\n");
+            flint_printf("C = "); gr_poly_print(C, ctx); flint_printf("\n");
+            flint_printf("D = "); gr_poly_print(D, ctx); flint_printf("\n");
+            flint_abort();
+        }
+
+        gr_poly_clear(A, ctx);
+        gr_poly_clear(B, ctx);
+        gr_poly_clear(C, ctx);
+        gr_poly_clear(D, ctx);
+
+        gr_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -187,6 +187,15 @@ void _nmod_poly_mul_mid_default_mpn_ctx(mp_ptr res, slong zl, slong zh, mp_srcpt
 #endif
 
 
+#if 0
+#define INFO "mullow (classical -> karatsuba)"
+#define SETUP random_input(A, state, len, ctx); \
+              random_input(B, state, len, ctx); \
+              gr_poly_fit_length(C, 2 * len - 1, ctx);
+#define CASE_A GR_IGNORE(_gr_poly_mullow_generic(C->coeffs, A->coeffs, len, B->coeffs, len, 2 * len - 1, ctx));
+#define CASE_B GR_IGNORE(_gr_poly_mul_karatsuba(C->coeffs, A->coeffs, len, B->coeffs, len, ctx));
+#endif
+
 void random_input(gr_poly_t A, flint_rand_t state, slong len, gr_ctx_t ctx)
 {
     gr_ptr t;
@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#include "nmod_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Compressed sparse row storage: the nonzero entries of row i are
+    entries[k] in column cols[k] for row_start[i] <= k < row_start[i + 1],
+    with the columns of each row strictly increasing.
+*/
+typedef struct
+{
+    slong r;
+    slong c;
+    slong * row_start;
+    slong * cols;
+    mp_ptr entries;
+    slong alloc;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t A)
+{
+    return A->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t A)
+{
+    return A->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t A)
+{
+    return A->row_start[A->r];
+}
+
+/* Memory management */
+
+void nmod_sparse_mat_init(nmod_sparse_mat_t A, slong rows, slong cols, mp_limb_t n);
+
+void nmod_sparse_mat_clear(nmod_sparse_mat_t A);
+
+void nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t A, slong nnz);
+
+void nmod_sparse_mat_swap(nmod_sparse_mat_t A, nmod_sparse_mat_t B);
+
+void nmod_sparse_mat_zero(nmod_sparse_mat_t A);
+
+void nmod_sparse_mat_set(nmod_sparse_mat_t A, const nmod_sparse_mat_t B);
+
+/* Conversions */
+
+void nmod_sparse_mat_set_entries(nmod_sparse_mat_t A, const slong * rows,
+                      const slong * cols, mp_srcptr entries, slong len);
+
+void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t A, const nmod_mat_t B);
+
+void nmod_sparse_mat_get_nmod_mat(nmod_mat_t A, const nmod_sparse_mat_t B);
+
+mp_limb_t nmod_sparse_mat_get_entry(const nmod_sparse_mat_t A, slong i, slong j);
+
+/* Basic properties and operations */
+
+int nmod_sparse_mat_equal(const nmod_sparse_mat_t A, const nmod_sparse_mat_t B);
+
+void nmod_sparse_mat_randtest(nmod_sparse_mat_t A, flint_rand_t state,
+                                          slong min_nnz, slong max_nnz);
+
+void nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A);
+
+/* Multiplication */
+
+void nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x);
+
+void nmod_sparse_mat_mul_nmod_mat(nmod_mat_t C, const nmod_sparse_mat_t A,
+                                                          const nmod_mat_t B);
+
+void nmod_sparse_mat_poly_mul_nmod_mat(nmod_mat_t Y, const nmod_poly_t f,
+                            const nmod_sparse_mat_t A, const nmod_mat_t B);
+
+/* Solving */
+
+void nmod_sparse_mat_minpoly_wiedemann(nmod_poly_t f,
+                            const nmod_sparse_mat_t A, flint_rand_t state);
+
+int nmod_sparse_mat_solve_wiedemann(nmod_mat_t X, const nmod_sparse_mat_t A,
+                                  const nmod_mat_t B, flint_rand_t state);
+
+int nmod_sparse_mat_solve_lanczos(nmod_mat_t X, const nmod_sparse_mat_t A,
+                                  const nmod_mat_t B, flint_rand_t state);
+
+/* Rank and nullspace */
+
+slong _nmod_sparse_mat_echelon(nmod_sparse_mat_t R, slong * perm,
+                                            const nmod_sparse_mat_t A);
+
+slong nmod_sparse_mat_rank(const nmod_sparse_mat_t A);
+
+slong nmod_sparse_mat_nullspace(nmod_sparse_mat_t X, const nmod_sparse_mat_t A);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
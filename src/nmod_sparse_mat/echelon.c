@@ -0,0 +1,249 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include "nmod.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong key;
+    slong idx;
+}
+_key_t;
+
+static int
+_key_cmp(const void * a, const void * b)
+{
+    slong x = ((const _key_t *) a)->key;
+    slong y = ((const _key_t *) b)->key;
+    slong u = ((const _key_t *) a)->idx;
+    slong v = ((const _key_t *) b)->idx;
+
+    if (x != y)
+        return (x > y) - (x < y);
+
+    return (u > v) - (u < v);
+}
+
+typedef struct
+{
+    slong * pos;
+    mp_ptr val;
+    slong len;
+}
+_row_t;
+
+/* dst = src - c * piv, where both rows are sorted by position */
+static slong
+_row_submul(slong * dpos, mp_ptr dval, const slong * spos, mp_srcptr sval,
+       slong slen, const _row_t * piv, mp_limb_t c, nmod_t mod)
+{
+    slong i, j, k;
+    mp_limb_t t;
+
+    i = j = k = 0;
+
+    while (i < slen && j < piv->len)
+    {
+        if (spos[i] < piv->pos[j])
+        {
+            dpos[k] = spos[i];
+            dval[k] = sval[i];
+            i++;
+            k++;
+        }
+        else if (spos[i] > piv->pos[j])
+        {
+            dpos[k] = piv->pos[j];
+            dval[k] = nmod_neg(nmod_mul(c, piv->val[j], mod), mod);
+            j++;
+            k++;
+        }
+        else
+        {
+            t = nmod_sub(sval[i], nmod_mul(c, piv->val[j], mod), mod);
+
+            if (t != 0)
+            {
+                dpos[k] = spos[i];
+                dval[k] = t;
+                k++;
+            }
+
+            i++;
+            j++;
+        }
+    }
+
+    for ( ; i < slen; i++, k++)
+    {
+        dpos[k] = spos[i];
+        dval[k] = sval[i];
+    }
+
+    for ( ; j < piv->len; j++, k++)
+    {
+        dpos[k] = piv->pos[j];
+        dval[k] = nmod_neg(nmod_mul(c, piv->val[j], mod), mod);
+    }
+
+    return k;
+}
+
+slong
+_nmod_sparse_mat_echelon(nmod_sparse_mat_t R, slong * perm,
+                                            const nmod_sparse_mat_t A)
+{
+    _key_t * keys;
+    _row_t * piv;
+    slong * inv, * pos[2];
+    mp_ptr val[2];
+    slong i, j, k, len, rank, nnz, alloc, cur;
+    mp_limb_t c;
+    nmod_t mod = A->mod;
+
+    /* order the columns by increasing number of entries */
+    keys = flint_malloc(sizeof(_key_t) * FLINT_MAX(FLINT_MAX(A->r, A->c), 1));
+    inv = flint_malloc(sizeof(slong) * FLINT_MAX(A->c, 1));
+
+    for (j = 0; j < A->c; j++)
+    {
+        keys[j].key = 0;
+        keys[j].idx = j;
+    }
+
+    for (k = 0; k < nmod_sparse_mat_nnz(A); k++)
+        keys[A->cols[k]].key++;
+
+    qsort(keys, A->c, sizeof(_key_t), _key_cmp);
+
+    for (j = 0; j < A->c; j++)
+    {
+        perm[j] = keys[j].idx;
+        inv[keys[j].idx] = j;
+    }
+
+    /* eliminate the shortest rows first */
+    for (i = 0; i < A->r; i++)
+    {
+        keys[i].key = A->row_start[i + 1] - A->row_start[i];
+        keys[i].idx = i;
+    }
+
+    qsort(keys, A->r, sizeof(_key_t), _key_cmp);
+
+    piv = flint_calloc(FLINT_MAX(A->c, 1), sizeof(_row_t));
+
+    alloc = FLINT_MAX(A->c, 1);
+    pos[0] = flint_malloc(sizeof(slong) * alloc);
+    pos[1] = flint_malloc(sizeof(slong) * alloc);
+    val[0] = flint_malloc(sizeof(mp_limb_t) * alloc);
+    val[1] = flint_malloc(sizeof(mp_limb_t) * alloc);
+
+    rank = 0;
+
+    for (i = 0; i < A->r && rank < A->c; i++)
+    {
+        slong r = keys[i].idx;
+        _key_t * tmp;
+
+        len = A->row_start[r + 1] - A->row_start[r];
+
+        if (len == 0)
+            continue;
+
+        /* the row in pivot positions, sorted */
+        tmp = flint_malloc(sizeof(_key_t) * len);
+        for (k = 0; k < len; k++)
+        {
+            tmp[k].key = inv[A->cols[A->row_start[r] + k]];
+            tmp[k].idx = k;
+        }
+        qsort(tmp, len, sizeof(_key_t), _key_cmp);
+        for (k = 0; k < len; k++)
+        {
+            pos[0][k] = tmp[k].key;
+            val[0][k] = A->entries[A->row_start[r] + tmp[k].idx];
+        }
+        flint_free(tmp);
+
+        cur = 0;
+
+        /* reduce the leading entry until it is not a pivot position */
+        while (len != 0 && piv[pos[cur][0]].len != 0)
+        {
+            c = val[cur][0];
+            len = _row_submul(pos[1 - cur], val[1 - cur], pos[cur], val[cur],
+                              len, piv + pos[cur][0], c, mod);
+            cur = 1 - cur;
+        }
+
+        if (len != 0)
+        {
+            _row_t * p = piv + pos[cur][0];
+
+            c = nmod_inv(val[cur][0], mod);
+
+            p->len = len;
+            p->pos = flint_malloc(sizeof(slong) * len);
+            p->val = flint_malloc(sizeof(mp_limb_t) * len);
+
+            for (k = 0; k < len; k++)
+            {
+                p->pos[k] = pos[cur][k];
+                p->val[k] = nmod_mul(val[cur][k], c, mod);
+            }
+
+            rank++;
+        }
+    }
+
+    /* the pivot rows in order of their leading positions */
+    nnz = 0;
+    for (j = 0; j < A->c; j++)
+        nnz += piv[j].len;
+
+    nmod_sparse_mat_clear(R);
+    nmod_sparse_mat_init(R, rank, A->c, mod.n);
+    nmod_sparse_mat_fit_nnz(R, nnz);
+
+    for (i = j = nnz = 0; j < A->c; j++)
+    {
+        if (piv[j].len == 0)
+            continue;
+
+        R->row_start[i] = nnz;
+
+        for (k = 0; k < piv[j].len; k++, nnz++)
+        {
+            R->cols[nnz] = piv[j].pos[k];
+            R->entries[nnz] = piv[j].val[k];
+        }
+
+        flint_free(piv[j].pos);
+        flint_free(piv[j].val);
+        i++;
+    }
+
+    R->row_start[rank] = nnz;
+
+    flint_free(keys);
+    flint_free(inv);
+    flint_free(piv);
+    flint_free(pos[0]);
+    flint_free(pos[1]);
+    flint_free(val[0]);
+    flint_free(val[1]);
+
+    return rank;
+}
@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+mp_limb_t
+nmod_sparse_mat_get_entry(const nmod_sparse_mat_t A, slong i, slong j)
+{
+    slong lo, hi, mid;
+
+    /* binary search in row i */
+    lo = A->row_start[i];
+    hi = A->row_start[i + 1];
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+
+        if (A->cols[mid] < j)
+            lo = mid + 1;
+        else if (A->cols[mid] > j)
+            hi = mid;
+        else
+            return A->entries[mid];
+    }
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_init(nmod_sparse_mat_t A, slong rows, slong cols, mp_limb_t n)
+{
+    A->r = rows;
+    A->c = cols;
+    A->row_start = flint_calloc(rows + 1, sizeof(slong));
+    A->cols = NULL;
+    A->entries = NULL;
+    A->alloc = 0;
+    nmod_init(&A->mod, n);
+}
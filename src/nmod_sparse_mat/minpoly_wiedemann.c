@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_sparse_mat.h"
+
+/* number of extra terms after which the generator is taken as final */
+#define WIEDEMANN_EARLY_ABORT 20
+
+#define WIEDEMANN_BATCH 16
+
+void
+nmod_sparse_mat_minpoly_wiedemann(nmod_poly_t f,
+                            const nmod_sparse_mat_t A, flint_rand_t state)
+{
+    nmod_berlekamp_massey_t BM;
+    mp_ptr u, v, w;
+    slong n, i, j, deg;
+    int nlimbs;
+
+    n = A->r;
+
+    if (A->c != n)
+    {
+        flint_printf("Exception (nmod_sparse_mat_minpoly_wiedemann). Non-square matrix.\n");
+        flint_abort();
+    }
+
+    if (n == 0)
+    {
+        nmod_poly_one(f);
+        return;
+    }
+
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+
+    /* uniformly random projections */
+    for (i = 0; i < n; i++)
+    {
+        u[i] = n_randint(state, A->mod.n);
+        v[i] = n_randint(state, A->mod.n);
+    }
+
+    nmod_berlekamp_massey_init(BM, A->mod.n);
+    nlimbs = _nmod_vec_dot_bound_limbs(n, A->mod);
+
+    /* the sequence u^T A^j v has the same generator as the Krylov space
+       of v with high probability, and needs at most 2n terms */
+    for (j = 0; j < 2 * n; )
+    {
+        for (i = 0; i < WIEDEMANN_BATCH && j < 2 * n; i++, j++)
+        {
+            nmod_berlekamp_massey_add_point(BM,
+                                      _nmod_vec_dot(u, v, n, A->mod, nlimbs));
+            nmod_sparse_mat_mul_vec(w, A, v);
+            MP_PTR_SWAP(v, w);
+        }
+
+        nmod_berlekamp_massey_reduce(BM);
+        deg = nmod_poly_degree(nmod_berlekamp_massey_V_poly(BM));
+
+        if (j >= 2 * deg + WIEDEMANN_EARLY_ABORT)
+            break;
+    }
+
+    nmod_poly_make_monic(f, nmod_berlekamp_massey_V_poly(BM));
+
+    nmod_berlekamp_massey_clear(BM);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+}
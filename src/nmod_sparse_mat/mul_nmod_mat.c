@@ -0,0 +1,110 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "nmod.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+#define NMOD_SPARSE_MAT_MUL_BLOCK 4096
+
+typedef struct
+{
+    nmod_mat_struct * C;
+    const nmod_sparse_mat_struct * A;
+    const nmod_mat_struct * B;
+    slong block;
+}
+mul_mat_arg_t;
+
+static void
+_nmod_sparse_mat_mul_nmod_mat_rows(nmod_mat_t C, const nmod_sparse_mat_t A,
+                                  const nmod_mat_t B, slong start, slong stop)
+{
+    mp_ptr acc, b;
+    slong i, j, k, n = B->c;
+    mp_limb_t a, hi, lo;
+
+    /* three-limb accumulators for each column, reduced once per row */
+    acc = flint_malloc(sizeof(mp_limb_t) * 3 * n);
+
+    for (i = start; i < stop; i++)
+    {
+        for (j = 0; j < 3 * n; j++)
+            acc[j] = 0;
+
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+        {
+            a = A->entries[k];
+            b = B->rows[A->cols[k]];
+
+            for (j = 0; j < n; j++)
+            {
+                umul_ppmm(hi, lo, a, b[j]);
+                add_sssaaaaaa(acc[3 * j + 2], acc[3 * j + 1], acc[3 * j],
+                              acc[3 * j + 2], acc[3 * j + 1], acc[3 * j], 0, hi, lo);
+            }
+        }
+
+        for (j = 0; j < n; j++)
+            NMOD_RED3(C->rows[i][j], acc[3 * j + 2], acc[3 * j + 1], acc[3 * j], A->mod);
+    }
+
+    flint_free(acc);
+}
+
+static void
+_mul_mat_worker(slong i, mul_mat_arg_t * arg)
+{
+    slong start = i * arg->block;
+    slong stop = FLINT_MIN(start + arg->block, arg->A->r);
+
+    _nmod_sparse_mat_mul_nmod_mat_rows(arg->C, arg->A, arg->B, start, stop);
+}
+
+void
+nmod_sparse_mat_mul_nmod_mat(nmod_mat_t C, const nmod_sparse_mat_t A,
+                                                          const nmod_mat_t B)
+{
+    mul_mat_arg_t arg;
+    slong work, num_blocks;
+
+    if (C == B)
+    {
+        nmod_mat_t T;
+        nmod_mat_init(T, C->r, C->c, C->mod.n);
+        nmod_sparse_mat_mul_nmod_mat(T, A, B);
+        nmod_mat_swap_entrywise(C, T);
+        nmod_mat_clear(T);
+        return;
+    }
+
+    if (B->c == 0)
+        return;
+
+    work = nmod_sparse_mat_nnz(A) * B->c;
+
+    if (work < NMOD_SPARSE_MAT_MUL_BLOCK || flint_get_num_threads() == 1)
+    {
+        _nmod_sparse_mat_mul_nmod_mat_rows(C, A, B, 0, A->r);
+        return;
+    }
+
+    num_blocks = work / NMOD_SPARSE_MAT_MUL_BLOCK;
+    arg.block = FLINT_MAX((A->r + num_blocks - 1) / num_blocks, 1);
+    num_blocks = (A->r + arg.block - 1) / arg.block;
+
+    arg.C = C;
+    arg.A = A;
+    arg.B = B;
+
+    flint_parallel_do((do_func_t) _mul_mat_worker, &arg, num_blocks, -1, FLINT_PARALLEL_STRIDED);
+}
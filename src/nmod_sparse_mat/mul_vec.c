@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "nmod.h"
+#include "nmod_sparse_mat.h"
+
+#define NMOD_SPARSE_MAT_MUL_BLOCK 4096
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr x;
+    slong block;
+}
+mul_vec_arg_t;
+
+static void
+_nmod_sparse_mat_mul_vec_rows(mp_ptr y, const nmod_sparse_mat_t A,
+                                          mp_srcptr x, slong start, slong stop)
+{
+    slong i, k;
+
+    for (i = start; i < stop; i++)
+    {
+        mp_limb_t hi, me, lo, phi, plo;
+
+        hi = me = lo = 0;
+
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+        {
+            umul_ppmm(phi, plo, A->entries[k], x[A->cols[k]]);
+            add_sssaaaaaa(hi, me, lo, hi, me, lo, 0, phi, plo);
+        }
+
+        NMOD_RED3(y[i], hi, me, lo, A->mod);
+    }
+}
+
+static void
+_mul_vec_worker(slong i, mul_vec_arg_t * arg)
+{
+    slong start = i * arg->block;
+    slong stop = FLINT_MIN(start + arg->block, arg->A->r);
+
+    _nmod_sparse_mat_mul_vec_rows(arg->y, arg->A, arg->x, start, stop);
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    mul_vec_arg_t arg;
+    slong nnz, num_blocks;
+
+    nnz = nmod_sparse_mat_nnz(A);
+
+    if (nnz < NMOD_SPARSE_MAT_MUL_BLOCK || flint_get_num_threads() == 1)
+    {
+        _nmod_sparse_mat_mul_vec_rows(y, A, x, 0, A->r);
+        return;
+    }
+
+    /* blocks of rows with about NMOD_SPARSE_MAT_MUL_BLOCK entries on average */
+    num_blocks = nnz / NMOD_SPARSE_MAT_MUL_BLOCK;
+    arg.block = (A->r + num_blocks - 1) / num_blocks;
+    num_blocks = (A->r + arg.block - 1) / arg.block;
+
+    arg.y = y;
+    arg.A = A;
+    arg.x = x;
+
+    flint_parallel_do((do_func_t) _mul_vec_worker, &arg, num_blocks, -1, FLINT_PARALLEL_STRIDED);
+}
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_nullspace(nmod_sparse_mat_t X, const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_t R;
+    slong * perm, * lead, * rows, * cols;
+    mp_ptr x, entries;
+    slong i, j, k, rank, nullity, len, alloc;
+    nmod_t mod = A->mod;
+
+    nmod_sparse_mat_init(R, 0, A->c, mod.n);
+    perm = flint_malloc(sizeof(slong) * FLINT_MAX(A->c, 1));
+
+    rank = _nmod_sparse_mat_echelon(R, perm, A);
+    nullity = A->c - rank;
+
+    /* lead[j] is the row of R with leading position j, or -1 */
+    lead = flint_malloc(sizeof(slong) * FLINT_MAX(A->c, 1));
+    for (j = 0; j < A->c; j++)
+        lead[j] = -1;
+    for (i = 0; i < rank; i++)
+        lead[R->cols[R->row_start[i]]] = i;
+
+    x = _nmod_vec_init(A->c);
+
+    alloc = FLINT_MAX(nullity, 1);
+    rows = flint_malloc(sizeof(slong) * alloc);
+    cols = flint_malloc(sizeof(slong) * alloc);
+    entries = flint_malloc(sizeof(mp_limb_t) * alloc);
+    len = 0;
+
+    /* one basis vector for each free position, by back substitution */
+    for (j = k = 0; j < A->c; j++)
+    {
+        if (lead[j] != -1)
+            continue;
+
+        _nmod_vec_zero(x, A->c);
+        x[j] = 1;
+
+        for (i = rank - 1; i >= 0; i--)
+        {
+            slong t, p = R->cols[R->row_start[i]];
+            mp_limb_t s = 0;
+
+            if (p > j)
+                continue;
+
+            for (t = R->row_start[i] + 1; t < R->row_start[i + 1]; t++)
+                s = nmod_addmul(s, R->entries[t], x[R->cols[t]], mod);
+
+            x[p] = nmod_neg(s, mod);
+        }
+
+        for (i = 0; i <= j; i++)
+        {
+            if (x[i] == 0)
+                continue;
+
+            if (len == alloc)
+            {
+                alloc = 2 * alloc;
+                rows = flint_realloc(rows, sizeof(slong) * alloc);
+                cols = flint_realloc(cols, sizeof(slong) * alloc);
+                entries = flint_realloc(entries, sizeof(mp_limb_t) * alloc);
+            }
+
+            rows[len] = k;
+            cols[len] = perm[i];
+            entries[len] = x[i];
+            len++;
+        }
+
+        k++;
+    }
+
+    nmod_sparse_mat_clear(X);
+    nmod_sparse_mat_init(X, nullity, A->c, mod.n);
+    nmod_sparse_mat_set_entries(X, rows, cols, entries, len);
+
+    nmod_sparse_mat_clear(R);
+    flint_free(perm);
+    flint_free(lead);
+    _nmod_vec_clear(x);
+    flint_free(rows);
+    flint_free(cols);
+    flint_free(entries);
+
+    return nullity;
+}
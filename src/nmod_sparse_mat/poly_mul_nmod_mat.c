@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_poly_mul_nmod_mat(nmod_mat_t Y, const nmod_poly_t f,
+                            const nmod_sparse_mat_t A, const nmod_mat_t B)
+{
+    nmod_mat_t T;
+    slong i;
+
+    if (Y == B)
+    {
+        nmod_mat_init(T, B->r, B->c, A->mod.n);
+        nmod_sparse_mat_poly_mul_nmod_mat(T, f, A, B);
+        nmod_mat_swap(Y, T);
+        nmod_mat_clear(T);
+        return;
+    }
+
+    nmod_mat_zero(Y);
+
+    if (f->length == 0)
+        return;
+
+    /* Horner's rule with sparse block products */
+    nmod_mat_init(T, B->r, B->c, A->mod.n);
+
+    for (i = f->length - 1; i >= 0; i--)
+    {
+        nmod_sparse_mat_mul_nmod_mat(T, A, Y);
+        nmod_mat_scalar_addmul_ui(Y, T, B, f->coeffs[i]);
+    }
+
+    nmod_mat_clear(T);
+}
@@ -0,0 +1,56 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t A, flint_rand_t state,
+                                              slong min_nnz, slong max_nnz)
+{
+    slong * rows, * cols;
+    mp_ptr vals;
+    slong i, j, k, len;
+
+    if (A->c == 0)
+    {
+        nmod_sparse_mat_zero(A);
+        return;
+    }
+
+    min_nnz = FLINT_MAX(min_nnz, 0);
+    max_nnz = FLINT_MAX(max_nnz, min_nnz);
+
+    rows = flint_malloc(sizeof(slong) * FLINT_MAX(A->r * max_nnz, 1));
+    cols = flint_malloc(sizeof(slong) * FLINT_MAX(A->r * max_nnz, 1));
+    vals = flint_malloc(sizeof(mp_limb_t) * FLINT_MAX(A->r * max_nnz, 1));
+
+    /* repeated columns are merged, so rows may end up shorter */
+    len = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        k = min_nnz + n_randint(state, max_nnz - min_nnz + 1);
+
+        for (j = 0; j < k; j++)
+        {
+            rows[len] = i;
+            cols[len] = n_randint(state, A->c);
+            vals[len] = (A->mod.n == 1) ? 0 : 1 + n_randint(state, A->mod.n - 1);
+            len++;
+        }
+    }
+
+    nmod_sparse_mat_set_entries(A, rows, cols, vals, len);
+
+    flint_free(rows);
+    flint_free(cols);
+    flint_free(vals);
+}
@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t A, const nmod_mat_t B)
+{
+    slong i, j, k, nnz;
+
+    nnz = 0;
+    for (i = 0; i < B->r; i++)
+        for (j = 0; j < B->c; j++)
+            nnz += (nmod_mat_entry(B, i, j) != 0);
+
+    if (A->r != B->r)
+    {
+        A->row_start = flint_realloc(A->row_start, sizeof(slong) * (B->r + 1));
+        A->r = B->r;
+    }
+
+    A->c = B->c;
+    A->mod = B->mod;
+
+    nmod_sparse_mat_fit_nnz(A, nnz);
+
+    k = 0;
+    for (i = 0; i < B->r; i++)
+    {
+        A->row_start[i] = k;
+
+        for (j = 0; j < B->c; j++)
+        {
+            if (nmod_mat_entry(B, i, j) != 0)
+            {
+                A->cols[k] = j;
+                A->entries[k] = nmod_mat_entry(B, i, j);
+                k++;
+            }
+        }
+    }
+
+    A->row_start[B->r] = k;
+}
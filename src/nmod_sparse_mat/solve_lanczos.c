@@ -0,0 +1,268 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+#define LANCZOS_MAX_ATTEMPTS 4
+
+/* dot product of column i of M and column j of N */
+static mp_limb_t
+_nmod_mat_col_dot(const nmod_mat_t M, slong i, const nmod_mat_t N, slong j)
+{
+    mp_limb_t hi, me, lo, phi, plo, res;
+    slong k;
+
+    hi = me = lo = 0;
+
+    for (k = 0; k < M->r; k++)
+    {
+        umul_ppmm(phi, plo, nmod_mat_entry(M, k, i), nmod_mat_entry(N, k, j));
+        add_sssaaaaaa(hi, me, lo, hi, me, lo, 0, phi, plo);
+    }
+
+    NMOD_RED3(res, hi, me, lo, M->mod);
+
+    return res;
+}
+
+/* column j of M += c * column i of N */
+static void
+_nmod_mat_col_addmul(nmod_mat_t M, slong j, const nmod_mat_t N, slong i, mp_limb_t c)
+{
+    slong k;
+
+    for (k = 0; k < M->r; k++)
+        nmod_mat_entry(M, k, j) = nmod_addmul(nmod_mat_entry(M, k, j),
+                                        nmod_mat_entry(N, k, i), c, M->mod);
+}
+
+static int
+_nmod_mat_col_is_zero(const nmod_mat_t M, slong j)
+{
+    slong k;
+
+    for (k = 0; k < M->r; k++)
+        if (nmod_mat_entry(M, k, j) != 0)
+            return 0;
+
+    return 1;
+}
+
+/*
+    Runs the Lanczos iteration for the symmetric system At D A x = At D b
+    simultaneously for each column b of B, so that the sparse products are
+    done on blocks. Returns in X the solutions of the columns for which the
+    iteration terminated without breakdown; done[j] is set accordingly.
+*/
+static void
+_nmod_sparse_mat_lanczos(nmod_mat_t X, int * done, const nmod_sparse_mat_t A,
+                const nmod_sparse_mat_t At, mp_srcptr D, const nmod_mat_t B)
+{
+    nmod_mat_t T, Wb, W, Wprev, Wnew, V, Vprev;
+    mp_ptr dprevinv;
+    slong i, j, k, iter, m, active;
+    mp_limb_t d, dinv, a, b;
+    nmod_t mod = A->mod;
+
+    m = B->c;
+
+    nmod_mat_init(T, A->r, m, mod.n);
+    nmod_mat_init(Wb, A->c, m, mod.n);
+    nmod_mat_init(W, A->c, m, mod.n);
+    nmod_mat_init(Wprev, A->c, m, mod.n);
+    nmod_mat_init(Wnew, A->c, m, mod.n);
+    nmod_mat_init(V, A->c, m, mod.n);
+    nmod_mat_init(Vprev, A->c, m, mod.n);
+    dprevinv = _nmod_vec_init(m);
+
+    /* Wb = At D B */
+    for (i = 0; i < A->r; i++)
+        _nmod_vec_scalar_mul_nmod(T->rows[i], B->rows[i], m, D[i], mod);
+    nmod_sparse_mat_mul_nmod_mat(Wb, At, T);
+
+    nmod_mat_set(W, Wb);
+    nmod_mat_zero(X);
+
+    for (j = 0; j < m; j++)
+    {
+        done[j] = 0;
+        dprevinv[j] = 0;
+    }
+
+    active = m;
+
+    for (iter = 0; active > 0 && iter <= A->c + 1; iter++)
+    {
+        /* V = At D A W */
+        nmod_sparse_mat_mul_nmod_mat(T, A, W);
+        for (i = 0; i < A->r; i++)
+            _nmod_vec_scalar_mul_nmod(T->rows[i], T->rows[i], m, D[i], mod);
+        nmod_sparse_mat_mul_nmod_mat(V, At, T);
+
+        nmod_mat_zero(Wnew);
+
+        for (j = 0; j < m; j++)
+        {
+            if (done[j])
+                continue;
+
+            if (_nmod_mat_col_is_zero(W, j))
+            {
+                done[j] = 1;
+                active--;
+                continue;
+            }
+
+            d = _nmod_mat_col_dot(W, j, V, j);
+
+            if (d == 0)
+            {
+                /* breakdown: w^T M w = 0 for nonzero w */
+                done[j] = -1;
+                active--;
+                continue;
+            }
+
+            dinv = nmod_inv(d, mod);
+
+            /* x += (w^T b / w^T M w) w */
+            _nmod_mat_col_addmul(X, j, W, j,
+                        nmod_mul(_nmod_mat_col_dot(W, j, Wb, j), dinv, mod));
+
+            /* w_new = v - (v^T v / w^T v) w - (v^T v_prev / w_prev^T v_prev) w_prev */
+            a = nmod_mul(_nmod_mat_col_dot(V, j, V, j), dinv, mod);
+            b = nmod_mul(_nmod_mat_col_dot(V, j, Vprev, j), dprevinv[j], mod);
+
+            for (k = 0; k < A->c; k++)
+                nmod_mat_entry(Wnew, k, j) = nmod_mat_entry(V, k, j);
+
+            _nmod_mat_col_addmul(Wnew, j, W, j, nmod_neg(a, mod));
+            _nmod_mat_col_addmul(Wnew, j, Wprev, j, nmod_neg(b, mod));
+
+            dprevinv[j] = dinv;
+        }
+
+        nmod_mat_swap(Wprev, W);
+        nmod_mat_swap(W, Wnew);
+        nmod_mat_swap(Vprev, V);
+    }
+
+    /* columns still running after the maximum number of steps have failed */
+    for (j = 0; j < m; j++)
+        if (done[j] != 1)
+            done[j] = 0;
+
+    nmod_mat_clear(T);
+    nmod_mat_clear(Wb);
+    nmod_mat_clear(W);
+    nmod_mat_clear(Wprev);
+    nmod_mat_clear(Wnew);
+    nmod_mat_clear(V);
+    nmod_mat_clear(Vprev);
+    _nmod_vec_clear(dprevinv);
+}
+
+int
+nmod_sparse_mat_solve_lanczos(nmod_mat_t X, const nmod_sparse_mat_t A,
+                                    const nmod_mat_t B, flint_rand_t state)
+{
+    nmod_sparse_mat_t At;
+    nmod_mat_t Bs, Xs, T;
+    mp_ptr D;
+    slong * todo;
+    int * done;
+    slong i, j, m, attempt;
+
+    if (B->r != A->r || X->r != A->c || X->c != B->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve_lanczos). "
+                     "Incompatible matrix dimensions.\n");
+        flint_abort();
+    }
+
+    if (B->c == 0)
+        return 1;
+
+    nmod_mat_zero(X);
+
+    if (A->c == 0)
+        return nmod_mat_is_zero(B);
+
+    nmod_sparse_mat_init(At, A->c, A->r, A->mod.n);
+    nmod_sparse_mat_transpose(At, A);
+
+    D = _nmod_vec_init(A->r);
+    todo = flint_malloc(sizeof(slong) * B->c);
+    done = flint_malloc(sizeof(int) * B->c);
+
+    m = B->c;
+    for (j = 0; j < m; j++)
+        todo[j] = j;
+
+    for (attempt = 0; attempt < LANCZOS_MAX_ATTEMPTS && m > 0; attempt++)
+    {
+        /* random nonzero diagonal preconditioner */
+        for (i = 0; i < A->r; i++)
+            D[i] = 1 + n_randint(state, A->mod.n - 1);
+
+        nmod_mat_init(Bs, A->r, m, A->mod.n);
+        nmod_mat_init(Xs, A->c, m, A->mod.n);
+        nmod_mat_init(T, A->r, m, A->mod.n);
+
+        for (i = 0; i < A->r; i++)
+            for (j = 0; j < m; j++)
+                nmod_mat_entry(Bs, i, j) = nmod_mat_entry(B, i, todo[j]);
+
+        _nmod_sparse_mat_lanczos(Xs, done, A, At, D, Bs);
+
+        /* keep the columns which are verified solutions */
+        nmod_sparse_mat_mul_nmod_mat(T, A, Xs);
+
+        for (j = 0; j < m; j++)
+        {
+            if (done[j])
+            {
+                for (i = 0; i < A->r; i++)
+                {
+                    if (nmod_mat_entry(T, i, j) != nmod_mat_entry(Bs, i, j))
+                    {
+                        done[j] = 0;
+                        break;
+                    }
+                }
+            }
+
+            if (done[j])
+                for (i = 0; i < A->c; i++)
+                    nmod_mat_entry(X, i, todo[j]) = nmod_mat_entry(Xs, i, j);
+        }
+
+        for (i = j = 0; j < m; j++)
+            if (!done[j])
+                todo[i++] = todo[j];
+        m = i;
+
+        nmod_mat_clear(Bs);
+        nmod_mat_clear(Xs);
+        nmod_mat_clear(T);
+    }
+
+    nmod_sparse_mat_clear(At);
+    _nmod_vec_clear(D);
+    flint_free(todo);
+    flint_free(done);
+
+    return m == 0;
+}
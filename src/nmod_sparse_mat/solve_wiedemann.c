@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "nmod.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_sparse_mat.h"
+
+#define WIEDEMANN_MAX_ATTEMPTS 8
+
+/*
+    If f(A) B = 0 with f(0) != 0, then A X = B for
+    X = -f(0)^(-1) (f_1 B + f_2 A B + ... + f_d A^(d-1) B).
+*/
+static void
+_nmod_sparse_mat_wiedemann_apply(nmod_mat_t X, const nmod_sparse_mat_t A,
+                                        const nmod_mat_t B, const nmod_poly_t f)
+{
+    nmod_poly_t g;
+
+    nmod_poly_init_mod(g, A->mod);
+    nmod_poly_shift_right(g, f, 1);
+    nmod_sparse_mat_poly_mul_nmod_mat(X, g, A, B);
+    nmod_mat_scalar_mul(X, X, nmod_neg(nmod_inv(f->coeffs[0], A->mod), A->mod));
+    nmod_poly_clear(g);
+}
+
+int
+nmod_sparse_mat_solve_wiedemann(nmod_mat_t X, const nmod_sparse_mat_t A,
+                                    const nmod_mat_t B, flint_rand_t state)
+{
+    nmod_poly_t f, g, h;
+    nmod_mat_t T;
+    slong attempt;
+    int success = 0;
+
+    if (A->r != A->c || B->r != A->r || X->r != A->c || X->c != B->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve_wiedemann). "
+                     "Incompatible matrix dimensions.\n");
+        flint_abort();
+    }
+
+    if (nmod_mat_is_empty(B))
+        return 1;
+
+    nmod_poly_init_mod(f, A->mod);
+    nmod_poly_init_mod(g, A->mod);
+    nmod_poly_init_mod(h, A->mod);
+    nmod_mat_init(T, B->r, B->c, A->mod.n);
+
+    nmod_poly_one(f);
+
+    /* each projected generator divides the minimal polynomial of A; their
+       least common multiple reaches it after few attempts */
+    for (attempt = 0; attempt < WIEDEMANN_MAX_ATTEMPTS; attempt++)
+    {
+        nmod_sparse_mat_minpoly_wiedemann(g, A, state);
+        nmod_poly_gcd(h, f, g);
+        nmod_poly_div(g, g, h);
+        nmod_poly_mul(f, f, g);
+
+        /* a zero root of a factor of the minimal polynomial */
+        if (f->coeffs[0] == 0)
+            break;
+
+        _nmod_sparse_mat_wiedemann_apply(X, A, B, f);
+        nmod_sparse_mat_mul_nmod_mat(T, A, X);
+
+        if (nmod_mat_equal(T, B))
+        {
+            success = 1;
+            break;
+        }
+    }
+
+    nmod_poly_clear(f);
+    nmod_poly_clear(g);
+    nmod_poly_clear(h);
+    nmod_mat_clear(T);
+
+    return success;
+}
@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_nmod_mat....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, B, C, E;
+        mp_limb_t n;
+        slong m, c, k;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 500);
+            c = n_randint(state, 500);
+        }
+        else
+        {
+            m = n_randint(state, 30);
+            c = n_randint(state, 30);
+        }
+
+        k = n_randint(state, 20);
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, m, c, n);
+        nmod_mat_init(D, m, c, n);
+        nmod_mat_init(B, c, k, n);
+        nmod_mat_init(C, m, k, n);
+        nmod_mat_init(E, m, k, n);
+
+        nmod_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 10));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        nmod_mat_randtest(B, state);
+        nmod_mat_randtest(C, state);
+
+        nmod_sparse_mat_mul_nmod_mat(C, A, B);
+        nmod_mat_mul(E, D, B);
+
+        if (!nmod_mat_equal(C, E))
+        {
+            flint_printf("FAIL: product\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (m == c)
+        {
+            nmod_poly_t f;
+            nmod_mat_t F, G;
+            slong i;
+
+            /* aliasing */
+            nmod_mat_init_set(F, B);
+            nmod_sparse_mat_mul_nmod_mat(F, A, F);
+
+            if (!nmod_mat_equal(F, E))
+            {
+                flint_printf("FAIL: aliasing\n");
+                fflush(stdout);
+                flint_abort();
+            }
+
+            /* polynomial evaluation, compared with dense Horner */
+            nmod_poly_init(f, n);
+            nmod_mat_init(G, c, k, n);
+            nmod_poly_randtest(f, state, n_randint(state, 6));
+
+            nmod_mat_zero(F);
+            for (i = nmod_poly_length(f) - 1; i >= 0; i--)
+            {
+                nmod_mat_mul(G, D, F);
+                nmod_mat_scalar_addmul_ui(F, G, B, nmod_poly_get_coeff_ui(f, i));
+            }
+
+            if (n_randint(state, 2))
+            {
+                nmod_sparse_mat_poly_mul_nmod_mat(G, f, A, B);
+            }
+            else
+            {
+                nmod_mat_set(G, B);
+                nmod_sparse_mat_poly_mul_nmod_mat(G, f, A, G);
+            }
+
+            if (!nmod_mat_equal(F, G))
+            {
+                flint_printf("FAIL: poly_mul_nmod_mat\n");
+                fflush(stdout);
+                flint_abort();
+            }
+
+            nmod_poly_clear(f);
+            nmod_mat_clear(F);
+            nmod_mat_clear(G);
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
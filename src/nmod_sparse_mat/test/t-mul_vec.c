@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, X, Y;
+        mp_ptr x, y;
+        mp_limb_t n;
+        slong m, c, i;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        /* large enough to be threaded sometimes */
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 2000);
+            c = 1 + n_randint(state, 2000);
+        }
+        else
+        {
+            m = n_randint(state, 40);
+            c = 1 + n_randint(state, 40);
+        }
+
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, m, c, n);
+        nmod_mat_init(D, m, c, n);
+        nmod_mat_init(X, c, 1, n);
+        nmod_mat_init(Y, m, 1, n);
+        x = _nmod_vec_init(c);
+        y = _nmod_vec_init(m);
+
+        nmod_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 10));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+
+        nmod_mat_randtest(X, state);
+        for (i = 0; i < c; i++)
+            x[i] = nmod_mat_entry(X, i, 0);
+
+        nmod_sparse_mat_mul_vec(y, A, x);
+        nmod_mat_mul(Y, D, X);
+
+        for (i = 0; i < m; i++)
+        {
+            if (y[i] != nmod_mat_entry(Y, i, 0))
+            {
+                flint_printf("FAIL\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A, K;
+        nmod_mat_t D, Kd, Kt, P;
+        mp_limb_t p;
+        slong m, n, rank, nullity;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        p = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, m, n, p);
+        nmod_sparse_mat_init(K, 0, n, p);
+        nmod_mat_init(D, m, n, p);
+
+        nmod_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 6));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+
+        rank = nmod_sparse_mat_rank(A);
+
+        if (rank != nmod_mat_rank(D))
+        {
+            flint_printf("FAIL: rank\n");
+            nmod_mat_print_pretty(D);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nullity = nmod_sparse_mat_nullspace(K, A);
+
+        if (nullity + rank != n || K->r != nullity || K->c != n)
+        {
+            flint_printf("FAIL: nullity\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_init(Kd, nullity, n, p);
+        nmod_mat_init(Kt, n, nullity, p);
+        nmod_mat_init(P, m, nullity, p);
+
+        nmod_sparse_mat_get_nmod_mat(Kd, K);
+        nmod_mat_transpose(Kt, Kd);
+        nmod_sparse_mat_mul_nmod_mat(P, A, Kt);
+
+        if (!nmod_mat_is_zero(P) || nmod_mat_rank(Kd) != nullity)
+        {
+            flint_printf("FAIL: basis\n");
+            nmod_mat_print_pretty(D);
+            nmod_mat_print_pretty(Kd);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(K);
+        nmod_mat_clear(D);
+        nmod_mat_clear(Kd);
+        nmod_mat_clear(Kt);
+        nmod_mat_clear(P);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
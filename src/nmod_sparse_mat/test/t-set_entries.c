@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_entries....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A, B;
+        nmod_mat_t D, E;
+        slong * rows, * cols;
+        mp_ptr vals;
+        mp_limb_t n;
+        slong m, c, i, j, len;
+
+        m = n_randint(state, 20);
+        c = n_randint(state, 20);
+        n = n_randtest_not_zero(state);
+        len = n_randint(state, 3 * m * c + 1);
+
+        nmod_sparse_mat_init(A, m, c, n);
+        nmod_sparse_mat_init(B, m, c, n);
+        nmod_mat_init(D, m, c, n);
+        nmod_mat_init(E, m, c, n);
+
+        rows = flint_malloc(sizeof(slong) * (len + 1));
+        cols = flint_malloc(sizeof(slong) * (len + 1));
+        vals = flint_malloc(sizeof(mp_limb_t) * (len + 1));
+
+        /* unordered entries with repetitions, accumulated in D */
+        if (m != 0 && c != 0)
+        {
+            for (i = 0; i < len; i++)
+            {
+                rows[i] = n_randint(state, m);
+                cols[i] = n_randint(state, c);
+                vals[i] = n_randtest(state);
+
+                nmod_mat_entry(D, rows[i], cols[i]) = nmod_add(nmod_mat_entry(D,
+                     rows[i], cols[i]), n_mod2_preinv(vals[i], D->mod.n,
+                                                D->mod.ninv), D->mod);
+            }
+        }
+        else
+        {
+            len = 0;
+        }
+
+        nmod_sparse_mat_set_entries(A, rows, cols, vals, len);
+        nmod_sparse_mat_get_nmod_mat(E, A);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: entries\n");
+            nmod_mat_print_pretty(D);
+            nmod_mat_print_pretty(E);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* rows are sorted without explicit zeros */
+        for (i = 0; i < m; i++)
+        {
+            for (j = A->row_start[i]; j < A->row_start[i + 1]; j++)
+            {
+                if (A->entries[j] == 0 ||
+                        (j > A->row_start[i] && A->cols[j] <= A->cols[j - 1]))
+                {
+                    flint_printf("FAIL: normalisation\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+
+                if (nmod_sparse_mat_get_entry(A, i, A->cols[j]) != A->entries[j])
+                {
+                    flint_printf("FAIL: get_entry\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        nmod_sparse_mat_set_nmod_mat(B, D);
+
+        if (!nmod_sparse_mat_equal(A, B))
+        {
+            flint_printf("FAIL: set_nmod_mat\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(B);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+        flint_free(rows);
+        flint_free(cols);
+        flint_free(vals);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_lanczos....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, B, X, AX;
+        mp_limb_t p;
+        slong m, n, k;
+        int large, success;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        n = n_randint(state, 40);
+        m = n + n_randint(state, 10);
+        k = 1 + n_randint(state, 5);
+
+        large = n_randint(state, 2);
+        p = large ? n_randprime(state, 40 + n_randint(state, 24), 0)
+                  : n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, m, n, p);
+        nmod_mat_init(D, m, n, p);
+        nmod_mat_init(B, m, k, p);
+        nmod_mat_init(X, n, k, p);
+        nmod_mat_init(AX, m, k, p);
+
+        nmod_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 5));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+
+        /* consistent right hand sides */
+        nmod_mat_randtest(X, state);
+        nmod_mat_mul(B, D, X);
+
+        success = nmod_sparse_mat_solve_lanczos(X, A, B, state);
+
+        if (success)
+        {
+            nmod_sparse_mat_mul_nmod_mat(AX, A, X);
+
+            if (!nmod_mat_equal(AX, B))
+            {
+                flint_printf("FAIL: A X != B\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+        else if (large && nmod_mat_rank(D) == n)
+        {
+            flint_printf("FAIL: full rank system not solved\n");
+            nmod_mat_print_pretty(D);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* inconsistent systems are detected */
+        if (nmod_mat_rank(D) < m)
+        {
+            nmod_mat_randtest(B, state);
+
+            if (nmod_sparse_mat_solve_lanczos(X, A, B, state))
+            {
+                nmod_sparse_mat_mul_nmod_mat(AX, A, X);
+
+                if (!nmod_mat_equal(AX, B))
+                {
+                    flint_printf("FAIL: wrong solution\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(B);
+        nmod_mat_clear(X);
+        nmod_mat_clear(AX);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
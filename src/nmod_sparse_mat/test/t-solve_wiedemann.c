@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_wiedemann....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, B, X, AX;
+        nmod_poly_t f, g, r;
+        mp_limb_t p;
+        slong n, k, rank;
+        int large, success;
+
+        n = n_randint(state, 40);
+        k = 1 + n_randint(state, 5);
+
+        large = n_randint(state, 2);
+        p = large ? n_randprime(state, 40 + n_randint(state, 24), 0)
+                  : n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, n, n, p);
+        nmod_mat_init(D, n, n, p);
+        nmod_mat_init(B, n, k, p);
+        nmod_mat_init(X, n, k, p);
+        nmod_mat_init(AX, n, k, p);
+        nmod_poly_init(f, p);
+        nmod_poly_init(g, p);
+        nmod_poly_init(r, p);
+
+        nmod_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 4));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        nmod_mat_randtest(B, state);
+
+        /* the projected generator divides the minimal polynomial */
+        nmod_sparse_mat_minpoly_wiedemann(f, A, state);
+        nmod_mat_minpoly(g, D);
+        nmod_poly_rem(r, g, f);
+
+        if (!nmod_poly_is_zero(r))
+        {
+            flint_printf("FAIL: minpoly\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        rank = nmod_mat_rank(D);
+        success = nmod_sparse_mat_solve_wiedemann(X, A, B, state);
+
+        if (success)
+        {
+            nmod_sparse_mat_mul_nmod_mat(AX, A, X);
+
+            if (!nmod_mat_equal(AX, B))
+            {
+                flint_printf("FAIL: A X != B\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+        else if (rank == n && large)
+        {
+            flint_printf("FAIL: nonsingular system not solved\n");
+            nmod_mat_print_pretty(D);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* consistent singular systems may or may not be solved */
+        if (rank < n)
+        {
+            nmod_mat_randtest(X, state);
+            nmod_mat_mul(B, D, X);
+
+            if (nmod_sparse_mat_solve_wiedemann(X, A, B, state))
+            {
+                nmod_sparse_mat_mul_nmod_mat(AX, A, X);
+
+                if (!nmod_mat_equal(AX, B))
+                {
+                    flint_printf("FAIL: singular A X != B\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(B);
+        nmod_mat_clear(X);
+        nmod_mat_clear(AX);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        nmod_poly_clear(r);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
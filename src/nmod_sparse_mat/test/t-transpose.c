@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A, B, C;
+        nmod_mat_t D, Dt, E;
+        mp_limb_t n;
+        slong m, c;
+
+        m = n_randint(state, 30);
+        c = n_randint(state, 30);
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, m, c, n);
+        nmod_sparse_mat_init(B, c, m, n);
+        nmod_sparse_mat_init(C, m, c, n);
+        nmod_mat_init(D, m, c, n);
+        nmod_mat_init(Dt, c, m, n);
+        nmod_mat_init(E, c, m, n);
+
+        nmod_sparse_mat_randtest(A, state, 0, 1 + n_randint(state, 6));
+        nmod_sparse_mat_transpose(B, A);
+
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        nmod_sparse_mat_get_nmod_mat(E, B);
+        nmod_mat_transpose(Dt, D);
+
+        if (!nmod_mat_equal(E, Dt))
+        {
+            flint_printf("FAIL: transpose\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_transpose(C, B);
+
+        if (!nmod_sparse_mat_equal(C, A))
+        {
+            flint_printf("FAIL: involution\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* aliasing */
+        if (m == c)
+        {
+            nmod_sparse_mat_transpose(C, C);
+
+            if (!nmod_sparse_mat_equal(C, B))
+            {
+                flint_printf("FAIL: aliasing\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(B);
+        nmod_sparse_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(Dt);
+        nmod_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -29,6 +29,10 @@
 #define PADIC_TEST_PREC_MIN WORD(-100)
 #define PADIC_TEST_PREC_MAX  WORD(100)
 
+/* Binary splitting evaluations of series whose product tree has
+   leaves of more than this many bits in total are threaded. */
+#define PADIC_BSPLIT_THREAD_CUTOFF WORD(16384)
+
 typedef struct {
     fmpz u;
     slong v;
@@ -10,6 +10,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "padic.h"
 
 /*
@@ -73,6 +74,73 @@ _padic_exp_bsplit_series(fmpz_t P, fmpz_t Q, fmpz_t T,
     }
 }
 
+typedef struct
+{
+    fmpz P;
+    fmpz Q;
+    fmpz T;
+}
+bsplit_res_t;
+
+static void
+bsplit_init(bsplit_res_t * x, const fmpz * args)
+{
+    fmpz_init(&x->P);
+    fmpz_init(&x->Q);
+    fmpz_init(&x->T);
+}
+
+static void
+bsplit_clear(bsplit_res_t * x, const fmpz * args)
+{
+    fmpz_clear(&x->P);
+    fmpz_clear(&x->Q);
+    fmpz_clear(&x->T);
+}
+
+static void
+bsplit_basecase(bsplit_res_t * res, slong a, slong b, const fmpz * x)
+{
+    _padic_exp_bsplit_series(&res->P, &res->Q, &res->T, x, a, b);
+}
+
+static void
+bsplit_merge(bsplit_res_t * res, bsplit_res_t * left, bsplit_res_t * right, const fmpz * x)
+{
+    fmpz_mul(&res->T, &left->T, &right->Q);
+    fmpz_addmul(&res->T, &left->P, &right->T);
+    fmpz_mul(&res->P, &left->P, &right->P);
+    fmpz_mul(&res->Q, &left->Q, &right->Q);
+}
+
+/*
+    Same as _padic_exp_bsplit_series(P, Q, T, x, a, b), distributing
+    the subranges over the available threads.
+ */
+
+static void
+_padic_exp_bsplit_series_threaded(fmpz_t P, fmpz_t Q, fmpz_t T,
+                        const fmpz_t x, slong a, slong b)
+{
+    bsplit_res_t res;
+
+    res.P = *P;
+    res.Q = *Q;
+    res.T = *T;
+
+    flint_parallel_binary_splitting(&res,
+        (bsplit_basecase_func_t) bsplit_basecase,
+        (bsplit_merge_func_t) bsplit_merge,
+        sizeof(bsplit_res_t),
+        (bsplit_init_func_t) bsplit_init,
+        (bsplit_clear_func_t) bsplit_clear,
+        (void *) x, a, b, 16, -1, FLINT_PARALLEL_BSPLIT_LEFT_INPLACE);
+
+    *P = res.P;
+    *Q = res.Q;
+    *T = res.T;
+}
+
 /*
     Assumes that $x$ is such that $\exp(x)$ converges.
 
@@ -101,7 +169,11 @@ _padic_exp_bsplit(fmpz_t y, const fmpz_t x, slong v, const fmpz_t p, slong N)
         fmpz_init(Q);
         fmpz_init(T);
 
-        _padic_exp_bsplit_series(P, Q, T, x, 1, n);
+        if (flint_get_num_threads() > 1 && n > 32 &&
+            (n - 1) * fmpz_bits(x) > PADIC_BSPLIT_THREAD_CUTOFF)
+            _padic_exp_bsplit_series_threaded(P, Q, T, x, 1, n);
+        else
+            _padic_exp_bsplit_series(P, Q, T, x, 1, n);
 
         fmpz_add(T, T, Q);  /* (T,Q) := (T,Q) + 1 */
 
@@ -10,6 +10,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "padic.h"
 #include "ulong_extras.h"
 
@@ -57,6 +58,69 @@ _padic_log_bsplit_series(fmpz_t P, fmpz_t B, fmpz_t T,
     }
 }
 
+typedef struct
+{
+    fmpz P;
+    fmpz B;
+    fmpz T;
+}
+bsplit_res_t;
+
+static void
+bsplit_init(bsplit_res_t * x, const fmpz * args)
+{
+    fmpz_init(&x->P);
+    fmpz_init(&x->B);
+    fmpz_init(&x->T);
+}
+
+static void
+bsplit_clear(bsplit_res_t * x, const fmpz * args)
+{
+    fmpz_clear(&x->P);
+    fmpz_clear(&x->B);
+    fmpz_clear(&x->T);
+}
+
+static void
+bsplit_basecase(bsplit_res_t * res, slong a, slong b, const fmpz * x)
+{
+    _padic_log_bsplit_series(&res->P, &res->B, &res->T, x, a, b);
+}
+
+static void
+bsplit_merge(bsplit_res_t * res, bsplit_res_t * left, bsplit_res_t * right, const fmpz * x)
+{
+    fmpz_mul(&right->T, &right->T, &left->P);
+    fmpz_mul(&res->T, &left->T, &right->B);
+    fmpz_addmul(&res->T, &right->T, &left->B);
+    fmpz_mul(&res->P, &left->P, &right->P);
+    fmpz_mul(&res->B, &left->B, &right->B);
+}
+
+static void
+_padic_log_bsplit_series_threaded(fmpz_t P, fmpz_t B, fmpz_t T,
+                         const fmpz_t x, slong a, slong b)
+{
+    bsplit_res_t res;
+
+    res.P = *P;
+    res.B = *B;
+    res.T = *T;
+
+    flint_parallel_binary_splitting(&res,
+        (bsplit_basecase_func_t) bsplit_basecase,
+        (bsplit_merge_func_t) bsplit_merge,
+        sizeof(bsplit_res_t),
+        (bsplit_init_func_t) bsplit_init,
+        (bsplit_clear_func_t) bsplit_clear,
+        (void *) x, a, b, 16, -1, FLINT_PARALLEL_BSPLIT_LEFT_INPLACE);
+
+    *P = res.P;
+    *B = res.B;
+    *T = res.T;
+}
+
 /*
     Assumes that $y = 1 - x$ is such that $\log(x)$
     converges.
@@ -82,7 +146,11 @@ _padic_log_bsplit(fmpz_t z, const fmpz_t y, slong v, const fmpz_t p, slong N)
     fmpz_init(B);
     fmpz_init(T);
 
-    _padic_log_bsplit_series(P, B, T, y, 1, n);
+    if (flint_get_num_threads() > 1 && n > 32 &&
+        (n - 1) * fmpz_bits(y) > PADIC_BSPLIT_THREAD_CUTOFF)
+        _padic_log_bsplit_series_threaded(P, B, T, y, 1, n);
+    else
+        _padic_log_bsplit_series(P, B, T, y, 1, n);
 
     k = fmpz_remove(B, B, p);
     fmpz_pow_ui(P, p, k);
@@ -239,9 +239,64 @@ main(void)
         padic_ctx_clear(ctx);
     }
 
+    /* Check that the threaded evaluation agrees at high precision */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, u;
+        slong N;
+        padic_ctx_t ctx;
+
+        padic_t a, b, c;
+        int ans1, ans2;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        N = 2000 + n_randint(state, 4000);
+
+        padic_ctx_init(ctx, p, 0, 0, PADIC_SERIES);
+
+        padic_init2(a, N);
+        padic_init2(b, N);
+        padic_init2(c, N);
+
+        fmpz_init(u);
+        fmpz_pow_ui(u, p, N);
+        fmpz_randm(u, state, u);
+        fmpz_mul(u, u, p);
+        if (fmpz_equal_ui(p, 2))
+            fmpz_mul_2exp(u, u, 1);
+        padic_set_fmpz(a, u, ctx);
+
+        flint_set_num_threads(1);
+        ans1 = padic_exp_balanced(b, a, ctx);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        ans2 = padic_exp_balanced(c, a, ctx);
+
+        result = ((ans1 == ans2) && (!ans1 || padic_equal(b, c)));
+        if (!result)
+        {
+            flint_printf("FAIL (threads):\n\n");
+            flint_printf("a = "), padic_print(a, ctx), flint_printf("\n");
+            flint_printf("b = "), padic_print(b, ctx), flint_printf("\n");
+            flint_printf("c = "), padic_print(c, ctx), flint_printf("\n");
+            flint_printf("ans1 = %d\n", ans1);
+            flint_printf("ans2 = %d\n", ans2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        padic_clear(a);
+        padic_clear(b);
+        padic_clear(c);
+
+        fmpz_clear(p);
+        fmpz_clear(u);
+        padic_ctx_clear(ctx);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
+    flint_cleanup_master();
     return 0;
 }
 
@@ -24,6 +24,8 @@ void partitions_hrr_sum_arb(arb_t x, const fmpz_t n, slong N0, slong N, int use_
 
 void partitions_fmpz_fmpz(fmpz_t p, const fmpz_t n, int use_doubles);
 
+void partitions_fmpz_fmpz_vec(fmpz * res, const fmpz * n, slong len, int use_doubles);
+
 void partitions_fmpz_ui(fmpz_t p, ulong n);
 
 /* deprecated */
@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "thread_support.h"
+#include "fmpz.h"
+#include "partitions.h"
+
+typedef struct
+{
+    fmpz * res;
+    const fmpz * n;
+    const slong * perm;
+    int use_doubles;
+}
+work_t;
+
+static void
+worker(slong k, work_t * work)
+{
+    slong i = work->perm[k];
+    partitions_fmpz_fmpz(work->res + i, work->n + i, work->use_doubles);
+}
+
+typedef struct
+{
+    const fmpz * n;
+    slong index;
+}
+sort_t;
+
+static int
+sort_cmp(const void * a, const void * b)
+{
+    /* largest first */
+    return fmpz_cmp(((const sort_t *) b)->n, ((const sort_t *) a)->n);
+}
+
+void
+partitions_fmpz_fmpz_vec(fmpz * res, const fmpz * n, slong len, int use_doubles)
+{
+    slong i, * perm;
+    sort_t * v;
+    work_t work;
+
+    if (len <= 0)
+        return;
+
+    if (len == 1 || flint_get_num_threads() == 1)
+    {
+        for (i = 0; i < len; i++)
+            partitions_fmpz_fmpz(res + i, n + i, use_doubles);
+        return;
+    }
+
+    /* The cost grows like sqrt(n), so we start with the largest inputs
+       and hand them out in strided order for balance. Any threads left
+       over are used by the individual evaluations. */
+    v = flint_malloc(sizeof(sort_t) * len);
+    perm = flint_malloc(sizeof(slong) * len);
+
+    for (i = 0; i < len; i++)
+    {
+        v[i].n = n + i;
+        v[i].index = i;
+    }
+
+    qsort(v, len, sizeof(sort_t), sort_cmp);
+
+    for (i = 0; i < len; i++)
+        perm[i] = v[i].index;
+
+    flint_free(v);
+
+    work.res = res;
+    work.n = n;
+    work.perm = perm;
+    work.use_doubles = use_doubles;
+
+    flint_parallel_do((do_func_t) worker, &work, len, -1, FLINT_PARALLEL_STRIDED);
+
+    flint_free(perm);
+}
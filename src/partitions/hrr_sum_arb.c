@@ -184,11 +184,11 @@ sinh_cosh_divk_precomp(arb_t sh, arb_t ch, const arb_t ex, slong k, slong prec)
 }
 
 static void
-partitions_hrr_sum_arb_range(arb_t x, const fmpz_t n, const arb_t C, const arb_t exp1, const fmpz_t n24, slong start, slong N, slong step, slong prec, slong acc_prec, slong res_prec)
+partitions_hrr_sum_arb_range(arb_t x, const fmpz_t n, const arb_t C, const arb_t exp1, const fmpz_t n24, slong N0, slong N, slong thread, slong num_threads, slong prec, slong acc_prec, slong res_prec)
 {
     arb_t acc, t1, t2, t3, t4;
     trig_prod_t prod;
-    slong k;
+    slong k, r;
     double nd;
 
     arb_init(acc);
@@ -199,8 +199,19 @@ partitions_hrr_sum_arb_range(arb_t x, const fmpz_t n, const arb_t C, const arb_t
 
     nd = fmpz_get_d(n);
 
-    for (k = start; k <= N; k += step)
+    /* The terms decrease in cost with k, so we hand them out to the
+       threads in alternating order (thread 0 takes k = N0 and the
+       last k of the second round, etc.) to keep the work balanced. */
+    for (r = 0; ; r++)
     {
+        if (r % 2 == 0)
+            k = N0 + r * num_threads + thread;
+        else
+            k = N0 + r * num_threads + (num_threads - 1 - thread);
+
+        if (k > N)
+            break;
+
         trig_prod_init(prod);
         arith_hrr_expsum_factored(prod, k, fmpz_fdiv_ui(n, k));
 
@@ -260,7 +271,7 @@ typedef struct
     const fmpz * n24;
     slong N0;
     slong N;
-    slong step;
+    slong num_threads;
     slong prec;
     slong acc_prec;
     slong res_prec;
@@ -270,7 +281,30 @@ typedef struct
 static void
 worker(slong i, work_t * work)
 {
-    partitions_hrr_sum_arb_range(work->x + i, work->n, work->C, work->exp1, work->n24, work->N0 + i, work->N, work->step, work->prec, work->acc_prec, work->res_prec);
+    partitions_hrr_sum_arb_range(work->x + i, work->n, work->C, work->exp1, work->n24, work->N0, work->N, i, work->num_threads, work->prec, work->acc_prec, work->res_prec);
+}
+
+/* Above this precision, pi and sqrt(24n-1) are computed in parallel. */
+#define CONST_PARALLEL_PREC 100000
+
+typedef struct
+{
+    arb_ptr pi;
+    arb_ptr sqrt;
+    const fmpz * n24;
+    slong prec;
+}
+const_work_t;
+
+static void
+const_worker(slong i, const_work_t * work)
+{
+    /* with two threads, the last task runs on the calling thread,
+       which keeps the cached value of pi */
+    if (i == 0)
+        arb_sqrt_fmpz(work->sqrt, work->n24, work->prec);
+    else
+        arb_const_pi(work->pi, work->prec);
 }
 
 void
@@ -311,16 +345,32 @@ partitions_hrr_sum_arb(arb_t x, const fmpz_t n, slong N0, slong N, int use_doubl
     fmpz_sub_ui(n24, n24, 1);
 
     /* C = (pi/6) sqrt(24n-1) */
+    arb_init(t);
+
+    if (prec >= CONST_PARALLEL_PREC && flint_get_num_threads() > 1)
+    {
+        const_work_t work;
+
+        work.pi = C;
+        work.sqrt = t;
+        work.n24 = n24;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) const_worker, &work, 2, 2, FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
 #if VERBOSE
-    TIMEIT_ONCE_START
-    arb_const_pi(C, prec);
-    TIMEIT_ONCE_STOP
+        TIMEIT_ONCE_START
+        arb_const_pi(C, prec);
+        TIMEIT_ONCE_STOP
 #else
-    arb_const_pi(C, prec);
+        arb_const_pi(C, prec);
 #endif
 
-    arb_init(t);
-    arb_sqrt_fmpz(t, n24, prec);
+        arb_sqrt_fmpz(t, n24, prec);
+    }
+
     arb_mul(C, C, t, prec);
     arb_div_ui(C, C, 6, prec);
     arb_clear(t);
@@ -339,7 +389,7 @@ partitions_hrr_sum_arb(arb_t x, const fmpz_t n, slong N0, slong N, int use_doubl
 
     if (num_threads == 1)
     {
-        partitions_hrr_sum_arb_range(x, n, C, exp1, n24, N0, N, 1, prec, acc_prec, res_prec);
+        partitions_hrr_sum_arb_range(x, n, C, exp1, n24, N0, N, 0, 1, prec, acc_prec, res_prec);
     }
     else
     {
@@ -359,7 +409,7 @@ partitions_hrr_sum_arb(arb_t x, const fmpz_t n, slong N0, slong N, int use_doubl
         work.n24 = n24;
         work.N0 = N0;
         work.N = N;
-        work.step = num_threads;
+        work.num_threads = num_threads;
         work.prec = prec;
         work.acc_prec = acc_prec;
         work.res_prec = res_prec;
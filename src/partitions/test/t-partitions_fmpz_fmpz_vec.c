@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "partitions.h"
+
+int main(void)
+{
+    flint_rand_t state;
+    slong iter;
+
+    flint_printf("partitions_fmpz_fmpz_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        fmpz * n, * res;
+        fmpz_t p;
+        slong i, len;
+        int use_doubles;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 10);
+        use_doubles = n_randint(state, 2);
+
+        n = _fmpz_vec_init(len);
+        res = _fmpz_vec_init(len);
+        fmpz_init(p);
+
+        for (i = 0; i < len; i++)
+        {
+            if (n_randint(state, 10) == 0)
+                fmpz_set_si(n + i, -(slong) n_randint(state, 10));
+            else if (n_randint(state, 2))
+                fmpz_set_ui(n + i, n_randint(state, 3000));
+            else
+                fmpz_set_ui(n + i, n_randint(state, 100000));
+        }
+
+        partitions_fmpz_fmpz_vec(res, n, len, use_doubles);
+
+        for (i = 0; i < len; i++)
+        {
+            partitions_fmpz_fmpz(p, n + i, use_doubles);
+
+            if (!fmpz_equal(p, res + i))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = "); fmpz_print(n + i); flint_printf("\n");
+                flint_printf("res = "); fmpz_print(res + i); flint_printf("\n");
+                flint_printf("p = "); fmpz_print(p); flint_printf("\n");
+                flint_abort();
+            }
+        }
+
+        /* aliasing */
+        partitions_fmpz_fmpz_vec(n, n, len, use_doubles);
+
+        if (!_fmpz_vec_equal(n, res, len))
+        {
+            flint_printf("FAIL (aliasing)\n");
+            flint_abort();
+        }
+
+        _fmpz_vec_clear(n, len);
+        _fmpz_vec_clear(res, len);
+        fmpz_clear(p);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -406,6 +406,35 @@ void _qadic_frobenius(fmpz *rop, const fmpz *op, slong len, slong e,
 
 void qadic_frobenius(qadic_t rop, const qadic_t op, slong e, const qadic_ctx_t ctx);
 
+typedef struct
+{
+    fmpz *mat;
+    slong d;
+    slong e;
+    slong N;
+}
+qadic_frobenius_precomp_struct;
+
+typedef qadic_frobenius_precomp_struct qadic_frobenius_precomp_t[1];
+
+/* Matrix-vector products of at least this many bits are threaded */
+#define QADIC_FROBENIUS_THREAD_CUTOFF WORD(1000000)
+
+void _qadic_frobenius_precomp_init(fmpz *mat, slong e,
+                                   const fmpz *a, const slong *j, slong lena,
+                                   const fmpz_t p, slong N);
+
+void qadic_frobenius_precomp_init(qadic_frobenius_precomp_t F, slong e,
+                                  slong N, const qadic_ctx_t ctx);
+
+void qadic_frobenius_precomp_clear(qadic_frobenius_precomp_t F);
+
+void _qadic_frobenius_precomp(fmpz *rop, const fmpz *op, slong len,
+                              const fmpz *mat, slong d, const fmpz_t pN);
+
+void qadic_frobenius_precomp(qadic_t rop, const qadic_t op,
+                      const qadic_frobenius_precomp_t F, const qadic_ctx_t ctx);
+
 void _qadic_teichmuller(fmpz *rop, const fmpz *op, slong len,
                         const fmpz *a, const slong *j, slong lena,
                         const fmpz_t p, slong N);
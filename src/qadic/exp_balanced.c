@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz_poly.h"
 #include "qadic.h"
 
@@ -76,6 +77,110 @@ _qadic_exp_bsplit_series(fmpz *P, fmpz_t Q, fmpz *T,
     }
 }
 
+typedef struct
+{
+    const fmpz * x;
+    slong len;
+    const fmpz * a;
+    const slong * j;
+    slong lena;
+}
+bsplit_args_t;
+
+typedef struct
+{
+    fmpz * P;
+    fmpz Q;
+    fmpz * T;
+}
+bsplit_res_t;
+
+static void
+bsplit_init(bsplit_res_t * x, bsplit_args_t * args)
+{
+    const slong d = args->j[args->lena - 1];
+
+    x->P = _fmpz_vec_init(2*d - 1);
+    fmpz_init(&x->Q);
+    x->T = _fmpz_vec_init(2*d - 1);
+}
+
+static void
+bsplit_clear(bsplit_res_t * x, bsplit_args_t * args)
+{
+    const slong d = args->j[args->lena - 1];
+
+    _fmpz_vec_clear(x->P, 2*d - 1);
+    fmpz_clear(&x->Q);
+    _fmpz_vec_clear(x->T, 2*d - 1);
+}
+
+static void
+bsplit_basecase(bsplit_res_t * res, slong lo, slong hi, bsplit_args_t * args)
+{
+    _qadic_exp_bsplit_series(res->P, &res->Q, res->T, args->x, args->len,
+                             lo, hi, args->a, args->j, args->lena);
+}
+
+static void
+bsplit_merge(bsplit_res_t * res, bsplit_res_t * left, bsplit_res_t * right, bsplit_args_t * args)
+{
+    const slong d = args->j[args->lena - 1];
+    fmpz * W;
+
+    FLINT_ASSERT(res == left);
+
+    W = _fmpz_vec_init(2*d - 1);
+
+    _fmpz_poly_mul(W, right->T, d, res->P, d);
+    _fmpz_poly_reduce(W, 2*d - 1, args->a, args->j, args->lena);
+
+    _fmpz_vec_scalar_mul_fmpz(res->T, res->T, d, &right->Q);
+    _fmpz_vec_add(res->T, res->T, W, d);
+
+    _fmpz_poly_mul(W, res->P, d, right->P, d);
+    _fmpz_poly_reduce(W, 2*d - 1, args->a, args->j, args->lena);
+    _fmpz_vec_swap(res->P, W, d);
+
+    fmpz_mul(&res->Q, &res->Q, &right->Q);
+
+    _fmpz_vec_clear(W, 2*d - 1);
+}
+
+/*
+    Same as _qadic_exp_bsplit_series() over the range [lo, hi),
+    distributing the subranges over the available threads.
+ */
+
+static void
+_qadic_exp_bsplit_series_threaded(fmpz *P, fmpz_t Q, fmpz *T,
+                         const fmpz *x, slong len, slong lo, slong hi,
+                         const fmpz *a, const slong *j, slong lena)
+{
+    bsplit_args_t args;
+    bsplit_res_t res;
+
+    args.x = x;
+    args.len = len;
+    args.a = a;
+    args.j = j;
+    args.lena = lena;
+
+    res.P = P;
+    res.Q = *Q;
+    res.T = T;
+
+    flint_parallel_binary_splitting(&res,
+        (bsplit_basecase_func_t) bsplit_basecase,
+        (bsplit_merge_func_t) bsplit_merge,
+        sizeof(bsplit_res_t),
+        (bsplit_init_func_t) bsplit_init,
+        (bsplit_clear_func_t) bsplit_clear,
+        &args, lo, hi, 16, -1, FLINT_PARALLEL_BSPLIT_LEFT_INPLACE);
+
+    *Q = res.Q;
+}
+
 static void
 _qadic_exp_bsplit(fmpz *y, const fmpz *x, slong v, slong len,
                   const fmpz *a, const slong *j, slong lena,
@@ -100,7 +205,11 @@ _qadic_exp_bsplit(fmpz *y, const fmpz *x, slong v, slong len,
         fmpz_init(Q);
         fmpz_init(R);
 
-        _qadic_exp_bsplit_series(P, Q, T, x, len, 1, n, a, j, lena);
+        if (flint_get_num_threads() > 1 && n > 32 && (n - 1) * d *
+            FLINT_ABS(_fmpz_vec_max_bits(x, len)) > PADIC_BSPLIT_THREAD_CUTOFF)
+            _qadic_exp_bsplit_series_threaded(P, Q, T, x, len, 1, n, a, j, lena);
+        else
+            _qadic_exp_bsplit_series(P, Q, T, x, len, 1, n, a, j, lena);
 
         fmpz_add(T + 0, T + 0, Q);  /* (T,Q) := (T,Q) + 1 */
 
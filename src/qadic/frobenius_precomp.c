@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "fmpz_vec.h"
+#include "qadic.h"
+
+typedef struct
+{
+    fmpz * rop;
+    const fmpz * op;
+    slong len;
+    const fmpz * mat;
+    slong d;
+    const fmpz * pN;
+    slong num;
+}
+work_t;
+
+/* Columns [c0, c1) of the product of (op, len) with the matrix */
+static void
+worker(slong i, work_t * work)
+{
+    const slong d = work->d;
+    slong c0, c1, k;
+
+    c0 = (i * d) / work->num;
+    c1 = ((i + 1) * d) / work->num;
+
+    _fmpz_vec_zero(work->rop + c0, c1 - c0);
+
+    for (k = 0; k < work->len; k++)
+        if (!fmpz_is_zero(work->op + k))
+            _fmpz_vec_scalar_addmul_fmpz(work->rop + c0,
+                work->mat + k * d + c0, c1 - c0, work->op + k);
+
+    _fmpz_vec_scalar_mod_fmpz(work->rop + c0, work->rop + c0, c1 - c0, work->pN);
+}
+
+void _qadic_frobenius_precomp(fmpz *rop, const fmpz *op, slong len,
+                              const fmpz *mat, slong d, const fmpz_t pN)
+{
+    work_t work;
+
+    work.rop = rop;
+    work.op = op;
+    work.len = len;
+    work.mat = mat;
+    work.d = d;
+    work.pN = pN;
+
+    if (flint_get_num_threads() > 1 && d >= 16 &&
+        len * d * fmpz_bits(pN) > QADIC_FROBENIUS_THREAD_CUTOFF)
+        work.num = FLINT_MIN(flint_get_num_threads(), d / 8);
+    else
+        work.num = 1;
+
+    flint_parallel_do((do_func_t) worker, &work, work.num, -1, FLINT_PARALLEL_UNIFORM);
+}
+
+void qadic_frobenius_precomp(qadic_t rop, const qadic_t op,
+                       const qadic_frobenius_precomp_t F, const qadic_ctx_t ctx)
+{
+    const slong N = qadic_prec(rop);
+    const slong d = qadic_ctx_degree(ctx);
+
+    if (qadic_is_zero(op) || op->val >= N)
+    {
+        qadic_zero(rop);
+    }
+    else if (F->e == 0)
+    {
+        padic_poly_set(rop, op, &ctx->pctx);
+    }
+    else if (N - op->val > F->N)
+    {
+        qadic_frobenius(rop, op, F->e, ctx);
+    }
+    else
+    {
+        fmpz *t;
+        fmpz_t pN;
+        int alloc;
+
+        t = _fmpz_vec_init(d);
+        alloc = _padic_ctx_pow_ui(pN, N - op->val, &ctx->pctx);
+
+        _qadic_frobenius_precomp(t, op->coeffs, op->length, F->mat, d, pN);
+
+        padic_poly_fit_length(rop, d);
+        _fmpz_vec_swap(rop->coeffs, t, d);
+        rop->val = op->val;
+        _padic_poly_set_length(rop, d);
+        _padic_poly_normalise(rop);
+
+        _fmpz_vec_clear(t, d);
+        if (alloc)
+            fmpz_clear(pN);
+    }
+}
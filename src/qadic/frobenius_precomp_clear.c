@@ -0,0 +1,19 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_vec.h"
+#include "qadic.h"
+
+void qadic_frobenius_precomp_clear(qadic_frobenius_precomp_t F)
+{
+    if (F->mat != NULL)
+        _fmpz_vec_clear(F->mat, F->d * F->d);
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "qadic.h"
+
+void _qadic_frobenius_precomp_init(fmpz *mat, slong e,
+                                   const fmpz *a, const slong *j, slong lena,
+                                   const fmpz_t p, slong N)
+{
+    const slong d = j[lena - 1];
+
+    slong i;
+    fmpz *t;
+    fmpz_t pN;
+
+    t = _fmpz_vec_init(2*d - 1);
+    fmpz_init(pN);
+    fmpz_pow_ui(pN, p, N);
+
+    fmpz_one(mat + 0);
+
+    if (N == 1)
+    {
+        fmpz op[2] = {WORD(0), WORD(1)};
+        fmpz_t pe;
+
+        /* _qadic_pow needs 2d - 1 output coefficients */
+        fmpz_init(pe);
+        fmpz_pow_ui(pe, p, e);
+        _qadic_pow(t, op, 2, pe, a, j, lena, p);
+        fmpz_clear(pe);
+    }
+    else
+    {
+        _qadic_frobenius_a(t, e, a, j, lena, p, N);
+    }
+
+    _fmpz_vec_set(mat + d, t, d);
+
+    for (i = 2; i < d; i++)
+    {
+        _fmpz_poly_mul(t, mat + (i - 1) * d, d, mat + d, d);
+        _fmpz_poly_reduce(t, 2*d - 1, a, j, lena);
+        _fmpz_vec_scalar_mod_fmpz(mat + i * d, t, d, pN);
+    }
+
+    _fmpz_vec_clear(t, 2*d - 1);
+    fmpz_clear(pN);
+}
+
+void qadic_frobenius_precomp_init(qadic_frobenius_precomp_t F, slong e,
+                                  slong N, const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+
+    e = e % d;
+    if (e < 0)
+        e += d;
+
+    F->d = d;
+    F->e = e;
+    F->N = FLINT_MAX(N, 1);
+
+    if (e == 0)
+    {
+        F->mat = NULL;
+    }
+    else
+    {
+        F->mat = _fmpz_vec_init(d * d);
+        _qadic_frobenius_precomp_init(F->mat, e, ctx->a, ctx->j, ctx->len,
+                                      (&ctx->pctx)->p, F->N);
+    }
+}
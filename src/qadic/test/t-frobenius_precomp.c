@@ -0,0 +1,187 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("frobenius_precomp... ");
+    fflush(stdout);
+
+    /* Compare with qadic_frobenius, with aliasing */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, M, e;
+        qadic_ctx_t ctx;
+        qadic_frobenius_precomp_t F;
+
+        qadic_t a, b, c;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = z_randint(state, 50) + 1;
+        M = n_randint(state, 60) + 1;
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        qadic_init2(a, N);
+        qadic_init2(b, N);
+        qadic_init2(c, N);
+
+        qadic_randtest(a, state, ctx);
+        e = z_randint(state, 20);
+
+        qadic_frobenius_precomp_init(F, e, M, ctx);
+
+        qadic_frobenius(b, a, e, ctx);
+        qadic_set(c, a, ctx);
+        qadic_frobenius_precomp(c, c, F, ctx);
+
+        result = (qadic_equal(b, c));
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("e = %wd, M = %wd\n", e, M);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        qadic_frobenius_precomp_clear(F);
+
+        qadic_clear(a);
+        qadic_clear(b);
+        qadic_clear(c);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    /* Degree 2 at precision 1, where the matrix fills the whole buffer */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        qadic_ctx_t ctx;
+        qadic_frobenius_precomp_t F;
+
+        qadic_t a, b, c;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 4), 1));
+        qadic_ctx_init_conway(ctx, p, 2, 0, 1, "a", PADIC_SERIES);
+
+        qadic_init2(a, 1);
+        qadic_init2(b, 1);
+        qadic_init2(c, 1);
+
+        qadic_randtest_int(a, state, ctx);
+
+        qadic_frobenius_precomp_init(F, 1, 1, ctx);
+
+        qadic_frobenius(b, a, 1, ctx);
+        qadic_frobenius_precomp(c, a, F, ctx);
+
+        result = (qadic_equal(b, c));
+        if (!result)
+        {
+            flint_printf("FAIL (d = 2, N = 1):\n\n");
+            flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        qadic_frobenius_precomp_clear(F);
+
+        qadic_clear(a);
+        qadic_clear(b);
+        qadic_clear(c);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    /* Check that sigma^e is multiplicative at larger sizes */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, e;
+        qadic_ctx_t ctx;
+        qadic_frobenius_precomp_t F;
+
+        qadic_t a, b, c, x, y;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 5), 1));
+        d = n_randint(state, 40) + 1;
+        N = n_randint(state, 400) + 1;
+        qadic_ctx_init(ctx, p, d, 0, 0, "a", PADIC_SERIES);
+
+        qadic_init2(a, N);
+        qadic_init2(b, N);
+        qadic_init2(c, N);
+        qadic_init2(x, N);
+        qadic_init2(y, N);
+
+        qadic_randtest_int(a, state, ctx);
+        qadic_randtest_int(b, state, ctx);
+        e = n_randint(state, d);
+
+        qadic_frobenius_precomp_init(F, e, N, ctx);
+
+        qadic_mul(c, a, b, ctx);
+        qadic_frobenius_precomp(c, c, F, ctx);
+        qadic_frobenius_precomp(x, a, F, ctx);
+        qadic_frobenius_precomp(y, b, F, ctx);
+        qadic_mul(x, x, y, ctx);
+
+        result = (qadic_equal(c, x));
+        if (!result)
+        {
+            flint_printf("FAIL (multiplicative):\n\n");
+            flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("x = "), qadic_print_pretty(x, ctx), flint_printf("\n");
+            flint_printf("e = %wd\n", e);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        qadic_frobenius_precomp_clear(F);
+
+        qadic_clear(a);
+        qadic_clear(b);
+        qadic_clear(c);
+        qadic_clear(x);
+        qadic_clear(y);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
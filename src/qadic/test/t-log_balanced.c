@@ -187,9 +187,59 @@ main(void)
         qadic_ctx_clear(ctx);
     }
 
+    /* Check that the threaded evaluation agrees at high precision */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N;
+        qadic_ctx_t ctx;
+
+        qadic_t a, b, c;
+        int ans1, ans2;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 5) + 1;
+        N = 500 + n_randint(state, 1000);
+        qadic_ctx_init_conway(ctx, p, d, 0, 0, "a", PADIC_SERIES);
+
+        qadic_init2(a, N);
+        qadic_init2(b, N);
+        qadic_init2(c, N);
+
+        qadic_randtest_val(a, state, fmpz_equal_ui(p, 2) ? 2 : 1, ctx);
+        qadic_one(b);
+        qadic_add(a, a, b, ctx);
+
+        flint_set_num_threads(1);
+        ans1 = qadic_log_balanced(b, a, ctx);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        ans2 = qadic_log_balanced(c, a, ctx);
+
+        result = ((ans1 == ans2) && (!ans1 || qadic_equal(b, c)));
+        if (!result)
+        {
+            flint_printf("FAIL (threads):\n\n");
+            flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("ans1 = %d\n", ans1);
+            flint_printf("ans2 = %d\n", ans2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        qadic_clear(a);
+        qadic_clear(b);
+        qadic_clear(c);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
+    flint_cleanup_master();
     return 0;
 }
 
@@ -134,6 +134,65 @@ void qfb_pow(qfb_t r, qfb_t f, fmpz_t D, fmpz_t exp);
 
 void qfb_pow_with_root(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e, fmpz_t L);
 
+#define QFB_CTX_NUM_TMP 24
+
+typedef struct
+{
+   fmpz_t D;
+   fmpz_t L;                   /* floor(|D|^(1/4)) */
+   fmpz tmp[QFB_CTX_NUM_TMP];  /* workspace for composition and reduction */
+   qfb * table;                /* workspace for powering */
+   slong table_alloc;
+} qfb_ctx_struct;
+
+typedef qfb_ctx_struct qfb_ctx_t[1];
+
+void qfb_ctx_init(qfb_ctx_t ctx, const fmpz_t D);
+
+void qfb_ctx_clear(qfb_ctx_t ctx);
+
+void qfb_ctx_reduce(qfb_t r, const qfb_t f, qfb_ctx_t ctx);
+
+void qfb_ctx_nucomp(qfb_t r, const qfb_t f, const qfb_t g, qfb_ctx_t ctx);
+
+void qfb_ctx_nudupl(qfb_t r, const qfb_t f, qfb_ctx_t ctx);
+
+QFB_INLINE
+void qfb_ctx_mul(qfb_t r, const qfb_t f, const qfb_t g, qfb_ctx_t ctx)
+{
+   qfb_ctx_nucomp(r, f, g, ctx);
+   qfb_ctx_reduce(r, r, ctx);
+}
+
+QFB_INLINE
+void qfb_ctx_sqr(qfb_t r, const qfb_t f, qfb_ctx_t ctx)
+{
+   qfb_ctx_nudupl(r, f, ctx);
+   qfb_ctx_reduce(r, r, ctx);
+}
+
+void qfb_ctx_pow(qfb_t r, const qfb_t f, const fmpz_t e, qfb_ctx_t ctx);
+
+typedef struct
+{
+   qfb * powers;               /* f^(2^(w i)) for 0 <= i < num */
+   slong num;
+   slong w;
+} qfb_pow_table_struct;
+
+typedef qfb_pow_table_struct qfb_pow_table_t[1];
+
+void qfb_pow_table_init(qfb_pow_table_t T, const qfb_t f,
+                                               flint_bitcnt_t bits, qfb_ctx_t ctx);
+
+void qfb_pow_table_clear(qfb_pow_table_t T);
+
+void qfb_ctx_pow_precomp(qfb_t r, const qfb_pow_table_t T,
+                                               const fmpz_t e, qfb_ctx_t ctx);
+
+void qfb_pow_vec(qfb * r, const qfb * f, slong len,
+                                             const fmpz_t e, const fmpz_t D);
+
 QFB_INLINE
 void qfb_inverse(qfb_t r, qfb_t f)
 {
@@ -195,6 +254,8 @@ int qfb_exponent(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt, slong c);
 
 int qfb_exponent_grh(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt);
 
+slong qfb_class_group(fmpz ** invariants, fmpz_t h, const fmpz_t D);
+
 #ifdef __cplusplus
 }
 #endif
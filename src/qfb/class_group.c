@@ -0,0 +1,1101 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "thread_support.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_mat.h"
+#include "fmpz_mat.h"
+#include "qfb.h"
+
+/*
+    Subexponential computation of the class group of primitive forms of
+    discriminant D < 0, following Hafner-McCurley and Jacobson.
+
+    The factor base consists of the prime ideals p = [p, (b_p + sqrt(D))/2]
+    of norm p <= B which are invertible, and their conjugates, represented
+    by -1 times the same generator. Relations are found as in the self
+    initialising quadratic sieve: for a = p_1 ... p_k, a product of factor
+    base primes, and b^2 = D mod 4a, the ideal a = [a, (b + sqrt(D))/2] is
+    the product of the p_i or their conjugates according to b mod p_i. The
+    element alpha = a x + (b + sqrt(D))/2 of a has norm a f(x), where
+    f(x) = a x^2 + b x + c, so that if f(x) factors over the factor base,
+    the ideal (alpha)/a of norm f(x) gives a relation. The prime ideal
+    above p dividing it is the one containing alpha, i.e. p or its
+    conjugate according to whether 2 a x + b = b_p mod 2p.
+
+    Relations with one large prime are combined in pairs. The relation
+    lattice is reduced by eliminating generators which occur with a
+    coefficient of +-1, and the remaining dense lattice is put in Hermite
+    normal form modulo the gcd of the determinants of two full rank
+    submatrices, which is a multiple of the index. The
+    resulting index is accepted if it is within a factor sqrt(2) of the
+    estimate of the class number given by a truncated Euler product,
+    which, under the usual heuristics, proves that it is the class number.
+*/
+
+/* primes below this are not sieved */
+#define QFB_CG_SIEVE_START 7
+
+/* bound for the Euler product estimate of the class number */
+#define QFB_CG_EULER_BOUND 200000
+
+typedef struct
+{
+    const fmpz * D;
+    slong num;          /* number of factor base primes */
+    ulong * primes;
+    ulong * roots;      /* square root of D mod p */
+    ulong * bp;         /* b_p mod 2p, with b_p = D mod 2 */
+    int * ramified;
+    unsigned char * logp;
+    slong * pool;       /* indices of the primes used in a */
+    slong pool_num;
+    slong k;            /* number of primes in a */
+    double a_target;
+    ulong LP;           /* large prime bound */
+    slong M;            /* sieve interval is [-M, M) */
+}
+qfb_cg_fb_struct;
+
+typedef qfb_cg_fb_struct qfb_cg_fb_t[1];
+
+/*
+    Relations are stored as lists of (index, exponent) pairs. The large
+    prime of a partial relation is q with the ideal sign qsign, and q = 1
+    for full relations.
+*/
+typedef struct
+{
+    slong num;
+    slong alloc;
+    slong * start;
+    ulong * q;
+    int * qsign;
+    slong len;
+    slong len_alloc;
+    slong * idx;
+    slong * exp;
+}
+qfb_cg_rels_struct;
+
+typedef qfb_cg_rels_struct qfb_cg_rels_t[1];
+
+static void
+qfb_cg_rels_init(qfb_cg_rels_t R)
+{
+    R->num = R->alloc = 0;
+    R->len = R->len_alloc = 0;
+    R->start = flint_malloc(sizeof(slong));
+    R->start[0] = 0;
+    R->q = NULL;
+    R->qsign = NULL;
+    R->idx = NULL;
+    R->exp = NULL;
+}
+
+static void
+qfb_cg_rels_clear(qfb_cg_rels_t R)
+{
+    flint_free(R->start);
+    flint_free(R->q);
+    flint_free(R->qsign);
+    flint_free(R->idx);
+    flint_free(R->exp);
+}
+
+static void
+qfb_cg_rels_push(qfb_cg_rels_t R, const slong * idx, const slong * exp,
+                 slong len, ulong q, int qsign)
+{
+    slong i;
+
+    if (R->num == R->alloc)
+    {
+        R->alloc = FLINT_MAX(16, 2 * R->alloc);
+        R->start = flint_realloc(R->start, sizeof(slong) * (R->alloc + 1));
+        R->q = flint_realloc(R->q, sizeof(ulong) * R->alloc);
+        R->qsign = flint_realloc(R->qsign, sizeof(int) * R->alloc);
+    }
+
+    if (R->len + len > R->len_alloc)
+    {
+        R->len_alloc = FLINT_MAX(R->len + len, 2 * R->len_alloc);
+        R->idx = flint_realloc(R->idx, sizeof(slong) * R->len_alloc);
+        R->exp = flint_realloc(R->exp, sizeof(slong) * R->len_alloc);
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        R->idx[R->len + i] = idx[i];
+        R->exp[R->len + i] = exp[i];
+    }
+
+    R->len += len;
+    R->q[R->num] = q;
+    R->qsign[R->num] = qsign;
+    R->num++;
+    R->start[R->num] = R->len;
+}
+
+static void
+qfb_cg_rels_append(qfb_cg_rels_t R, const qfb_cg_rels_t S)
+{
+    slong i;
+
+    for (i = 0; i < S->num; i++)
+        qfb_cg_rels_push(R, S->idx + S->start[i], S->exp + S->start[i],
+                         S->start[i + 1] - S->start[i], S->q[i], S->qsign[i]);
+}
+
+/* Factor base of the num invertible prime ideals of smallest norm. */
+static void
+qfb_cg_fb_init(qfb_cg_fb_t F, const fmpz_t D, slong num)
+{
+    n_primes_t iter;
+    ulong p, d, r, dm8, dm16;
+    slong alloc, i, k;
+    double t;
+
+    F->D = D;
+    F->num = 0;
+    alloc = 64;
+    F->primes = flint_malloc(sizeof(ulong) * alloc);
+    F->roots = flint_malloc(sizeof(ulong) * alloc);
+    F->bp = flint_malloc(sizeof(ulong) * alloc);
+    F->ramified = flint_malloc(sizeof(int) * alloc);
+
+    dm8 = fmpz_fdiv_ui(D, 8);
+    dm16 = fmpz_fdiv_ui(D, 16);
+
+    n_primes_init(iter);
+
+    for (p = n_primes_next(iter); F->num < num; p = n_primes_next(iter))
+    {
+        int ram;
+
+        if (p == 2)
+        {
+            if (dm8 == 1)
+            {
+                r = 1;
+                ram = 0;
+            }
+            else if (dm16 == 8 || dm16 == 12)
+            {
+                r = (dm16 == 12) ? 2 : 0;
+                ram = 1;
+            }
+            else
+                continue;
+        }
+        else
+        {
+            d = fmpz_fdiv_ui(D, p);
+
+            if (d == 0)
+            {
+                /* p must not divide the conductor */
+                if (fmpz_fdiv_ui(D, p * p) == 0)
+                    continue;
+
+                r = 0;
+                ram = 1;
+            }
+            else if (n_jacobi(d, p) == 1)
+            {
+                r = n_sqrtmod(d, p);
+                ram = 0;
+            }
+            else
+                continue;
+        }
+
+        if (F->num == alloc)
+        {
+            alloc *= 2;
+            F->primes = flint_realloc(F->primes, sizeof(ulong) * alloc);
+            F->roots = flint_realloc(F->roots, sizeof(ulong) * alloc);
+            F->bp = flint_realloc(F->bp, sizeof(ulong) * alloc);
+            F->ramified = flint_realloc(F->ramified, sizeof(int) * alloc);
+        }
+
+        F->primes[F->num] = p;
+        F->roots[F->num] = r;
+        F->ramified[F->num] = ram;
+
+        if (p == 2)
+            F->bp[F->num] = r;
+        else if ((r & 1) == (dm8 & 1))
+            F->bp[F->num] = r;
+        else
+            F->bp[F->num] = r + p;
+
+        F->num++;
+    }
+
+    n_primes_clear(iter);
+
+    F->logp = flint_malloc(F->num);
+    for (i = 0; i < F->num; i++)
+        F->logp[i] = (unsigned char) (log(F->primes[i]) / log(2.0) + 0.5);
+
+    /* primes for a: odd and split, of size about a_target^(1/k) */
+    F->pool = flint_malloc(sizeof(slong) * F->num);
+    p = FLINT_MIN(2000, F->primes[F->num - 1] / 2);
+    t = F->a_target;
+    F->k = 1;
+    if (t > 3.0)
+        F->k = FLINT_MAX(1, (slong) ceil(log(t) / log(FLINT_MAX(p, 7))));
+    t = pow(FLINT_MAX(t, 1.0), 1.0 / F->k);
+
+    /* large primes are below B^2, so that the cofactors are prime */
+    p = F->primes[F->num - 1];
+    F->LP = FLINT_MIN(60 * p, p * p - 1);
+
+    for (k = 0; k < 2; k++)
+    {
+        F->pool_num = 0;
+        for (i = 0; i < F->num; i++)
+        {
+            p = F->primes[i];
+
+            if (p >= QFB_CG_SIEVE_START && !F->ramified[i] &&
+                (k == 1 || (p >= t / 2 && p <= 2 * t)))
+                F->pool[F->pool_num++] = i;
+        }
+
+        if (F->pool_num >= 2 * F->k + 8)
+            break;
+    }
+}
+
+static void
+qfb_cg_fb_clear(qfb_cg_fb_t F)
+{
+    flint_free(F->primes);
+    flint_free(F->roots);
+    flint_free(F->bp);
+    flint_free(F->ramified);
+    flint_free(F->logp);
+    flint_free(F->pool);
+}
+
+typedef struct
+{
+    const qfb_cg_fb_struct * F;
+    qfb_cg_rels_struct * rels;
+    ulong seed;
+    slong polys;
+}
+qfb_cg_sieve_arg_t;
+
+/* Sieves over the polynomials for one random value of a. */
+static void
+qfb_cg_sieve_a(qfb_cg_rels_t R, const qfb_cg_fb_t F, flint_rand_t state)
+{
+    const fmpz * D = F->D;
+    slong i, j, l, k, n, M, len, thresh, num_b, sgn;
+    slong * aidx, * s1, * s2, * idx, * exp;
+    int * eps;
+    unsigned char * sieve;
+    fmpz_t a, b, c, t, fx, u;
+    fmpz * Bi;
+    ulong p, ainv, bm, x1, x2, q;
+
+    k = F->k;
+    n = F->num;
+    M = F->M;
+
+    aidx = flint_malloc(sizeof(slong) * k);
+    eps = flint_malloc(sizeof(int) * k);
+    s1 = flint_malloc(sizeof(slong) * n);
+    s2 = flint_malloc(sizeof(slong) * n);
+    idx = flint_malloc(sizeof(slong) * (n + k));
+    exp = flint_malloc(sizeof(slong) * (n + k));
+    sieve = flint_malloc(2 * M);
+    Bi = _fmpz_vec_init(k);
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(c);
+    fmpz_init(t);
+    fmpz_init(fx);
+    fmpz_init(u);
+
+    /* a = product of k distinct primes from the pool, the last one chosen
+       to bring a close to the target */
+    fmpz_one(a);
+    for (i = 0; i < k; i++)
+    {
+        if (i == k - 1 && k > 1)
+        {
+            double target = F->a_target / fmpz_get_d(a);
+            slong lo = 0, hi = F->pool_num - 1;
+
+            while (lo < hi)
+            {
+                slong mid = (lo + hi) / 2;
+
+                if ((double) F->primes[F->pool[mid]] < target)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+
+            j = lo;
+            for (l = 0; l < i; l++)
+            {
+                if (aidx[l] == F->pool[j])
+                {
+                    j = n_randint(state, F->pool_num);
+                    l = -1;
+                }
+            }
+        }
+        else
+        {
+            do
+            {
+                j = n_randint(state, F->pool_num);
+                for (l = 0; l < i && aidx[l] != F->pool[j]; l++) ;
+            } while (l < i);
+        }
+
+        aidx[i] = F->pool[j];
+        fmpz_mul_ui(a, a, F->primes[aidx[i]]);
+    }
+
+    /* B_i = r_i mod p_i and 0 mod p_j, j != i */
+    for (i = 0; i < k; i++)
+    {
+        p = F->primes[aidx[i]];
+        fmpz_divexact_ui(t, a, p);
+        x1 = n_invmod(fmpz_fdiv_ui(t, p), p);
+        x1 = n_mulmod2_preinv(x1, F->roots[aidx[i]], p, n_preinvert_limb(p));
+        fmpz_mul_ui(Bi + i, t, x1);
+    }
+
+    num_b = WORD(1) << (k - 1);
+
+    for (sgn = 0; sgn < num_b; sgn++)
+    {
+        fmpz_set(b, Bi + k - 1);
+        for (i = 0; i < k - 1; i++)
+        {
+            if ((sgn >> i) & 1)
+                fmpz_sub(b, b, Bi + i);
+            else
+                fmpz_add(b, b, Bi + i);
+        }
+
+        if (fmpz_is_odd(b) != fmpz_is_odd(D))
+            fmpz_add(b, b, a);
+
+        for (i = 0; i < k; i++)
+        {
+            p = F->primes[aidx[i]];
+            eps[i] = (fmpz_fdiv_ui(b, p) == F->bp[aidx[i]] % p) ? 1 : -1;
+        }
+
+        fmpz_mul(c, b, b);
+        fmpz_sub(c, c, D);
+        fmpz_divexact(c, c, a);
+        fmpz_fdiv_q_2exp(c, c, 2);
+
+        /* sieve */
+        memset(sieve, 0, 2 * M);
+
+        for (j = 0; j < n; j++)
+        {
+            p = F->primes[j];
+
+            s1[j] = s2[j] = -1;
+
+            if (p < QFB_CG_SIEVE_START || fmpz_fdiv_ui(a, p) == 0)
+                continue;
+
+            ainv = n_invmod(fmpz_fdiv_ui(a, p) * 2 % p, p);
+            bm = fmpz_fdiv_ui(b, p);
+            x1 = n_mulmod2_preinv(n_submod(F->roots[j], bm, p), ainv, p,
+                                                   n_preinvert_limb(p));
+            x2 = n_mulmod2_preinv(n_submod(n_negmod(F->roots[j], p), bm, p),
+                                        ainv, p, n_preinvert_limb(p));
+
+            s1[j] = (x1 + M) % p;
+            s2[j] = (x2 + M) % p;
+
+            for (l = s1[j]; l < 2 * M; l += p)
+                sieve[l] += F->logp[j];
+
+            if (s2[j] != s1[j])
+                for (l = s2[j]; l < 2 * M; l += p)
+                    sieve[l] += F->logp[j];
+        }
+
+        /* f(x) >= c - b^2/(4a) = |D|/(4a) on the whole interval */
+        fmpz_mul_2exp(t, a, 2);
+        fmpz_tdiv_q(t, D, t);
+        thresh = (slong) fmpz_bits(t) - (slong) FLINT_BIT_COUNT(F->LP) - 3;
+        thresh = FLINT_MAX(thresh, 0);
+
+        for (l = 0; l < 2 * M; l++)
+        {
+            slong x;
+            int ok;
+
+            if (sieve[l] < thresh)
+                continue;
+
+            x = l - M;
+
+            fmpz_mul_si(fx, a, x);
+            fmpz_add(fx, fx, b);
+            fmpz_mul_si(fx, fx, x);
+            fmpz_add(fx, fx, c);
+
+            /* u = 2 a x + b */
+            fmpz_mul_si(u, a, 2 * x);
+            fmpz_add(u, u, b);
+
+            ok = 1;
+            for (i = 0; i < k && ok; i++)
+                ok = (fmpz_fdiv_ui(fx, F->primes[aidx[i]]) != 0);
+
+            if (!ok)
+                continue;
+
+            len = 0;
+
+            for (j = 0; j < n; j++)
+            {
+                slong e;
+                ulong r;
+
+                p = F->primes[j];
+
+                if (s1[j] >= 0)
+                {
+                    r = l % p;
+                    if (r != (ulong) s1[j] && r != (ulong) s2[j])
+                        continue;
+                }
+                else if (fmpz_fdiv_ui(fx, p) != 0)
+                    continue;
+
+                for (e = 0; fmpz_divisible_si(fx, p); e++)
+                    fmpz_divexact_ui(fx, fx, p);
+
+                if (e == 0)
+                    continue;
+
+                if (!F->ramified[j] && fmpz_fdiv_ui(u, 2 * p) != F->bp[j])
+                    e = -e;
+
+                idx[len] = j;
+                exp[len] = e;
+                len++;
+            }
+
+            if (fmpz_is_one(fx))
+            {
+                q = 1;
+            }
+            else if (fmpz_cmp_ui(fx, F->LP) <= 0 &&
+                     n_gcd(fmpz_fdiv_ui(D, fmpz_get_ui(fx)), fmpz_get_ui(fx)) == 1)
+            {
+                /* all prime factors exceed B, hence q < B^2 is prime */
+                q = fmpz_get_ui(fx);
+            }
+            else
+                continue;
+
+            /* (alpha) = a b, where a is the product of the p_i^eps_i */
+            for (i = 0; i < k; i++)
+            {
+                idx[len] = aidx[i];
+                exp[len] = eps[i];
+                len++;
+            }
+
+            /* sort by index */
+            for (i = 1; i < len; i++)
+            {
+                slong ti = idx[i], te = exp[i];
+
+                for (j = i - 1; j >= 0 && idx[j] > ti; j--)
+                {
+                    idx[j + 1] = idx[j];
+                    exp[j + 1] = exp[j];
+                }
+                idx[j + 1] = ti;
+                exp[j + 1] = te;
+            }
+
+            if (q == 1)
+            {
+                qfb_cg_rels_push(R, idx, exp, len, 1, 1);
+            }
+            else
+            {
+                ulong rq = n_sqrtmod(fmpz_fdiv_ui(D, q), q);
+
+                rq = FLINT_MIN(rq, q - rq);
+                qfb_cg_rels_push(R, idx, exp, len, q,
+                                 (fmpz_fdiv_ui(u, q) == rq) ? 1 : -1);
+            }
+        }
+    }
+
+    flint_free(aidx);
+    flint_free(eps);
+    flint_free(s1);
+    flint_free(s2);
+    flint_free(idx);
+    flint_free(exp);
+    flint_free(sieve);
+    _fmpz_vec_clear(Bi, k);
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(c);
+    fmpz_clear(t);
+    fmpz_clear(fx);
+    fmpz_clear(u);
+}
+
+static void
+qfb_cg_sieve_worker(slong i, qfb_cg_sieve_arg_t * arg)
+{
+    flint_rand_t state;
+    slong j;
+
+    flint_randinit(state);
+    flint_randseed(state, arg[i].seed, arg[i].seed ^ UWORD(0x9e3779b97f4a7c15));
+
+    for (j = 0; j < arg[i].polys; j++)
+        qfb_cg_sieve_a(arg[i].rels, arg[i].F, state);
+
+    flint_randclear(state);
+}
+
+typedef struct
+{
+    ulong q;
+    slong i;
+}
+qfb_cg_partial_t;
+
+static int
+qfb_cg_partial_cmp(const void * x, const void * y)
+{
+    const qfb_cg_partial_t * a = x;
+    const qfb_cg_partial_t * b = y;
+
+    if (a->q != b->q)
+        return (a->q > b->q) ? 1 : -1;
+
+    return (a->i > b->i) - (a->i < b->i);
+}
+
+/* Adds c times the relation i of R to the row v. */
+static void
+qfb_cg_rels_add_row(fmpz * v, const qfb_cg_rels_t R, slong i, slong c)
+{
+    slong j;
+
+    for (j = R->start[i]; j < R->start[i + 1]; j++)
+        fmpz_add_si(v + R->idx[j], v + R->idx[j], c * R->exp[j]);
+}
+
+/*
+    Sorts the partial relations of R by large prime into P, and returns the
+    number of full relations, including those from pairs of partials.
+*/
+static slong
+qfb_cg_rels_count(qfb_cg_partial_t * P, slong * num, const qfb_cg_rels_t R)
+{
+    slong i, count;
+
+    *num = 0;
+    count = 0;
+
+    for (i = 0; i < R->num; i++)
+    {
+        if (R->q[i] == 1)
+        {
+            count++;
+        }
+        else
+        {
+            P[*num].q = R->q[i];
+            P[*num].i = i;
+            (*num)++;
+        }
+    }
+
+    qsort(P, *num, sizeof(qfb_cg_partial_t), qfb_cg_partial_cmp);
+
+    for (i = 1; i < *num; i++)
+        if (P[i].q == P[i - 1].q)
+            count++;
+
+    return count;
+}
+
+/* Relation matrix, with the partial relations combined in pairs. */
+static void
+qfb_cg_rels_matrix(fmpz_mat_t A, const qfb_cg_rels_t R, const qfb_cg_fb_t F)
+{
+    slong i, num, np, row, first;
+    qfb_cg_partial_t * P;
+
+    P = flint_malloc(sizeof(qfb_cg_partial_t) * FLINT_MAX(R->num, 1));
+    num = qfb_cg_rels_count(P, &np, R);
+
+    for (i = 0; i < F->num; i++)
+        if (F->ramified[i])
+            num++;
+
+    fmpz_mat_init(A, num, F->num);
+
+    row = 0;
+
+    for (i = 0; i < R->num; i++)
+        if (R->q[i] == 1)
+            qfb_cg_rels_add_row(A->rows[row++], R, i, 1);
+
+    for (i = 0; i < F->num; i++)
+        if (F->ramified[i])
+            fmpz_set_ui(A->rows[row++] + i, 2);
+
+    /* the large prime cancels in r_first - s_first s_i r_i */
+    for (i = 1, first = 0; i < np; i++)
+    {
+        if (P[i].q == P[first].q)
+        {
+            qfb_cg_rels_add_row(A->rows[row], R, P[first].i, 1);
+            qfb_cg_rels_add_row(A->rows[row], R, P[i].i,
+                          -R->qsign[P[first].i] * R->qsign[P[i].i]);
+            row++;
+        }
+        else
+            first = i;
+    }
+
+    flint_free(P);
+}
+
+/*
+    Eliminates generators which occur with coefficient +-1 in some relation,
+    which does not change the quotient Z^n / L. Returns the remaining rows
+    and columns in A, dropping zero rows.
+*/
+static void
+qfb_cg_eliminate(fmpz_mat_t A)
+{
+    slong m, n, i, j, r, best, w, bestw, nr, nc;
+    int * row_active, * col_active;
+    fmpz_t c;
+    fmpz_mat_t B;
+    int progress;
+
+    m = A->r;
+    n = A->c;
+
+    row_active = flint_malloc(sizeof(int) * FLINT_MAX(m, 1));
+    col_active = flint_malloc(sizeof(int) * FLINT_MAX(n, 1));
+
+    for (i = 0; i < m; i++)
+        row_active[i] = !_fmpz_vec_is_zero(A->rows[i], n);
+    for (j = 0; j < n; j++)
+        col_active[j] = 1;
+
+    fmpz_init(c);
+
+    do
+    {
+        progress = 0;
+
+        /* the columns of large primes are the sparsest */
+        for (j = n - 1; j >= 0; j--)
+        {
+            if (!col_active[j])
+                continue;
+
+            /* sparsest row with a unit in column j */
+            best = -1;
+            bestw = WORD_MAX;
+
+            for (i = 0; i < m; i++)
+            {
+                if (!row_active[i] || !fmpz_is_pm1(fmpz_mat_entry(A, i, j)))
+                    continue;
+
+                for (w = r = 0; r < n; r++)
+                    w += !fmpz_is_zero(fmpz_mat_entry(A, i, r));
+
+                if (w < bestw)
+                {
+                    best = i;
+                    bestw = w;
+                }
+            }
+
+            if (best == -1)
+                continue;
+
+            for (i = 0; i < m; i++)
+            {
+                if (i == best || !row_active[i] ||
+                    fmpz_is_zero(fmpz_mat_entry(A, i, j)))
+                    continue;
+
+                fmpz_mul(c, fmpz_mat_entry(A, i, j), fmpz_mat_entry(A, best, j));
+                _fmpz_vec_scalar_submul_fmpz(A->rows[i], A->rows[best], n, c);
+
+                if (_fmpz_vec_is_zero(A->rows[i], n))
+                    row_active[i] = 0;
+            }
+
+            row_active[best] = 0;
+            col_active[j] = 0;
+            progress = 1;
+        }
+    } while (progress);
+
+    for (nr = i = 0; i < m; i++)
+        nr += row_active[i];
+    for (nc = j = 0; j < n; j++)
+        nc += col_active[j];
+
+    fmpz_mat_init(B, nr, nc);
+
+    for (nr = i = 0; i < m; i++)
+    {
+        if (!row_active[i])
+            continue;
+
+        for (nc = j = 0; j < n; j++)
+            if (col_active[j])
+                fmpz_set(fmpz_mat_entry(B, nr, nc++), fmpz_mat_entry(A, i, j));
+
+        nr++;
+    }
+
+    fmpz_mat_swap(A, B);
+    fmpz_mat_clear(B);
+    fmpz_clear(c);
+    flint_free(row_active);
+    flint_free(col_active);
+}
+
+/*
+    Sets d to the absolute value of the determinant of n linearly
+    independent rows of A, chosen in random order. Returns 0 if A does not
+    have full rank, as determined modulo a random prime.
+*/
+static int
+qfb_cg_subdet(fmpz_t d, const fmpz_mat_t A, flint_rand_t state)
+{
+    slong i, j, t, n, rank;
+    slong * P, * perm;
+    nmod_mat_t Amod;
+    fmpz_mat_t T;
+
+    n = A->c;
+
+    perm = flint_malloc(sizeof(slong) * A->r);
+    P = flint_malloc(sizeof(slong) * A->r);
+
+    for (i = 0; i < A->r; i++)
+        perm[i] = i;
+
+    for (i = A->r - 1; i > 0; i--)
+    {
+        j = n_randint(state, i + 1);
+        t = perm[i];
+        perm[i] = perm[j];
+        perm[j] = t;
+    }
+
+    nmod_mat_init(Amod, A->r, n, n_randprime(state, FLINT_BITS - 2, 0));
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(Amod, i, j) = fmpz_fdiv_ui(fmpz_mat_entry(A, perm[i], j), Amod->mod.n);
+
+    rank = nmod_mat_lu(P, Amod, 0);
+    nmod_mat_clear(Amod);
+
+    if (rank == n)
+    {
+        fmpz_mat_init(T, n, n);
+        for (i = 0; i < n; i++)
+            _fmpz_vec_set(T->rows[i], A->rows[perm[P[i]]], n);
+
+        fmpz_mat_det(d, T);
+        fmpz_abs(d, d);
+        fmpz_mat_clear(T);
+    }
+
+    flint_free(perm);
+    flint_free(P);
+
+    return rank == n;
+}
+
+/*
+    Computes the index h and the invariants of Z^n / L for the lattice L
+    spanned by the rows of A, returning the Smith normal form in S.
+    Returns 0 if A does not have full rank.
+*/
+static int
+qfb_cg_structure(fmpz_mat_t S, fmpz_t h, fmpz_mat_t A, flint_rand_t state)
+{
+    slong i, j, k, n;
+    slong * idx;
+    fmpz_mat_t W;
+    fmpz_t d, d2;
+
+    qfb_cg_eliminate(A);
+
+    n = A->c;
+
+    if (n == 0)
+    {
+        fmpz_one(h);
+        fmpz_mat_init(S, 0, 0);
+        return 1;
+    }
+
+    if (A->r < n)
+        return 0;
+
+    fmpz_init(d);
+    fmpz_init(d2);
+
+    /* the index divides the determinant of any full rank submatrix, and
+       the gcd of two of them is usually close to it */
+    if (!qfb_cg_subdet(d, A, state) || !qfb_cg_subdet(d2, A, state))
+    {
+        fmpz_clear(d);
+        fmpz_clear(d2);
+        return 0;
+    }
+
+    fmpz_gcd(d, d, d2);
+    idx = flint_malloc(sizeof(slong) * n);
+
+    fmpz_mat_hnf_modular_eldiv(A, d);
+
+    /* the columns of the HNF with unit diagonal entry vanish above the
+       diagonal, so the corresponding generators can be dropped */
+    fmpz_one(h);
+    for (i = k = 0; i < n; i++)
+    {
+        fmpz_mul(h, h, fmpz_mat_entry(A, i, i));
+        if (!fmpz_is_one(fmpz_mat_entry(A, i, i)))
+            idx[k++] = i;
+    }
+
+    fmpz_mat_init(W, k, k);
+    for (i = 0; i < k; i++)
+        for (j = 0; j < k; j++)
+            fmpz_set(fmpz_mat_entry(W, i, j), fmpz_mat_entry(A, idx[i], idx[j]));
+
+    fmpz_mat_init(S, k, k);
+    fmpz_mat_snf(S, W);
+    fmpz_mat_clear(W);
+    flint_free(idx);
+
+    fmpz_clear(d);
+    fmpz_clear(d2);
+
+    return 1;
+}
+
+/* log of the class number estimated from the Euler product of L(1, chi_D) */
+static double
+qfb_cg_log_class_number_estimate(const fmpz_t D)
+{
+    n_primes_t iter;
+    ulong p, d;
+    double s, w;
+    int chi;
+
+    if (fmpz_equal_si(D, -3))
+        w = 6;
+    else if (fmpz_equal_si(D, -4))
+        w = 4;
+    else
+        w = 2;
+
+    s = log(w / (2 * 3.14159265358979323846)) + 0.5 * log(-fmpz_get_d(D));
+
+    n_primes_init(iter);
+
+    for (p = n_primes_next(iter); p <= QFB_CG_EULER_BOUND; p = n_primes_next(iter))
+    {
+        if (p == 2)
+        {
+            d = fmpz_fdiv_ui(D, 8);
+            chi = (d == 1) ? 1 : (d == 5) ? -1 : 0;
+        }
+        else
+        {
+            d = fmpz_fdiv_ui(D, p);
+            chi = (d == 0) ? 0 : n_jacobi(d, p);
+        }
+
+        s -= log(1.0 - chi / (double) p);
+    }
+
+    n_primes_clear(iter);
+
+    return s;
+}
+
+slong
+qfb_class_group(fmpz ** invariants, fmpz_t h, const fmpz_t D)
+{
+    qfb_cg_fb_t F;
+    qfb_cg_rels_t R;
+    qfb_cg_sieve_arg_t * args;
+    qfb_cg_rels_struct * wrels;
+    flint_rand_t state;
+    fmpz_mat_t A, S;
+    slong i, num, np, nthreads, target, have, bits;
+    qfb_cg_partial_t * P;
+    double logh, lnD;
+    slong fb_num;
+    ulong m4;
+    int done;
+
+    m4 = fmpz_fdiv_ui(D, 4);
+
+    if (fmpz_sgn(D) >= 0 || (m4 != 0 && m4 != 1))
+        flint_throw(FLINT_ERROR, "Exception (qfb_class_group). "
+                    "D must be a negative discriminant.\n");
+
+    logh = qfb_cg_log_class_number_estimate(D);
+
+    flint_randinit(state);
+
+    bits = fmpz_bits(D);
+    lnD = bits * 0.693147;
+    /* about half the primes up to L(D)^0.45 split */
+    fb_num = (slong) (exp(0.45 * sqrt(lnD * log(lnD))) / (0.45 * sqrt(lnD * log(lnD))) / 2);
+    fb_num = FLINT_MAX(fb_num, 20);
+
+    nthreads = flint_get_num_threads();
+    args = flint_malloc(sizeof(qfb_cg_sieve_arg_t) * nthreads);
+    wrels = flint_malloc(sizeof(qfb_cg_rels_struct) * nthreads);
+
+    done = 0;
+    num = 0;
+
+    while (!done)
+    {
+        F->M = (bits > 100) ? 32768 : (bits > 60) ? 16384 : (bits > 30) ? 4096 : 512;
+        F->a_target = sqrt(-fmpz_get_d(D)) / (2.0 * F->M);
+
+        qfb_cg_fb_init(F, D, fb_num);
+        qfb_cg_rels_init(R);
+
+        target = F->num + 20 + F->num / 20;
+
+        while (1)
+        {
+            /* collect relations in parallel */
+            P = flint_malloc(sizeof(qfb_cg_partial_t) * FLINT_MAX(R->num, 1));
+            have = qfb_cg_rels_count(P, &np, R);
+            flint_free(P);
+
+            if (have < target)
+            {
+                for (i = 0; i < nthreads; i++)
+                {
+                    qfb_cg_rels_init(wrels + i);
+                    args[i].F = F;
+                    args[i].rels = wrels + i;
+                    args[i].seed = n_randlimb(state);
+                    args[i].polys = 1;
+                }
+
+                flint_parallel_do((do_func_t) qfb_cg_sieve_worker, args,
+                                  nthreads, -1, FLINT_PARALLEL_STRIDED);
+
+                for (i = 0; i < nthreads; i++)
+                {
+                    qfb_cg_rels_append(R, wrels + i);
+                    qfb_cg_rels_clear(wrels + i);
+                }
+
+                continue;
+            }
+
+            qfb_cg_rels_matrix(A, R, F);
+            if (qfb_cg_structure(S, h, A, state))
+            {
+                double t = fmpz_dlog(h) - logh;
+
+                fmpz_mat_clear(A);
+
+                if (fabs(t) < 0.5 * log(2.0))
+                {
+                    done = 1;
+                    break;
+                }
+
+                fmpz_mat_clear(S);
+
+                /* the factor base does not generate the class group */
+                if (t < 0)
+                    break;
+            }
+            else
+                fmpz_mat_clear(A);
+
+            /* the polynomials only give duplicates of known relations */
+            if (target > 4 * F->num + 100)
+                break;
+
+            target += 10 + target / 10;
+        }
+
+        qfb_cg_rels_clear(R);
+        qfb_cg_fb_clear(F);
+
+        if (!done)
+            fb_num *= 2;
+    }
+
+    /* invariants d_1 | d_2 | ... with d_1 > 1 */
+    for (i = 0; i < S->r; i++)
+        if (!fmpz_is_one(fmpz_mat_entry(S, i, i)))
+            num++;
+
+    *invariants = _fmpz_vec_init(num);
+
+    for (i = 0; i < num; i++)
+        fmpz_set(*invariants + i, fmpz_mat_entry(S, S->r - num + i, S->r - num + i));
+
+    fmpz_mat_clear(S);
+    flint_free(args);
+    flint_free(wrels);
+    flint_randclear(state);
+
+    return num;
+}
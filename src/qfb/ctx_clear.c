@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+void qfb_ctx_clear(qfb_ctx_t ctx)
+{
+   slong i;
+
+   fmpz_clear(ctx->D);
+   fmpz_clear(ctx->L);
+
+   for (i = 0; i < QFB_CTX_NUM_TMP; i++)
+      fmpz_clear(ctx->tmp + i);
+
+   if (ctx->table_alloc != 0)
+      qfb_array_clear(&ctx->table, ctx->table_alloc);
+}
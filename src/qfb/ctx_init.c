@@ -0,0 +1,30 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+void qfb_ctx_init(qfb_ctx_t ctx, const fmpz_t D)
+{
+   slong i;
+
+   fmpz_init_set(ctx->D, D);
+   fmpz_init(ctx->L);
+   fmpz_abs(ctx->L, D);
+   fmpz_root(ctx->L, ctx->L, 4);
+
+   for (i = 0; i < QFB_CTX_NUM_TMP; i++)
+      fmpz_init(ctx->tmp + i);
+
+   ctx->table = NULL;
+   ctx->table_alloc = 0;
+}
@@ -0,0 +1,154 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+/*
+   Same algorithm as qfb_nucomp, with all temporaries taken from the
+   workspace of ctx. The result is written to r only at the end, so that
+   r may alias f or g.
+*/
+void qfb_ctx_nucomp(qfb_t r, const qfb_t f, const qfb_t g, qfb_ctx_t ctx)
+{
+   fmpz * a1 = ctx->tmp + 0;
+   fmpz * a2 = ctx->tmp + 1;
+   fmpz * c2 = ctx->tmp + 2;
+   fmpz * ca = ctx->tmp + 3;
+   fmpz * cb = ctx->tmp + 4;
+   fmpz * cc = ctx->tmp + 5;
+   fmpz * k = ctx->tmp + 6;
+   fmpz * s = ctx->tmp + 7;
+   fmpz * sp = ctx->tmp + 8;
+   fmpz * ss = ctx->tmp + 9;
+   fmpz * m = ctx->tmp + 10;
+   fmpz * t = ctx->tmp + 11;
+   fmpz * u2 = ctx->tmp + 12;
+   fmpz * v1 = ctx->tmp + 13;
+   fmpz * v2 = ctx->tmp + 14;
+
+   if (fmpz_cmp(f->a, g->a) > 0)
+   {
+      const qfb * h = f;
+      f = g;
+      g = h;
+   }
+
+   fmpz_set(a1, f->a);
+   fmpz_set(a2, g->a);
+   fmpz_set(c2, g->c);
+
+   fmpz_add(ss, f->b, g->b);
+   fmpz_fdiv_q_2exp(ss, ss, 1);
+
+   fmpz_sub(m, f->b, g->b);
+   fmpz_fdiv_q_2exp(m, m, 1);
+
+   fmpz_fdiv_r(t, a2, a1);
+   if (fmpz_is_zero(t))
+   {
+      fmpz_zero(v1);
+      fmpz_set(sp, a1);
+   } else
+      fmpz_gcdinv(sp, v1, t, a1);
+
+   fmpz_mul(k, m, v1);
+   fmpz_fdiv_r(k, k, a1);
+
+   if (!fmpz_is_one(sp))
+   {
+      fmpz_xgcd(s, v2, u2, ss, sp);
+
+      fmpz_mul(k, k, u2);
+      fmpz_mul(t, v2, c2);
+      fmpz_sub(k, k, t);
+
+      if (!fmpz_is_one(s))
+      {
+         fmpz_divexact(a1, a1, s);
+         fmpz_divexact(a2, a2, s);
+         fmpz_mul(c2, c2, s);
+      }
+
+      fmpz_fdiv_r(k, k, a1);
+   }
+
+   if (fmpz_cmp(a1, ctx->L) < 0)
+   {
+      fmpz_mul(t, a2, k);
+
+      fmpz_mul(ca, a2, a1);
+
+      fmpz_mul_2exp(cb, t, 1);
+      fmpz_add(cb, cb, g->b);
+
+      fmpz_add(cc, g->b, t);
+      fmpz_mul(cc, cc, k);
+      fmpz_add(cc, cc, c2);
+
+      fmpz_divexact(cc, cc, a1);
+   } else
+   {
+      fmpz * m1 = ctx->tmp + 15;
+      fmpz * m2 = ctx->tmp + 16;
+      fmpz * r1 = ctx->tmp + 17;
+      fmpz * r2 = ctx->tmp + 18;
+      fmpz * co1 = ctx->tmp + 19;
+      fmpz * co2 = ctx->tmp + 20;
+      fmpz * temp = ctx->tmp + 21;
+
+      fmpz_set(r2, a1);
+      fmpz_set(r1, k);
+
+      fmpz_xgcd_partial(co2, co1, r2, r1, ctx->L);
+
+      fmpz_mul(t, a2, r1);
+      fmpz_mul(m1, m, co1);
+      fmpz_add(m1, m1, t);
+      fmpz_divexact(m1, m1, a1);
+
+      fmpz_mul(m2, ss, r1);
+      fmpz_mul(temp, c2, co1);
+      fmpz_sub(m2, m2, temp);
+      fmpz_divexact(m2, m2, a1);
+
+      fmpz_mul(ca, r1, m1);
+      fmpz_mul(temp, co1, m2);
+      if (fmpz_sgn(co1) < 0)
+         fmpz_sub(ca, ca, temp);
+      else
+         fmpz_sub(ca, temp, ca);
+
+      fmpz_mul(cb, ca, co2);
+      fmpz_sub(cb, t, cb);
+      fmpz_mul_2exp(cb, cb, 1);
+      fmpz_divexact(cb, cb, co1);
+      fmpz_sub(cb, cb, g->b);
+      fmpz_mul_2exp(temp, ca, 1);
+      fmpz_fdiv_r(cb, cb, temp);
+
+      fmpz_mul(cc, cb, cb);
+      fmpz_sub(cc, cc, ctx->D);
+      fmpz_divexact(cc, cc, ca);
+      fmpz_fdiv_q_2exp(cc, cc, 2);
+
+      if (fmpz_sgn(ca) < 0)
+      {
+         fmpz_neg(ca, ca);
+         fmpz_neg(cc, cc);
+      }
+   }
+
+   fmpz_swap(r->a, ca);
+   fmpz_swap(r->b, cb);
+   fmpz_swap(r->c, cc);
+}
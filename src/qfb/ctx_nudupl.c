@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+/*
+   Same algorithm as qfb_nudupl, with all temporaries taken from the
+   workspace of ctx. The result is written to r only at the end, so that
+   r may alias f.
+*/
+void qfb_ctx_nudupl(qfb_t r, const qfb_t f, qfb_ctx_t ctx)
+{
+   fmpz * a1 = ctx->tmp + 0;
+   fmpz * b1 = ctx->tmp + 1;
+   fmpz * c1 = ctx->tmp + 2;
+   fmpz * ca = ctx->tmp + 3;
+   fmpz * cb = ctx->tmp + 4;
+   fmpz * cc = ctx->tmp + 5;
+   fmpz * k = ctx->tmp + 6;
+   fmpz * s = ctx->tmp + 7;
+   fmpz * t = ctx->tmp + 8;
+   fmpz * v2 = ctx->tmp + 9;
+
+   fmpz_set(a1, f->a);
+   fmpz_set(c1, f->c);
+
+   /* s = gcd(b, a) = v2 b + u2 a */
+   fmpz_abs(b1, f->b);
+   if (fmpz_cmp(b1, a1) == 0)
+   {
+      fmpz_set(s, a1);
+      fmpz_zero(v2);
+   } else
+   {
+      if (fmpz_cmp(b1, a1) > 0)
+         fmpz_fdiv_r(b1, b1, a1);
+
+      fmpz_gcdinv(s, v2, b1, a1);
+
+      if (fmpz_sgn(f->b) < 0)
+         fmpz_neg(v2, v2);
+   }
+
+   fmpz_mul(t, v2, c1);
+   fmpz_neg(k, t);
+
+   if (!fmpz_is_one(s))
+   {
+      fmpz_divexact(a1, a1, s);
+      fmpz_mul(c1, c1, s);
+   }
+
+   fmpz_fdiv_r(k, k, a1);
+
+   if (fmpz_cmp(a1, ctx->L) < 0)
+   {
+      fmpz_mul(t, a1, k);
+
+      fmpz_mul(ca, a1, a1);
+
+      fmpz_mul_2exp(cb, t, 1);
+      fmpz_add(cb, cb, f->b);
+
+      fmpz_add(cc, f->b, t);
+      fmpz_mul(cc, cc, k);
+      fmpz_add(cc, cc, c1);
+
+      fmpz_divexact(cc, cc, a1);
+   } else
+   {
+      fmpz * m2 = ctx->tmp + 10;
+      fmpz * r1 = ctx->tmp + 11;
+      fmpz * r2 = ctx->tmp + 12;
+      fmpz * co1 = ctx->tmp + 13;
+      fmpz * co2 = ctx->tmp + 14;
+      fmpz * temp = ctx->tmp + 15;
+
+      fmpz_set(r2, a1);
+      fmpz_set(r1, k);
+
+      fmpz_xgcd_partial(co2, co1, r2, r1, ctx->L);
+
+      fmpz_mul(t, a1, r1);
+
+      fmpz_mul(m2, f->b, r1);
+      fmpz_mul(temp, c1, co1);
+      fmpz_sub(m2, m2, temp);
+      fmpz_divexact(m2, m2, a1);
+
+      fmpz_mul(ca, r1, r1);
+      fmpz_mul(temp, co1, m2);
+      if (fmpz_sgn(co1) < 0)
+         fmpz_sub(ca, ca, temp);
+      else
+         fmpz_sub(ca, temp, ca);
+
+      fmpz_mul(cb, ca, co2);
+      fmpz_sub(cb, t, cb);
+      fmpz_mul_2exp(cb, cb, 1);
+      fmpz_divexact(cb, cb, co1);
+      fmpz_sub(cb, cb, f->b);
+      fmpz_mul_2exp(temp, ca, 1);
+      fmpz_fdiv_r(cb, cb, temp);
+
+      fmpz_mul(cc, cb, cb);
+      fmpz_sub(cc, cc, ctx->D);
+      fmpz_divexact(cc, cc, ca);
+      fmpz_fdiv_q_2exp(cc, cc, 2);
+
+      if (fmpz_sgn(ca) < 0)
+      {
+         fmpz_neg(ca, ca);
+         fmpz_neg(cc, cc);
+      }
+   }
+
+   fmpz_swap(r->a, ca);
+   fmpz_swap(r->b, cb);
+   fmpz_swap(r->c, cc);
+}
@@ -0,0 +1,143 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+/*
+   Computes the width w NAF of e: e = sum d_i 2^i where each d_i is zero
+   or odd with |d_i| < 2^(w-1), and any w consecutive digits contain at
+   most one nonzero digit. Returns the number of digits, the top one being
+   nonzero. The array d must have room for bits(e) + w digits.
+*/
+static slong
+_qfb_ctx_pow_wnaf(slong * d, const fmpz_t e, slong w)
+{
+   slong i, j, len, bits, x, carry;
+
+   bits = fmpz_bits(e);
+   i = carry = 0;
+
+   while (i < bits || carry)
+   {
+      x = fmpz_tstbit(e, i) + carry;
+
+      if ((x & 1) == 0)
+      {
+         d[i++] = 0;
+         carry = x >> 1;
+         continue;
+      }
+
+      for (j = 1; j < w; j++)
+         x += fmpz_tstbit(e, i + j) << j;
+
+      if (x >= (WORD(1) << (w - 1)))
+         x -= (WORD(1) << w);
+
+      d[i] = x;
+      for (j = 1; j < w; j++)
+         d[i + j] = 0;
+
+      carry = (x < 0);
+      i += w;
+   }
+
+   for (len = i; len > 0 && d[len - 1] == 0; len--) ;
+
+   return len;
+}
+
+void qfb_ctx_pow(qfb_t r, const qfb_t f, const fmpz_t e, qfb_ctx_t ctx)
+{
+   slong i, j, w, best, cost, bits, num, len;
+   slong * d;
+   fmpz_t k;
+   qfb * T;
+
+   if (fmpz_is_zero(e))
+   {
+      qfb_principal_form(r, ctx->D);
+      return;
+   }
+
+   fmpz_init(k);
+   fmpz_abs(k, e);
+   bits = fmpz_bits(k);
+
+   /* 2^(w-2) compositions for the table, bits/(w+1) for the digits */
+   for (w = best = 2; w < 12; w++)
+   {
+      cost = (WORD(1) << (w - 2)) + bits / (w + 1);
+      if (cost < (WORD(1) << (best - 2)) + bits / (best + 1))
+         best = w;
+   }
+
+   w = best;
+   num = WORD(1) << (w - 2);
+
+   d = flint_malloc(sizeof(slong) * (bits + w));
+   len = _qfb_ctx_pow_wnaf(d, k, w);
+
+   /* table of odd powers f, f^3, ..., f^(2 num - 1) */
+   if (ctx->table_alloc < num)
+   {
+      ctx->table = flint_realloc(ctx->table, sizeof(qfb) * num);
+      for (i = ctx->table_alloc; i < num; i++)
+         qfb_init(ctx->table + i);
+      ctx->table_alloc = num;
+   }
+
+   T = ctx->table;
+
+   qfb_ctx_reduce(T, f, ctx);
+
+   if (num > 1)
+   {
+      qfb_ctx_sqr(r, T, ctx);
+      for (i = 1; i < num; i++)
+         qfb_ctx_mul(T + i, T + i - 1, r, ctx);
+   }
+
+   /* left to right, using f^(-j) = (a, -b, c) for f^j = (a, b, c) */
+   j = d[len - 1];
+   qfb_set(r, T + (FLINT_ABS(j) - 1) / 2);
+   if (j < 0)
+      fmpz_neg(r->b, r->b);
+
+   for (i = len - 2; i >= 0; i--)
+   {
+      qfb_ctx_sqr(r, r, ctx);
+
+      j = d[i];
+      if (j != 0)
+      {
+         qfb * g = T + (FLINT_ABS(j) - 1) / 2;
+
+         if (j < 0)
+            fmpz_neg(g->b, g->b);
+
+         qfb_ctx_mul(r, r, g, ctx);
+
+         if (j < 0)
+            fmpz_neg(g->b, g->b);
+      }
+   }
+
+   if (fmpz_sgn(e) < 0)
+      fmpz_neg(r->b, r->b);
+
+   qfb_ctx_reduce(r, r, ctx);
+
+   flint_free(d);
+   fmpz_clear(k);
+}
@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+/*
+   Yao's method: writing e = sum d_i 2^(w i) with signed digits
+   -2^(w-1) < d_i <= 2^(w-1), we have f^e = prod_m (prod_(|d_i| >= m) g_i)
+   for 1 <= m <= 2^(w-1), where g_i = f^(sign(d_i) 2^(w i)) are read from
+   the table, which is not modified. The inner products are accumulated
+   for decreasing m.
+*/
+void qfb_ctx_pow_precomp(qfb_t r, const qfb_pow_table_t T,
+                                               const fmpz_t e, qfb_ctx_t ctx)
+{
+   slong i, m, w, len, half;
+   slong * d;
+   fmpz_t k;
+   qfb_t acc, inv;
+   int acc_one, r_one;
+
+   w = T->w;
+
+   if (fmpz_bits(e) > (T->num - 1) * w)
+   {
+      qfb_ctx_pow(r, T->powers, e, ctx);
+      return;
+   }
+
+   fmpz_init(k);
+   fmpz_abs(k, e);
+
+   d = flint_malloc(sizeof(slong) * T->num);
+   half = WORD(1) << (w - 1);
+
+   for (len = 0; !fmpz_is_zero(k); len++)
+   {
+      d[len] = fmpz_fdiv_ui(k, UWORD(1) << w);
+      if (d[len] > half)
+         d[len] -= (WORD(1) << w);
+
+      fmpz_sub_si(k, k, d[len]);
+      fmpz_fdiv_q_2exp(k, k, w);
+   }
+
+   qfb_init(acc);
+   qfb_init(inv);
+   acc_one = r_one = 1;
+
+   for (m = half; m >= 1; m--)
+   {
+      for (i = 0; i < len; i++)
+      {
+         qfb * g;
+
+         if (FLINT_ABS(d[i]) != m)
+            continue;
+
+         g = T->powers + i;
+
+         if (d[i] < 0)
+         {
+            qfb_set(inv, g);
+            fmpz_neg(inv->b, inv->b);
+            g = inv;
+         }
+
+         if (acc_one)
+            qfb_set(acc, g);
+         else
+            qfb_ctx_mul(acc, acc, g, ctx);
+
+         acc_one = 0;
+      }
+
+      if (!acc_one)
+      {
+         if (r_one)
+            qfb_set(r, acc);
+         else
+            qfb_ctx_mul(r, r, acc, ctx);
+
+         r_one = 0;
+      }
+   }
+
+   if (r_one)
+      qfb_principal_form(r, ctx->D);
+   else
+   {
+      if (fmpz_sgn(e) < 0)
+         fmpz_neg(r->b, r->b);
+
+      qfb_ctx_reduce(r, r, ctx);
+   }
+
+   qfb_clear(acc);
+   qfb_clear(inv);
+   flint_free(d);
+   fmpz_clear(k);
+}
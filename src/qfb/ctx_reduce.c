@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+/*
+   As qfb_reduce, but the normalisation b -> b - 2aq updates c as
+   c - q (b - aq) rather than recomputing it from the discriminant.
+*/
+void qfb_ctx_reduce(qfb_t r, const qfb_t f, qfb_ctx_t ctx)
+{
+   fmpz * t = ctx->tmp + 0;
+   fmpz * q = ctx->tmp + 1;
+   fmpz * s = ctx->tmp + 2;
+   int done = 0;
+
+   if (r != f)
+      qfb_set(r, (qfb *) f);
+
+   while (!done)
+   {
+      done = 1;
+
+      if (fmpz_cmp(r->c, r->a) < 0)
+      {
+         fmpz_swap(r->a, r->c);
+         fmpz_neg(r->b, r->b);
+
+         done = 0;
+      }
+
+      if (fmpz_cmpabs(r->b, r->a) > 0)
+      {
+         fmpz_add(t, r->a, r->a);
+         fmpz_set(s, r->b);
+         fmpz_fdiv_qr(q, r->b, r->b, t);
+         if (fmpz_cmp(r->b, r->a) > 0)
+         {
+            fmpz_sub(r->b, r->b, t);
+            fmpz_add_ui(q, q, 1);
+         }
+
+         /* s - a q = (b_old + b_new) / 2 */
+         fmpz_submul(s, r->a, q);
+         fmpz_submul(r->c, q, s);
+
+         done = 0;
+      }
+   }
+
+   if (fmpz_cmpabs(r->a, r->b) == 0 || fmpz_cmp(r->a, r->c) == 0)
+      if (fmpz_sgn(r->b) < 0)
+         fmpz_neg(r->b, r->b);
+}
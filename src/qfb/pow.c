@@ -21,8 +21,7 @@
 
 void qfb_pow(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e)
 {
-   fmpz_t L, exp;
-   qfb_t pow;
+   qfb_ctx_t ctx;
 
    if (fmpz_is_zero(e))
    {
@@ -36,42 +35,9 @@ void qfb_pow(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e)
       return;
    }
 
-   fmpz_init(L);
-   fmpz_init(exp);
-
-   fmpz_set(exp, e);
-
-   fmpz_abs(L, D);
-   fmpz_root(L, L, 4);
-
-   qfb_init(pow);
-
-   qfb_set(pow, f);
-   while (fmpz_is_even(exp))
-   {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      fmpz_fdiv_q_2exp(exp, exp, 1);
-   }
-
-   qfb_set(r, pow);
-   fmpz_fdiv_q_2exp(exp, exp, 1);
-
-   while (!fmpz_is_zero(exp))
-   {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      if (fmpz_is_odd(exp))
-      {
-         qfb_nucomp(r, r, pow, D, L);
-         qfb_reduce(r, r, D);
-      }
-      fmpz_fdiv_q_2exp(exp, exp, 1);
-   }
-
-   qfb_clear(pow);
-   fmpz_clear(L);
-   fmpz_clear(exp);
+   qfb_ctx_init(ctx, D);
+   qfb_ctx_pow(r, f, e, ctx);
+   qfb_ctx_clear(ctx);
 }
 
 void qfb_pow_with_root(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e, fmpz_t L)
@@ -0,0 +1,18 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "qfb.h"
+
+void qfb_pow_table_clear(qfb_pow_table_t T)
+{
+   qfb_array_clear(&T->powers, T->num);
+}
@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "qfb.h"
+
+void qfb_pow_table_init(qfb_pow_table_t T, const qfb_t f,
+                                               flint_bitcnt_t bits, qfb_ctx_t ctx)
+{
+   slong i, j, w, best, cost;
+
+   bits = FLINT_MAX(bits, 1);
+
+   /* about bits/w compositions for the digits and 2^w to combine them */
+   for (w = best = 1; w < 16; w++)
+   {
+      cost = (bits + w - 1) / w + (WORD(1) << w);
+      if (cost < (bits + best - 1) / best + (WORD(1) << best))
+         best = w;
+   }
+
+   T->w = best;
+
+   /* signed digits in base 2^w may need one extra digit */
+   T->num = (bits + best - 1) / best + 1;
+   T->powers = flint_malloc(sizeof(qfb) * T->num);
+
+   for (i = 0; i < T->num; i++)
+      qfb_init(T->powers + i);
+
+   qfb_ctx_reduce(T->powers, f, ctx);
+
+   for (i = 1; i < T->num; i++)
+   {
+      qfb_ctx_sqr(T->powers + i, T->powers + i - 1, ctx);
+      for (j = 1; j < T->w; j++)
+         qfb_ctx_sqr(T->powers + i, T->powers + i, ctx);
+   }
+}
@@ -19,8 +19,8 @@
 
 void qfb_pow_ui(qfb_t r, qfb_t f, fmpz_t D, ulong exp)
 {
-   fmpz_t L;
-   qfb_t pow;
+   qfb_ctx_t ctx;
+   fmpz_t e;
 
    if (exp == 0)
    {
@@ -34,35 +34,9 @@ void qfb_pow_ui(qfb_t r, qfb_t f, fmpz_t D, ulong exp)
       return;
    }
 
-   fmpz_init(L);
-   fmpz_abs(L, D);
-   fmpz_root(L, L, 4);
-
-   qfb_init(pow);
-
-   qfb_set(pow, f);
-   while ((exp & 1) == 0)
-   {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      exp >>= 1;
-   }
-
-   qfb_set(r, pow);
-   exp >>= 1;
-
-   while (exp)
-   {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      if (exp & 1)
-      {
-         qfb_nucomp(r, r, pow, D, L);
-         qfb_reduce(r, r, D);
-      }
-      exp >>= 1;
-   }
-
-   qfb_clear(pow);
-   fmpz_clear(L);
+   fmpz_init_set_ui(e, exp);
+   qfb_ctx_init(ctx, D);
+   qfb_ctx_pow(r, f, e, ctx);
+   qfb_ctx_clear(ctx);
+   fmpz_clear(e);
 }
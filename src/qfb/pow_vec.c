@@ -0,0 +1,62 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "thread_support.h"
+#include "fmpz.h"
+#include "qfb.h"
+
+typedef struct
+{
+   qfb * r;
+   const qfb * f;
+   slong len;
+   slong num;
+   const fmpz * e;
+   const fmpz * D;
+}
+qfb_pow_vec_arg_t;
+
+static void
+_qfb_pow_vec_worker(slong i, qfb_pow_vec_arg_t * arg)
+{
+   qfb_ctx_t ctx;
+   slong j, start, stop;
+
+   start = (i * arg->len) / arg->num;
+   stop = ((i + 1) * arg->len) / arg->num;
+
+   qfb_ctx_init(ctx, arg->D);
+
+   for (j = start; j < stop; j++)
+      qfb_ctx_pow(arg->r + j, arg->f + j, arg->e, ctx);
+
+   qfb_ctx_clear(ctx);
+}
+
+void qfb_pow_vec(qfb * r, const qfb * f, slong len,
+                                             const fmpz_t e, const fmpz_t D)
+{
+   qfb_pow_vec_arg_t arg;
+
+   if (len <= 0)
+      return;
+
+   arg.r = r;
+   arg.f = f;
+   arg.len = len;
+   arg.num = FLINT_MIN(len, flint_get_num_threads());
+   arg.e = e;
+   arg.D = D;
+
+   flint_parallel_do((do_func_t) _qfb_pow_vec_worker, &arg, arg.num, -1,
+                                                       FLINT_PARALLEL_STRIDED);
+}
@@ -0,0 +1,171 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "qfb.h"
+
+/* checks that the invariants form a divisor chain with product h */
+static void
+check_invariants(const fmpz * inv, slong num, const fmpz_t h, const fmpz_t D)
+{
+    fmpz_t prod;
+    slong j;
+    int result = 1;
+
+    fmpz_init(prod);
+    fmpz_one(prod);
+
+    for (j = 0; j < num; j++)
+    {
+        fmpz_mul(prod, prod, inv + j);
+
+        if (fmpz_cmp_ui(inv + j, 1) <= 0 ||
+            (j > 0 && !fmpz_divisible(inv + j, inv + j - 1)))
+            result = 0;
+    }
+
+    result = result && fmpz_equal(prod, h);
+
+    if (!result)
+    {
+        flint_printf("FAIL:\n");
+        flint_printf("Invalid invariants\n");
+        flint_printf("D = "); fmpz_print(D); flint_printf("\n");
+        flint_printf("h = "); fmpz_print(h); flint_printf("\n");
+        flint_printf("invariants: "); _fmpz_vec_print(inv, num); flint_printf("\n");
+        fflush(stdout);
+        flint_abort();
+    }
+
+    fmpz_clear(prod);
+}
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("class_group....");
+    fflush(stdout);
+
+    /* compare the class number with the number of reduced forms */
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t D, h;
+        fmpz * inv;
+        qfb * forms;
+        slong d, num, count;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_init(D);
+        fmpz_init(h);
+
+        do {
+            d = n_randint(state, 100000) + 3;
+        } while ((d % 4) == 1 || (d % 4) == 2);
+
+        fmpz_set_si(D, -d);
+
+        num = qfb_class_group(&inv, h, D);
+        count = qfb_reduced_forms(&forms, -d);
+
+        if (!fmpz_equal_si(h, count))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("Wrong class number\n");
+            flint_printf("D = "); fmpz_print(D); flint_printf("\n");
+            flint_printf("h = "); fmpz_print(h); flint_printf("\n");
+            flint_printf("number of reduced forms = %wd\n", count);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        check_invariants(inv, num, h, D);
+
+        _fmpz_vec_clear(inv, num);
+        qfb_array_clear(&forms, count);
+        fmpz_clear(D);
+        fmpz_clear(h);
+    }
+
+    /* larger discriminants: the exponent annihilates prime forms */
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t D, h, p;
+        fmpz * inv;
+        qfb_t f;
+        slong num, j;
+        ulong q;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_init(D);
+        fmpz_init(h);
+        fmpz_init(p);
+        qfb_init(f);
+
+        do {
+            fmpz_randbits(D, state, 30 + n_randint(state, 40));
+            fmpz_abs(D, D);
+            fmpz_neg(D, D);
+        } while (fmpz_fdiv_ui(D, 4) > 1);
+
+        num = qfb_class_group(&inv, h, D);
+
+        check_invariants(inv, num, h, D);
+
+        for (j = 0, q = 3; j < 5; q = n_nextprime(q, 1))
+        {
+            ulong r = fmpz_fdiv_ui(D, q);
+
+            if (r == 0 || n_jacobi(r, q) != 1)
+                continue;
+
+            fmpz_set_ui(p, q);
+            qfb_prime_form(f, D, p);
+
+            if (num != 0)
+                qfb_pow(f, f, D, inv + num - 1);
+
+            qfb_reduce(f, f, D);
+
+            if (!qfb_is_principal_form(f, D))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("Exponent does not annihilate prime form\n");
+                flint_printf("D = "); fmpz_print(D); flint_printf("\n");
+                flint_printf("p = %wu\n", q);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            j++;
+        }
+
+        _fmpz_vec_clear(inv, num);
+        fmpz_clear(D);
+        fmpz_clear(h);
+        fmpz_clear(p);
+        qfb_clear(f);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
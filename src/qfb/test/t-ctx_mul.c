@@ -0,0 +1,134 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "qfb.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_mul....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 2000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t D, L, e;
+        qfb_t f, g, r, s;
+        qfb_ctx_t ctx;
+        int alias;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        fmpz_init(e);
+        qfb_init(f);
+        qfb_init(g);
+        qfb_init(r);
+        qfb_init(s);
+
+        do
+        {
+            fmpz_randtest_unsigned(f->a, state, 200);
+            if (fmpz_is_zero(f->a))
+                fmpz_one(f->a);
+
+            fmpz_randtest(f->b, state, 200);
+            fmpz_randtest(f->c, state, 200);
+
+            qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_ctx_init(ctx, D);
+
+        qfb_reduce(f, f, D);
+        fmpz_set_ui(e, n_randint(state, 100));
+        qfb_pow_with_root(g, f, D, e, L);
+        qfb_reduce(g, g, D);
+
+        /* composition */
+        qfb_nucomp(s, f, g, D, L);
+        qfb_reduce(s, s, D);
+
+        alias = n_randint(state, 3);
+        if (alias == 0)
+        {
+            qfb_ctx_mul(r, f, g, ctx);
+        }
+        else if (alias == 1)
+        {
+            qfb_set(r, f);
+            qfb_ctx_mul(r, r, g, ctx);
+        }
+        else
+        {
+            qfb_set(r, g);
+            qfb_ctx_mul(r, f, r, ctx);
+        }
+
+        if (!qfb_equal(r, s))
+        {
+            flint_printf("FAIL (mul):\n");
+            flint_printf("alias = %d\n", alias);
+            qfb_print(f); flint_printf("\n");
+            qfb_print(g); flint_printf("\n");
+            qfb_print(r); flint_printf("\n");
+            qfb_print(s); flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* squaring */
+        qfb_nucomp(s, f, f, D, L);
+        qfb_reduce(s, s, D);
+
+        if (n_randint(state, 2))
+        {
+            qfb_ctx_sqr(r, f, ctx);
+        }
+        else
+        {
+            qfb_set(r, f);
+            qfb_ctx_sqr(r, r, ctx);
+        }
+
+        if (!qfb_equal(r, s))
+        {
+            flint_printf("FAIL (sqr):\n");
+            qfb_print(f); flint_printf("\n");
+            qfb_print(r); flint_printf("\n");
+            qfb_print(s); flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        qfb_ctx_clear(ctx);
+        fmpz_clear(D);
+        fmpz_clear(L);
+        fmpz_clear(e);
+        qfb_clear(f);
+        qfb_clear(g);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
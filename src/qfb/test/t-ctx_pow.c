@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "qfb.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_pow....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t D, L, e, me;
+        qfb_t f, r, s;
+        qfb_ctx_t ctx;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        fmpz_init(e);
+        fmpz_init(me);
+        qfb_init(f);
+        qfb_init(r);
+        qfb_init(s);
+
+        do
+        {
+            fmpz_randtest_unsigned(f->a, state, 200);
+            if (fmpz_is_zero(f->a))
+                fmpz_one(f->a);
+
+            fmpz_randtest(f->b, state, 200);
+            fmpz_randtest(f->c, state, 200);
+
+            qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_ctx_init(ctx, D);
+
+        qfb_reduce(f, f, D);
+
+        fmpz_randtest_unsigned(e, state, 300);
+
+        qfb_pow_with_root(s, f, D, e, L);
+        qfb_reduce(s, s, D);
+
+        if (n_randint(state, 2))
+        {
+            qfb_ctx_pow(r, f, e, ctx);
+        }
+        else
+        {
+            qfb_set(r, f);
+            qfb_ctx_pow(r, r, e, ctx);
+        }
+
+        if (!qfb_equal(r, s))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("e = "); fmpz_print(e); flint_printf("\n");
+            qfb_print(f); flint_printf("\n");
+            qfb_print(r); flint_printf("\n");
+            qfb_print(s); flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* f^(-e) is the inverse of f^e */
+        fmpz_neg(me, e);
+        qfb_ctx_pow(r, f, me, ctx);
+        qfb_ctx_mul(r, r, s, ctx);
+
+        if (!qfb_is_principal_form(r, D))
+        {
+            flint_printf("FAIL (negative exponent):\n");
+            flint_printf("e = "); fmpz_print(e); flint_printf("\n");
+            qfb_print(f); flint_printf("\n");
+            qfb_print(r); flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        qfb_ctx_clear(ctx);
+        fmpz_clear(D);
+        fmpz_clear(L);
+        fmpz_clear(e);
+        fmpz_clear(me);
+        qfb_clear(f);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
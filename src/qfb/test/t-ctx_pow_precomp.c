@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "qfb.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_pow_precomp....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t D, e;
+        qfb_t f, r, s;
+        qfb_ctx_t ctx;
+        qfb_pow_table_t T;
+        flint_bitcnt_t bits;
+        slong j;
+
+        fmpz_init(D);
+        fmpz_init(e);
+        qfb_init(f);
+        qfb_init(r);
+        qfb_init(s);
+
+        do
+        {
+            fmpz_randtest_unsigned(f->a, state, 200);
+            if (fmpz_is_zero(f->a))
+                fmpz_one(f->a);
+
+            fmpz_randtest(f->b, state, 200);
+            fmpz_randtest(f->c, state, 200);
+
+            qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        qfb_ctx_init(ctx, D);
+
+        bits = n_randint(state, 600);
+        qfb_pow_table_init(T, f, bits, ctx);
+
+        for (j = 0; j < 10; j++)
+        {
+            /* occasionally larger than the table supports */
+            fmpz_randtest(e, state, bits + (n_randint(state, 10) == 0) * 20);
+
+            qfb_ctx_pow(s, f, e, ctx);
+            qfb_ctx_pow_precomp(r, T, e, ctx);
+
+            if (!qfb_equal(r, s))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("bits = %wu, e = ", bits); fmpz_print(e); flint_printf("\n");
+                qfb_print(f); flint_printf("\n");
+                qfb_print(r); flint_printf("\n");
+                qfb_print(s); flint_printf("\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        qfb_pow_table_clear(T);
+        qfb_ctx_clear(ctx);
+        fmpz_clear(D);
+        fmpz_clear(e);
+        qfb_clear(f);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "qfb.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("pow_vec....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t D, e;
+        qfb * f, * r;
+        qfb_t s, g;
+        qfb_ctx_t ctx;
+        slong i, len;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_init(D);
+        fmpz_init(e);
+        qfb_init(s);
+        qfb_init(g);
+
+        do
+        {
+            fmpz_randtest_unsigned(g->a, state, 200);
+            if (fmpz_is_zero(g->a))
+                fmpz_one(g->a);
+
+            fmpz_randtest(g->b, state, 200);
+            fmpz_randtest(g->c, state, 200);
+
+            qfb_discriminant(D, g);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(g));
+
+        qfb_ctx_init(ctx, D);
+
+        len = n_randint(state, 20);
+        f = flint_malloc(sizeof(qfb) * FLINT_MAX(len, 1));
+        r = flint_malloc(sizeof(qfb) * FLINT_MAX(len, 1));
+
+        for (i = 0; i < len; i++)
+        {
+            qfb_init(f + i);
+            qfb_init(r + i);
+            fmpz_set_ui(e, n_randint(state, 1000));
+            qfb_ctx_pow(f + i, g, e, ctx);
+        }
+
+        fmpz_randtest(e, state, 200);
+
+        qfb_pow_vec(r, f, len, e, D);
+
+        for (i = 0; i < len; i++)
+        {
+            qfb_ctx_pow(s, f + i, e, ctx);
+
+            if (!qfb_equal(r + i, s))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("i = %wd, e = ", i); fmpz_print(e); flint_printf("\n");
+                qfb_print(f + i); flint_printf("\n");
+                qfb_print(r + i); flint_printf("\n");
+                qfb_print(s); flint_printf("\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        qfb_array_clear(&f, len);
+        qfb_array_clear(&r, len);
+        qfb_ctx_clear(ctx);
+        fmpz_clear(D);
+        fmpz_clear(e);
+        qfb_clear(s);
+        qfb_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    flint_cleanup_master();
+    return 0;
+}
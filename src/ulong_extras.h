@@ -292,6 +292,7 @@ ulong n_euler_phi(ulong n);
 #define FLINT_PRIMES_TAB_DEFAULT_CUTOFF 1000000
 #define FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF 311
 #define FLINT_SIEVE_SIZE 65536
+#define FLINT_SIEVE_BLOCK_SIZE (UWORD(1) << 19)
 
 #if FLINT64
 # define UWORD_MAX_PRIME UWORD(18446744073709551557)
@@ -314,6 +315,15 @@ void n_primes_jump_after(n_primes_t iter, ulong n);
 
 ulong n_primes_next(n_primes_t iter);
 
+void _n_sieve_odd_bits(ulong * res, ulong a, slong nwords, const ulong * primes, slong num_primes);
+slong _n_primes_sieve_block(ulong ** bits, slong * nwords, ulong * odd, int * two,
+    ulong a, ulong b, slong j, const ulong * primes, slong num_primes);
+
+typedef void (* n_primes_block_func_t)(const ulong * primes, slong num, slong block, void * arg);
+
+void n_primes_parallel_do(ulong a, ulong b, n_primes_block_func_t func, void * arg, slong thread_limit);
+ulong n_primes_count_range(ulong a, ulong b);
+
 void n_compute_primes(ulong num_primes);
 void n_cleanup_primes(void);
 
@@ -333,6 +343,7 @@ int n_is_strong_probabprime_precomp(ulong n, double npre, ulong a, ulong d);
 int n_is_strong_probabprime2_preinv(ulong n, ulong ninv, ulong a, ulong d);
 
 int n_is_prime(ulong n);
+void n_is_prime_vec(int * res, const ulong * vec, slong len);
 int n_is_prime_pseudosquare(ulong n);
 int n_is_prime_pocklington(ulong n, ulong iterations);
 
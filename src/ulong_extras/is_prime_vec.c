@@ -0,0 +1,226 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "longlong.h"
+#include "thread_support.h"
+#include "ulong_extras.h"
+
+#define IS_PRIME_VEC_CHUNK 256
+
+#if FLINT64
+
+/* below this, n_is_probabprime does not use BPSW */
+#define BPSW_CUTOFF UWORD(1050535501)
+
+/* number of interleaved strong probable prime tests */
+#define LANES 4
+
+/* same small prime filter as n_is_prime for n > 10^6 */
+static int
+has_small_factor(ulong n)
+{
+    return !(n%  3) || !(n%  5) || !(n%  7) || !(n% 11) || !(n% 13) ||
+           !(n% 17) || !(n% 19) || !(n% 23) || !(n% 29) || !(n% 31) ||
+           !(n% 37) || !(n% 41) || !(n% 43) || !(n% 47) || !(n% 53) ||
+           !(n% 59) || !(n% 61) || !(n% 67) || !(n% 71) || !(n% 73) ||
+           !(n% 79) || !(n% 83) || !(n% 89) || !(n% 97) || !(n%101) ||
+           !(n%103) || !(n%107) || !(n%109) || !(n%113) || !(n%127) ||
+           !(n%131) || !(n%137) || !(n%139) || !(n%149);
+}
+
+/* n^(-1) mod 2^FLINT_BITS for odd n */
+static ulong
+inv_2exp(ulong n)
+{
+    ulong r = n;
+
+    r *= 2 - n * r;
+    r *= 2 - n * r;
+    r *= 2 - n * r;
+    r *= 2 - n * r;
+    r *= 2 - n * r;
+
+    return r;
+}
+
+/* Montgomery reduction of a * b, valid for any odd n */
+#define MONT_MUL(r, a, b, n, ninv)                      \
+    do {                                                \
+        ulong __hi, __lo, __m, __mh, __ml;              \
+        umul_ppmm(__hi, __lo, (a), (b));                \
+        __m = __lo * (ninv);                            \
+        umul_ppmm(__mh, __ml, __m, (n));                \
+        (r) = __hi - __mh;                              \
+        if (__hi < __mh)                                \
+            (r) += (n);                                 \
+    } while (0)
+
+/* Strong probable prime tests to base 2 for LANES odd moduli at once.
+   Each lane computes 2^d mod n by left-to-right binary powering in
+   Montgomery form, where multiplication by the base is a modular
+   doubling. Lanes with shorter exponents start with leading zero bits,
+   which leave the initial value 1 unchanged. */
+static void
+_n_is_strong_probabprime2_lanes(int * res, const ulong * n)
+{
+    ulong ninv[LANES], one[LANES], mone[LANES], d[LANES], y[LANES];
+    int s[LANES];
+    slong i, j, bits;
+
+    bits = 0;
+
+    for (i = 0; i < LANES; i++)
+    {
+        ninv[i] = inv_2exp(n[i]);
+        one[i] = (-n[i]) % n[i];
+        mone[i] = n[i] - one[i];
+        s[i] = flint_ctz(n[i] - 1);
+        d[i] = (n[i] - 1) >> s[i];
+        y[i] = one[i];
+        bits = FLINT_MAX(bits, FLINT_BIT_COUNT(d[i]));
+    }
+
+    for (j = bits - 1; j >= 0; j--)
+    {
+        for (i = 0; i < LANES; i++)
+        {
+            MONT_MUL(y[i], y[i], y[i], n[i], ninv[i]);
+
+            if ((d[i] >> j) & 1)
+                y[i] = n_addmod(y[i], y[i], n[i]);
+        }
+    }
+
+    for (i = 0; i < LANES; i++)
+    {
+        res[i] = (y[i] == one[i] || y[i] == mone[i]);
+
+        for (j = 1; j < s[i] && !res[i]; j++)
+        {
+            MONT_MUL(y[i], y[i], y[i], n[i], ninv[i]);
+
+            if (y[i] == mone[i])
+                res[i] = 1;
+            else if (y[i] == one[i])
+                break;
+        }
+    }
+}
+
+/* Completes BPSW exactly as n_is_probabprime_BPSW does for an odd n
+   which is known to be a strong probable prime to base 2, and hence
+   also a Fermat probable prime to base 2. */
+static int
+_n_is_prime_bpsw_tail(ulong n)
+{
+    if ((n % 10) == 3 || (n % 10) == 7)
+        return n_is_probabprime_fibonacci(n);
+    else
+        return n_is_probabprime_lucas(n) == 1;
+}
+
+static void
+_n_is_prime_vec(int * res, const ulong * vec, slong len)
+{
+    ulong n[LANES];
+    slong idx[LANES];
+    int sprp[LANES];
+    slong i, j, num;
+
+    num = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (vec[i] < BPSW_CUTOFF)
+        {
+            res[i] = n_is_prime(vec[i]);
+        }
+        else if ((vec[i] & 1) == 0 || has_small_factor(vec[i]))
+        {
+            res[i] = 0;
+        }
+        else
+        {
+            n[num] = vec[i];
+            idx[num] = i;
+            num++;
+        }
+
+        if (num == LANES || (i == len - 1 && num != 0))
+        {
+            /* pad with copies of the first candidate; the lanes only need
+               odd moduli, and the results of the padding are ignored */
+            for (j = num; j < LANES; j++)
+                n[j] = n[0];
+
+            _n_is_strong_probabprime2_lanes(sprp, n);
+
+            for (j = 0; j < num; j++)
+                res[idx[j]] = sprp[j] && _n_is_prime_bpsw_tail(n[j]);
+
+            num = 0;
+        }
+    }
+}
+
+#else
+
+static void
+_n_is_prime_vec(int * res, const ulong * vec, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        res[i] = n_is_prime(vec[i]);
+}
+
+#endif
+
+typedef struct
+{
+    int * res;
+    const ulong * vec;
+    slong len;
+}
+work_t;
+
+static void
+worker(slong i, work_t * work)
+{
+    slong start, len;
+
+    start = i * IS_PRIME_VEC_CHUNK;
+    len = FLINT_MIN(IS_PRIME_VEC_CHUNK, work->len - start);
+
+    _n_is_prime_vec(work->res + start, work->vec + start, len);
+}
+
+void
+n_is_prime_vec(int * res, const ulong * vec, slong len)
+{
+    work_t work;
+    slong num_chunks;
+
+    if (len <= IS_PRIME_VEC_CHUNK)
+    {
+        _n_is_prime_vec(res, vec, len);
+        return;
+    }
+
+    work.res = res;
+    work.vec = vec;
+    work.len = len;
+
+    num_chunks = (len + IS_PRIME_VEC_CHUNK - 1) / IS_PRIME_VEC_CHUNK;
+
+    flint_parallel_do((do_func_t) worker, &work, num_chunks, -1, FLINT_PARALLEL_STRIDED);
+}
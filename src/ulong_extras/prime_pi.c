@@ -10,6 +10,7 @@
 */
 
 #include "flint.h"
+#include "thread_support.h"
 #include "ulong_extras.h"
 
 const unsigned char FLINT_PRIME_PI_ODD_LOOKUP[] =
@@ -23,6 +24,186 @@ const unsigned char FLINT_PRIME_PI_ODD_LOOKUP[] =
 };
 
 
+/* Above this, pi(n) is computed with Meissel's formula instead of
+   by extending the table of cached primes. */
+#define FLINT_PRIME_PI_MEISSEL_CUTOFF (UWORD(1) << 22)
+
+/* phi(x, 6) is evaluated using the period 2*3*5*7*11*13 */
+#define WHEEL_A 6
+#define WHEEL_M 30030
+#define WHEEL_PHI_M 5760
+
+#define SIEVE_WORDS 4096
+
+typedef struct
+{
+    ulong z;                    /* pi(v) is tabulated for v <= z */
+    ulong * bits;               /* bit k set iff 2k + 1 is prime */
+    ulong * counts;             /* bits set in the preceding words */
+    const ulong * sieve_primes;
+    slong num_sieve_primes;
+    slong nwords;
+    ulong * primes;             /* primes[i] is the (i + 1)th prime */
+    unsigned short * wheel;     /* wheel[r] = phi(r, 6) */
+    ulong x;
+    slong * terms;
+}
+meissel_t;
+
+static void
+sieve_worker(slong j, meissel_t * M)
+{
+    slong start = j * SIEVE_WORDS;
+
+    _n_sieve_odd_bits(M->bits + start, 1 + 2 * (ulong) start * FLINT_BITS,
+        FLINT_MIN(SIEVE_WORDS, M->nwords - start),
+        M->sieve_primes, M->num_sieve_primes);
+}
+
+static ulong
+pi_tab(const meissel_t * M, ulong v)
+{
+    ulong k, w;
+
+    if (v < 2)
+        return 0;
+
+    k = (v - 1) / 2;
+
+    w = M->bits[k / FLINT_BITS] & ((UWORD(2) << (k % FLINT_BITS)) - 1);
+
+    return 1 + M->counts[k / FLINT_BITS] + mpn_popcount(&w, 1);
+}
+
+/* The number of 1 <= n <= x not divisible by any of the first a primes,
+   for a >= 6. */
+static slong
+phi(ulong x, slong a, const meissel_t * M)
+{
+    const ulong * primes = M->primes;
+    ulong p, y;
+    slong i, s;
+
+    p = primes[a];
+
+    if (x < p)
+        return (x >= 1);
+
+    if (x <= M->z && x / p < p)
+        return pi_tab(M, x) - a + 1;
+
+    s = (x / WHEEL_M) * WHEEL_PHI_M + M->wheel[x % WHEEL_M];
+
+    for (i = WHEEL_A; i < a; i++)
+    {
+        p = primes[i];
+        y = x / p;
+
+        /* all remaining terms are phi(y, i) = 1 */
+        if (y < p)
+        {
+            for ( ; i < a && primes[i] <= x; i++)
+                s--;
+            break;
+        }
+
+        s -= phi(y, i, M);
+    }
+
+    return s;
+}
+
+static void
+phi_worker(slong i, meissel_t * M)
+{
+    i += WHEEL_A;
+    M->terms[i] = phi(M->x / M->primes[i], i, M);
+}
+
+/* pi(x) = phi(x, a) + a - 1 - P2(x, a) with a = pi(x^(1/3)), where
+   P2(x, a) = sum_{a < i <= b} (pi(x / p_i) - i + 1) and b = pi(x^(1/2)).
+   Both phi and P2 only need pi(v) for v <= x^(2/3), which is tabulated
+   using a segmented sieve. */
+static ulong
+n_prime_pi_meissel(ulong x)
+{
+    meissel_t M;
+    ulong lo, hi, r, c, q, p, res;
+    slong i, a, b, num, nwords, nbits;
+
+    c = n_cbrt(x);
+    r = n_sqrt(x);
+
+    M.x = x;
+    M.z = x / c;
+
+    /* table of pi(v) for v <= z */
+    nbits = (M.z - 1) / 2 + 1;
+    nwords = (nbits + FLINT_BITS - 1) / FLINT_BITS;
+
+    M.nwords = nwords;
+    M.bits = flint_malloc(sizeof(ulong) * nwords);
+    M.counts = flint_malloc(sizeof(ulong) * nwords);
+
+    n_prime_pi_bounds(&lo, &hi, n_sqrt(2 * nwords * FLINT_BITS) + 1);
+    M.sieve_primes = n_primes_arr_readonly(hi + 1);
+    M.num_sieve_primes = hi + 1;
+
+    flint_parallel_do((do_func_t) sieve_worker, &M,
+        (nwords + SIEVE_WORDS - 1) / SIEVE_WORDS, -1, FLINT_PARALLEL_STRIDED);
+
+    M.counts[0] = 0;
+    for (i = 1; i < nwords; i++)
+        M.counts[i] = M.counts[i - 1] + mpn_popcount(M.bits + i - 1, 1);
+
+    /* primes up to the first one exceeding sqrt(x) */
+    num = pi_tab(&M, 2 * r + 2);
+    M.primes = flint_malloc(sizeof(ulong) * num);
+    M.primes[0] = 2;
+
+    for (i = 0, b = 1; b < num; i++)
+    {
+        for (q = M.bits[i]; q != 0 && b < num; q &= (q - 1))
+            M.primes[b++] = 2 * (i * FLINT_BITS + flint_ctz(q)) + 1;
+    }
+
+    a = pi_tab(&M, c);
+    b = pi_tab(&M, r);
+
+    M.wheel = flint_malloc(sizeof(unsigned short) * WHEEL_M);
+    M.wheel[0] = 0;
+    for (q = 1; q < WHEEL_M; q++)
+        M.wheel[q] = M.wheel[q - 1] + (q % 2 != 0 && q % 3 != 0 && q % 5 != 0
+            && q % 7 != 0 && q % 11 != 0 && q % 13 != 0);
+
+    /* phi(x, a) = phi(x, 6) - sum_{6 <= i < a} phi(x / p_{i+1}, i),
+       with the terms evaluated in parallel */
+    M.terms = flint_malloc(sizeof(slong) * FLINT_MAX(a, 1));
+
+    flint_parallel_do((do_func_t) phi_worker, &M, a - WHEEL_A, -1, FLINT_PARALLEL_STRIDED);
+
+    res = (x / WHEEL_M) * WHEEL_PHI_M + M.wheel[x % WHEEL_M];
+
+    for (i = WHEEL_A; i < a; i++)
+        res -= M.terms[i];
+
+    res += a - 1;
+
+    for (i = a; i < b; i++)
+    {
+        p = M.primes[i];
+        res -= pi_tab(&M, x / p) - i;
+    }
+
+    flint_free(M.bits);
+    flint_free(M.counts);
+    flint_free(M.primes);
+    flint_free(M.wheel);
+    flint_free(M.terms);
+
+    return res;
+}
+
 ulong n_prime_pi(mp_limb_t n)
 {
     ulong low, mid, high;
@@ -35,6 +216,11 @@ ulong n_prime_pi(mp_limb_t n)
         return FLINT_PRIME_PI_ODD_LOOKUP[(n-1)/2];
     }
 
+    /* unless the cached primes already cover n */
+    if (n >= FLINT_PRIME_PI_MEISSEL_CUTOFF && (_flint_primes_used == 0 ||
+        n >= _flint_primes[_flint_primes_used - 1][(WORD(1) << (_flint_primes_used - 1)) - 1]))
+        return n_prime_pi_meissel(n);
+
     n_prime_pi_bounds(&low, &high, n);
     primes = n_primes_arr_readonly(high + 1);
 
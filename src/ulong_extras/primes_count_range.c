@@ -0,0 +1,69 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "thread_support.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    ulong a;
+    ulong b;
+    const ulong * primes;
+    slong num_primes;
+    ulong * counts;
+}
+work_t;
+
+static void
+worker(slong j, work_t * work)
+{
+    ulong odd;
+    slong nwords;
+    ulong * bits;
+    int two;
+
+    work->counts[j] = _n_primes_sieve_block(&bits, &nwords, &odd, &two,
+                          work->a, work->b, j, work->primes, work->num_primes);
+
+    flint_free(bits);
+}
+
+ulong
+n_primes_count_range(ulong a, ulong b)
+{
+    work_t work;
+    ulong lo, hi, count;
+    slong i, num_blocks;
+
+    if (a > b)
+        return 0;
+
+    num_blocks = (b - a) / FLINT_SIEVE_BLOCK_SIZE + 1;
+
+    n_prime_pi_bounds(&lo, &hi, n_sqrt(b) + 1);
+
+    work.a = a;
+    work.b = b;
+    work.primes = n_primes_arr_readonly(hi + 1);
+    work.num_primes = hi + 1;
+    work.counts = flint_malloc(sizeof(ulong) * num_blocks);
+
+    flint_parallel_do((do_func_t) worker, &work, num_blocks, -1, FLINT_PARALLEL_STRIDED);
+
+    count = 0;
+    for (i = 0; i < num_blocks; i++)
+        count += work.counts[i];
+
+    flint_free(work.counts);
+
+    return count;
+}
@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "thread_support.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    ulong a;
+    ulong b;
+    const ulong * primes;
+    slong num_primes;
+    n_primes_block_func_t func;
+    void * arg;
+}
+work_t;
+
+static void
+worker(slong j, work_t * work)
+{
+    ulong odd, w;
+    slong nwords, i, num;
+    ulong * bits;
+    ulong * res;
+    int two;
+
+    num = _n_primes_sieve_block(&bits, &nwords, &odd, &two, work->a, work->b,
+                                j, work->primes, work->num_primes);
+
+    res = flint_malloc(sizeof(ulong) * FLINT_MAX(num, 1));
+    num = 0;
+
+    if (two)
+        res[num++] = 2;
+
+    for (i = 0; i < nwords; i++)
+    {
+        for (w = bits[i]; w != 0; w &= (w - 1))
+            res[num++] = odd + 2 * (i * FLINT_BITS + flint_ctz(w));
+    }
+
+    work->func(res, num, j, work->arg);
+
+    flint_free(res);
+    flint_free(bits);
+}
+
+void
+n_primes_parallel_do(ulong a, ulong b, n_primes_block_func_t func, void * arg, slong thread_limit)
+{
+    work_t work;
+    ulong lo, hi;
+    slong num_blocks;
+
+    if (a > b)
+        return;
+
+    num_blocks = (b - a) / FLINT_SIEVE_BLOCK_SIZE + 1;
+
+    /* all primes up to sqrt(b), and possibly a few more */
+    n_prime_pi_bounds(&lo, &hi, n_sqrt(b) + 1);
+
+    work.a = a;
+    work.b = b;
+    work.primes = n_primes_arr_readonly(hi + 1);
+    work.num_primes = hi + 1;
+    work.func = func;
+    work.arg = arg;
+
+    flint_parallel_do((do_func_t) worker, &work, num_blocks, thread_limit, FLINT_PARALLEL_STRIDED);
+}
@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+slong
+_n_primes_sieve_block(ulong ** bits, slong * nwords, ulong * odd, int * two,
+    ulong a, ulong b, slong j, const ulong * primes, slong num_primes)
+{
+    ulong lo, hi;
+    slong nbits, num;
+
+    lo = a + j * FLINT_SIEVE_BLOCK_SIZE;
+    hi = (b - lo < FLINT_SIEVE_BLOCK_SIZE) ? b : lo + FLINT_SIEVE_BLOCK_SIZE - 1;
+
+    *odd = FLINT_MAX(lo, 3);
+    *odd += (*odd % 2 == 0);
+
+    *two = (lo <= 2 && hi >= 2);
+    *bits = NULL;
+    *nwords = 0;
+
+    num = *two;
+
+    if (*odd <= hi)
+    {
+        nbits = (hi - *odd) / 2 + 1;
+        *nwords = (nbits + FLINT_BITS - 1) / FLINT_BITS;
+
+        *bits = flint_malloc(sizeof(ulong) * *nwords);
+        _n_sieve_odd_bits(*bits, *odd, *nwords, primes, num_primes);
+
+        /* clear the bits past the end of the block */
+        if (nbits % FLINT_BITS != 0)
+            (*bits)[*nwords - 1] &= (UWORD(1) << (nbits % FLINT_BITS)) - 1;
+
+        num += mpn_popcount(*bits, *nwords);
+    }
+
+    return num;
+}
@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* The wheel removes multiples of 3, 5, 7, 11, 13. On the odd numbers
+   2k + 1 the pattern is periodic in k with period 3*5*7*11*13. */
+#define WHEEL_PERIOD 15015
+#define WHEEL_WORDS ((WHEEL_PERIOD + FLINT_BITS - 1) / FLINT_BITS + 2)
+#define WHEEL_LAST_PRIME 13
+
+static const unsigned int wheel_primes[5] = { 3, 5, 7, 11, 13 };
+
+/* Pattern bit k is set iff 2k + 1 is coprime to the wheel primes,
+   for 0 <= k < WHEEL_PERIOD + FLINT_BITS so that any FLINT_BITS
+   consecutive bits can be extracted without wrapping around. */
+static void
+wheel_init(ulong * pattern)
+{
+    ulong i, k, q;
+
+    for (i = 0; i < WHEEL_WORDS; i++)
+        pattern[i] = ~UWORD(0);
+
+    for (i = 0; i < 5; i++)
+    {
+        q = wheel_primes[i];
+
+        for (k = (q - 1) / 2; k < WHEEL_WORDS * FLINT_BITS; k += q)
+            pattern[k / FLINT_BITS] &= ~(UWORD(1) << (k % FLINT_BITS));
+    }
+}
+
+void
+_n_sieve_odd_bits(ulong * res, ulong a, slong nwords, const ulong * primes, slong num_primes)
+{
+    ulong pattern[WHEEL_WORDS];
+    ulong p, i, s, nbits, sq, sr;
+    slong j;
+
+    nbits = nwords * FLINT_BITS;
+
+    /* presieve with the wheel */
+    wheel_init(pattern);
+
+    s = ((a - 1) / 2) % WHEEL_PERIOD;
+
+    for (j = 0; j < nwords; j++)
+    {
+        sq = s / FLINT_BITS;
+        sr = s % FLINT_BITS;
+
+        if (sr == 0)
+            res[j] = pattern[sq];
+        else
+            res[j] = (pattern[sq] >> sr) | (pattern[sq + 1] << (FLINT_BITS - sr));
+
+        s += FLINT_BITS;
+        if (s >= WHEEL_PERIOD)
+            s -= WHEEL_PERIOD;
+    }
+
+    /* the wheel primes themselves, and 1 */
+    if (a <= WHEEL_LAST_PRIME)
+    {
+        for (j = 0; j < 5; j++)
+        {
+            p = wheel_primes[j];
+
+            if (p >= a && (p - a) / 2 < nbits)
+                res[(p - a) / 2 / FLINT_BITS] |= UWORD(1) << (((p - a) / 2) % FLINT_BITS);
+        }
+
+        if (a == 1)
+            res[0] &= ~UWORD(1);
+    }
+
+    /* cross off the remaining primes, starting from p^2 */
+    for (j = 0; j < num_primes; j++)
+    {
+        p = primes[j];
+
+        if (p <= WHEEL_LAST_PRIME)
+            continue;
+
+        /* p^2 is larger than any word */
+        if (p >= (UWORD(1) << (FLINT_BITS / 2)))
+            break;
+
+        if (p * p >= a)
+        {
+            if ((p * p - a) / 2 >= nbits)
+                break;
+
+            i = (p * p - a) / 2;
+        }
+        else
+        {
+            /* solve a + 2i = 0 mod p */
+            i = (((p - a % p) % p) * ((p + 1) / 2)) % p;
+        }
+
+        for ( ; i < nbits; i += p)
+            res[i / FLINT_BITS] &= ~(UWORD(1) << (i % FLINT_BITS));
+    }
+}
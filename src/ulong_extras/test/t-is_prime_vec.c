@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("is_prime_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        ulong * vec;
+        int * res;
+        slong i, len;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 2) ? n_randint(state, 20) : n_randint(state, 2000);
+
+        vec = flint_malloc(sizeof(ulong) * FLINT_MAX(len, 1));
+        res = flint_malloc(sizeof(int) * FLINT_MAX(len, 1));
+
+        for (i = 0; i < len; i++)
+        {
+            switch (n_randint(state, 6))
+            {
+                case 0:
+                    vec[i] = n_randtest(state);
+                    break;
+                case 1:
+                    vec[i] = n_randtest_prime(state, 0);
+                    break;
+                case 2:
+                    /* products of two primes which pass trial division */
+                    vec[i] = n_randprime(state, 2 + n_randint(state, FLINT_BITS / 2 - 1), 0)
+                           * n_randprime(state, 2 + n_randint(state, FLINT_BITS / 2 - 1), 0);
+                    break;
+                case 3:
+                    vec[i] = n_randint(state, 1000);
+                    break;
+#if FLINT64
+                case 4:
+                    /* a strong pseudoprime to all prime bases up to 23 */
+                    vec[i] = UWORD(3825123056546413051);
+                    break;
+#endif
+                default:
+                    vec[i] = n_randtest_bits(state, 1 + n_randint(state, FLINT_BITS)) | 1;
+            }
+        }
+
+        n_is_prime_vec(res, vec, len);
+
+        for (i = 0; i < len; i++)
+        {
+            if (res[i] != n_is_prime(vec[i]))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("i = %wd, len = %wd, n = %wu, res = %d\n", i, len, vec[i], res[i]);
+                flint_abort();
+            }
+        }
+
+        flint_free(vec);
+        flint_free(res);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -43,6 +43,33 @@ int main(void)
         }
     }
 
+    /* large n, where the cached primes are not used */
+    for (n = 0; n < 10 * FLINT_MIN(10, flint_test_multiplier()); n++)
+    {
+        ulong x, c;
+
+        x = (UWORD(1) << 22) + n_randint(state, UWORD(1) << (22 + n_randint(state, 5)));
+        c = n_primes_count_range(0, x);
+
+        if (n_prime_pi(x) != n_prime_pi(x - 1) + n_is_prime(x) || n_prime_pi(x) != c)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("x = %wu, pi(x) = %wu, pi(x-1) = %wu, count = %wu\n",
+                x, n_prime_pi(x), n_prime_pi(x - 1), c);
+            fflush(stdout);
+            flint_abort();
+        }
+    }
+
+#if FLINT64
+    if (n_prime_pi(UWORD(1000000000000)) != UWORD(37607912018))
+    {
+        flint_printf("FAIL: pi(10^12)\n");
+        fflush(stdout);
+        flint_abort();
+    }
+#endif
+
     FLINT_TEST_CLEANUP(state);
     flint_printf("PASS\n");
     return 0;
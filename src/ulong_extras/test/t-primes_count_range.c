@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "thread_support.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("primes_count_range....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        ulong a, b, c1, c2, n;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                a = n_randint(state, 1000);
+                break;
+            case 1:
+                a = n_randint(state, UWORD(1) << 32);
+                break;
+            default:
+                a = n_randint(state, UWORD(1) << (FLINT_BITS - 24));
+        }
+
+        if (n_randint(state, 20) == 0)
+            b = a + n_randint(state, 3 * FLINT_SIEVE_BLOCK_SIZE);
+        else if (a > 0 && n_randint(state, 20) == 0)
+            b = a - 1 - n_randint(state, FLINT_MIN(a, 10));
+        else
+            b = a + n_randint(state, 10000);
+
+        c1 = n_primes_count_range(a, b);
+
+        c2 = 0;
+        for (n = a; n <= b; n++)
+            c2 += n_is_prime(n);
+
+        if (c1 != c2)
+        {
+            flint_printf("FAIL\n");
+            flint_printf("a = %wu, b = %wu, c1 = %wu, c2 = %wu\n", a, b, c1, c2);
+            fflush(stdout);
+            flint_abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
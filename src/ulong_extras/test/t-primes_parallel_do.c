@@ -0,0 +1,118 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "thread_support.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    ulong ** primes;
+    slong * num;
+    slong num_blocks;
+}
+blocks_t;
+
+static void
+collect(const ulong * primes, slong num, slong block, blocks_t * res)
+{
+    slong i;
+
+    if (block < 0 || block >= res->num_blocks || res->num[block] != -1)
+    {
+        flint_printf("FAIL: block %wd\n", block);
+        flint_abort();
+    }
+
+    res->primes[block] = flint_malloc(sizeof(ulong) * FLINT_MAX(num, 1));
+    for (i = 0; i < num; i++)
+        res->primes[block][i] = primes[i];
+
+    res->num[block] = num;
+}
+
+int main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("primes_parallel_do....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 30 * flint_test_multiplier(); iter++)
+    {
+        blocks_t res;
+        ulong a, b, p;
+        slong i, j;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 2))
+            a = n_randint(state, 1000);
+        else
+            a = n_randint(state, UWORD(1) << (FLINT_BITS - 24));
+
+        b = a + n_randint(state, 3 * FLINT_SIEVE_BLOCK_SIZE);
+
+        res.num_blocks = (b - a) / FLINT_SIEVE_BLOCK_SIZE + 1;
+        res.primes = flint_malloc(sizeof(ulong *) * res.num_blocks);
+        res.num = flint_malloc(sizeof(slong) * res.num_blocks);
+
+        for (i = 0; i < res.num_blocks; i++)
+            res.num[i] = -1;
+
+        n_primes_parallel_do(a, b, (n_primes_block_func_t) collect, &res, -1);
+
+        /* the blocks concatenate to the primes in [a, b] */
+        p = (a == 0) ? 0 : a - 1;
+
+        for (i = 0; i < res.num_blocks; i++)
+        {
+            if (res.num[i] < 0)
+            {
+                flint_printf("FAIL: missing block %wd\n", i);
+                flint_abort();
+            }
+
+            for (j = 0; j < res.num[i]; j++)
+            {
+                p = n_nextprime(p, 1);
+
+                if (res.primes[i][j] != p)
+                {
+                    flint_printf("FAIL\n");
+                    flint_printf("a = %wu, b = %wu, block %wd, index %wd, %wu != %wu\n",
+                        a, b, i, j, res.primes[i][j], p);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+
+            flint_free(res.primes[i]);
+        }
+
+        if (n_nextprime(p, 1) <= b)
+        {
+            flint_printf("FAIL: missing primes\n");
+            flint_printf("a = %wu, b = %wu\n", a, b);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        flint_free(res.primes);
+        flint_free(res.num);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}